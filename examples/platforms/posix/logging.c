@@ -35,9 +35,11 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifndef _WIN32
+#include <sys/stat.h>
 #include <syslog.h>
 #endif
 
@@ -84,3 +86,28 @@ exit:
 }
 
 #endif // #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
+
+#if OPENTHREAD_CONFIG_LOG_BINARY && !defined(_WIN32)
+void otPlatLogBinary(const uint8_t *aData, uint16_t aLength)
+{
+    static FILE *sLogFile = NULL;
+
+    if (sLogFile == NULL)
+    {
+        char        fileName[32];
+        const char *offset = getenv("PORT_OFFSET");
+
+        mkdir("tmp", 0777);
+        snprintf(fileName, sizeof(fileName), "tmp/%s_%d.otlog", (offset != NULL) ? offset : "0", NODE_ID);
+
+        sLogFile = fopen(fileName, "ab");
+        otEXPECT(sLogFile != NULL);
+    }
+
+    fwrite(aData, 1, aLength, sLogFile);
+    fflush(sLogFile);
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_LOG_BINARY && !defined(_WIN32)
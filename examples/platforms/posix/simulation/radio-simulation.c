@@ -0,0 +1,839 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the radio driver and the in-memory radio medium of the in-process simulation platform.
+ */
+
+#include "simulation.h"
+
+#include <string.h>
+
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/radio.h>
+#include <openthread/platform/random.h>
+
+#include "utils/code_utils.h"
+
+enum
+{
+    IEEE802154_MIN_LENGTH = 5,
+    IEEE802154_MAX_LENGTH = 127,
+    IEEE802154_ACK_LENGTH = 5,
+
+    IEEE802154_BROADCAST = 0xffff,
+
+    IEEE802154_FRAME_TYPE_ACK    = 2 << 0,
+    IEEE802154_FRAME_TYPE_MACCMD = 3 << 0,
+    IEEE802154_FRAME_TYPE_MASK   = 7 << 0,
+
+    IEEE802154_SECURITY_ENABLED  = 1 << 3,
+    IEEE802154_FRAME_PENDING     = 1 << 4,
+    IEEE802154_ACK_REQUEST       = 1 << 5,
+    IEEE802154_PANID_COMPRESSION = 1 << 6,
+
+    IEEE802154_DST_ADDR_NONE  = 0 << 2,
+    IEEE802154_DST_ADDR_SHORT = 2 << 2,
+    IEEE802154_DST_ADDR_EXT   = 3 << 2,
+    IEEE802154_DST_ADDR_MASK  = 3 << 2,
+
+    IEEE802154_SRC_ADDR_NONE  = 0 << 6,
+    IEEE802154_SRC_ADDR_SHORT = 2 << 6,
+    IEEE802154_SRC_ADDR_EXT   = 3 << 6,
+    IEEE802154_SRC_ADDR_MASK  = 3 << 6,
+
+    IEEE802154_DSN_OFFSET     = 2,
+    IEEE802154_DSTPAN_OFFSET  = 3,
+    IEEE802154_DSTADDR_OFFSET = 5,
+
+    IEEE802154_SEC_LEVEL_MASK = 7 << 0,
+
+    IEEE802154_KEY_ID_MODE_0    = 0 << 3,
+    IEEE802154_KEY_ID_MODE_1    = 1 << 3,
+    IEEE802154_KEY_ID_MODE_2    = 2 << 3,
+    IEEE802154_KEY_ID_MODE_3    = 3 << 3,
+    IEEE802154_KEY_ID_MODE_MASK = 3 << 3,
+
+    IEEE802154_MACCMD_DATA_REQ = 4,
+};
+
+enum
+{
+    SIMULATION_RECEIVE_SENSITIVITY = -100, // dBm
+    SIMULATION_NOISE_FLOOR         = -98,  // dBm
+
+    SIMULATION_PHY_HEADER_LENGTH = 6,                         // Preamble, SFD and PHR (bytes)
+    SIMULATION_BYTE_TIME         = 2 * OT_RADIO_SYMBOL_TIME,  // microseconds
+    SIMULATION_TURNAROUND_TIME   = 12 * OT_RADIO_SYMBOL_TIME, // microseconds
+    SIMULATION_ACK_WAIT_TIME     = 54 * OT_RADIO_SYMBOL_TIME, // macAckWaitDuration (microseconds)
+    SIMULATION_ACK_TIME =
+        SIMULATION_TURNAROUND_TIME + (SIMULATION_PHY_HEADER_LENGTH + IEEE802154_ACK_LENGTH) * SIMULATION_BYTE_TIME,
+};
+
+static SimulationCounters sCounters;
+
+static bool findShortAddress(const SimulationNode *aNode, uint16_t aShortAddress)
+{
+    uint8_t i;
+
+    for (i = 0; i < aNode->mShortAddressMatchTableCount; ++i)
+    {
+        if (aNode->mShortAddressMatchTable[i] == aShortAddress)
+        {
+            break;
+        }
+    }
+
+    return i < aNode->mShortAddressMatchTableCount;
+}
+
+static bool findExtAddress(const SimulationNode *aNode, const otExtAddress *aExtAddress)
+{
+    uint8_t i;
+
+    for (i = 0; i < aNode->mExtAddressMatchTableCount; ++i)
+    {
+        if (!memcmp(&aNode->mExtAddressMatchTable[i], aExtAddress, sizeof(otExtAddress)))
+        {
+            break;
+        }
+    }
+
+    return i < aNode->mExtAddressMatchTableCount;
+}
+
+static inline bool isFrameTypeMacCmd(const uint8_t *frame)
+{
+    return (frame[0] & IEEE802154_FRAME_TYPE_MASK) == IEEE802154_FRAME_TYPE_MACCMD;
+}
+
+static inline bool isSecurityEnabled(const uint8_t *frame)
+{
+    return (frame[0] & IEEE802154_SECURITY_ENABLED) != 0;
+}
+
+static inline bool isAckRequested(const uint8_t *frame)
+{
+    return (frame[0] & IEEE802154_ACK_REQUEST) != 0;
+}
+
+static inline bool isPanIdCompressed(const uint8_t *frame)
+{
+    return (frame[0] & IEEE802154_PANID_COMPRESSION) != 0;
+}
+
+static bool isDataRequestAndHasFramePending(const SimulationNode *aNode, const uint8_t *frame)
+{
+    const uint8_t *cur = frame;
+    uint8_t        securityControl;
+    bool           isDataRequest   = false;
+    bool           hasFramePending = false;
+
+    // FCF + DSN
+    cur += 2 + 1;
+
+    otEXPECT(isFrameTypeMacCmd(frame));
+
+    // Destination PAN + Address
+    switch (frame[1] & IEEE802154_DST_ADDR_MASK)
+    {
+    case IEEE802154_DST_ADDR_SHORT:
+        cur += sizeof(otPanId) + sizeof(otShortAddress);
+        break;
+
+    case IEEE802154_DST_ADDR_EXT:
+        cur += sizeof(otPanId) + sizeof(otExtAddress);
+        break;
+
+    default:
+        goto exit;
+    }
+
+    // Source PAN + Address
+    switch (frame[1] & IEEE802154_SRC_ADDR_MASK)
+    {
+    case IEEE802154_SRC_ADDR_SHORT:
+        if (!isPanIdCompressed(frame))
+        {
+            cur += sizeof(otPanId);
+        }
+
+        if (aNode->mSrcMatchEnabled)
+        {
+            hasFramePending = findShortAddress(aNode, (uint16_t)(cur[1] << 8 | cur[0]));
+        }
+
+        cur += sizeof(otShortAddress);
+        break;
+
+    case IEEE802154_SRC_ADDR_EXT:
+        if (!isPanIdCompressed(frame))
+        {
+            cur += sizeof(otPanId);
+        }
+
+        if (aNode->mSrcMatchEnabled)
+        {
+            hasFramePending = findExtAddress(aNode, (const otExtAddress *)cur);
+        }
+
+        cur += sizeof(otExtAddress);
+        break;
+
+    default:
+        goto exit;
+    }
+
+    // Security Control + Frame Counter + Key Identifier
+    if (isSecurityEnabled(frame))
+    {
+        securityControl = *cur;
+
+        if (securityControl & IEEE802154_SEC_LEVEL_MASK)
+        {
+            cur += 1 + 4;
+        }
+
+        switch (securityControl & IEEE802154_KEY_ID_MODE_MASK)
+        {
+        case IEEE802154_KEY_ID_MODE_0:
+            cur += 0;
+            break;
+
+        case IEEE802154_KEY_ID_MODE_1:
+            cur += 1;
+            break;
+
+        case IEEE802154_KEY_ID_MODE_2:
+            cur += 5;
+            break;
+
+        case IEEE802154_KEY_ID_MODE_3:
+            cur += 9;
+            break;
+        }
+    }
+
+    // Command ID
+    isDataRequest = cur[0] == IEEE802154_MACCMD_DATA_REQ;
+
+exit:
+    return isDataRequest && hasFramePending;
+}
+
+static inline uint8_t getDsn(const uint8_t *frame)
+{
+    return frame[IEEE802154_DSN_OFFSET];
+}
+
+static inline otPanId getDstPan(const uint8_t *frame)
+{
+    return (otPanId)((frame[IEEE802154_DSTPAN_OFFSET + 1] << 8) | frame[IEEE802154_DSTPAN_OFFSET]);
+}
+
+static inline otShortAddress getShortAddress(const uint8_t *frame)
+{
+    return (otShortAddress)((frame[IEEE802154_DSTADDR_OFFSET + 1] << 8) | frame[IEEE802154_DSTADDR_OFFSET]);
+}
+
+static bool isLost(const SimulationLink *aLink)
+{
+    return aLink->mLossRate != 0 && (otPlatRandomGet() % 0xffff) < aLink->mLossRate;
+}
+
+static bool getChannelRssi(const SimulationNode *aListener, uint8_t aChannel, int8_t *aRssi)
+{
+    bool found = false;
+
+    for (uint16_t i = 0; i < simulationGetNodeCount(); i++)
+    {
+        const SimulationNode *node = simulationGetNodeAt(i);
+        const SimulationLink *link;
+
+        if (node == aListener || node->mTxPhase != SIMULATION_TX_ON_AIR || node->mTransmitFrame.mChannel != aChannel)
+        {
+            continue;
+        }
+
+        link = simulationGetLink(node, aListener);
+
+        if (link->mRssi >= SIMULATION_RECEIVE_SENSITIVITY && (!found || link->mRssi > *aRssi))
+        {
+            *aRssi = link->mRssi;
+            found  = true;
+        }
+    }
+
+    return found;
+}
+
+static void radioTransmitDone(SimulationNode *aNode, otRadioFrame *aAckFrame, otError aError)
+{
+    aNode->mRadioState = OT_RADIO_STATE_RECEIVE;
+    aNode->mTxPhase    = SIMULATION_TX_IDLE;
+
+    otPlatRadioTxDone(aNode->mInstance, &aNode->mTransmitFrame, aAckFrame, aError);
+}
+
+static void radioSendAck(SimulationNode *aReceiver, SimulationNode *aSender)
+{
+    const SimulationLink *link    = simulationGetLink(aReceiver, aSender);
+    uint64_t              arrival = simulationGetNow() + SIMULATION_ACK_TIME + link->mDelay;
+
+    // The sender only takes an acknowledgment that arrives before its ack wait duration elapsed.
+    otEXPECT(aSender->mTxPhase == SIMULATION_TX_ACK_WAIT && arrival <= aSender->mTxEventTime &&
+             getDsn(aSender->mTransmitPsdu) == getDsn(aReceiver->mReceivePsdu) &&
+             link->mRssi >= SIMULATION_RECEIVE_SENSITIVITY);
+    otEXPECT_ACTION(!isLost(link), sCounters.mLostFrames++);
+
+    aSender->mAckFrame.mLength  = IEEE802154_ACK_LENGTH;
+    aSender->mAckFrame.mChannel = aReceiver->mReceiveFrame.mChannel;
+    aSender->mAckFrame.mRssi    = link->mRssi;
+    aSender->mAckFrame.mLqi     = OT_RADIO_LQI_NONE;
+    aSender->mAckPsdu[0]        = IEEE802154_FRAME_TYPE_ACK;
+
+    if (isDataRequestAndHasFramePending(aReceiver, aReceiver->mReceivePsdu))
+    {
+        aSender->mAckPsdu[0] |= IEEE802154_FRAME_PENDING;
+    }
+
+    aSender->mAckPsdu[1]  = 0;
+    aSender->mAckPsdu[2]  = getDsn(aReceiver->mReceivePsdu);
+    aSender->mAckReceived = true;
+    aSender->mTxEventTime = arrival;
+
+exit:
+    return;
+}
+
+static void radioProcessFrame(SimulationNode *aReceiver, SimulationNode *aSender)
+{
+    otError        error = OT_ERROR_NONE;
+    const uint8_t *psdu  = aReceiver->mReceivePsdu;
+    otPanId        dstpan;
+    otShortAddress short_address;
+
+    otEXPECT_ACTION(aReceiver->mPromiscuous == false, error = OT_ERROR_NONE);
+
+    switch (psdu[1] & IEEE802154_DST_ADDR_MASK)
+    {
+    case IEEE802154_DST_ADDR_NONE:
+        break;
+
+    case IEEE802154_DST_ADDR_SHORT:
+        dstpan        = getDstPan(psdu);
+        short_address = getShortAddress(psdu);
+        otEXPECT_ACTION((dstpan == IEEE802154_BROADCAST || dstpan == aReceiver->mPanId) &&
+                            (short_address == IEEE802154_BROADCAST || short_address == aReceiver->mShortAddress),
+                        error = OT_ERROR_ABORT);
+        break;
+
+    case IEEE802154_DST_ADDR_EXT:
+        // Both the frame and `mExtAddress` hold the extended address in little-endian byte order.
+        dstpan = getDstPan(psdu);
+        otEXPECT_ACTION((dstpan == IEEE802154_BROADCAST || dstpan == aReceiver->mPanId) &&
+                            memcmp(&psdu[IEEE802154_DSTADDR_OFFSET], &aReceiver->mExtAddress, sizeof(otExtAddress)) ==
+                                0,
+                        error = OT_ERROR_ABORT);
+        break;
+
+    default:
+        error = OT_ERROR_ABORT;
+        goto exit;
+    }
+
+    aReceiver->mReceiveFrame.mLqi = OT_RADIO_LQI_NONE;
+
+    // generate acknowledgment
+    if (isAckRequested(psdu))
+    {
+        radioSendAck(aReceiver, aSender);
+    }
+
+exit:
+    otPlatRadioReceiveDone(aReceiver->mInstance, error == OT_ERROR_NONE ? &aReceiver->mReceiveFrame : NULL, error);
+}
+
+static void radioQueueReception(SimulationNode *aReceiver, SimulationNode *aSender, const SimulationLink *aLink)
+{
+    const otRadioFrame * frame = &aSender->mTransmitFrame;
+    uint64_t             time  = simulationGetNow() + aLink->mDelay;
+    uint8_t              index;
+    uint8_t              prev;
+    SimulationReception *reception;
+
+    otEXPECT_ACTION(aReceiver->mReceptionCount < SIMULATION_RECEPTION_QUEUE_SIZE, sCounters.mOverflowFrames++);
+
+    // Keep the ring ordered by reception time. Frames mostly arrive in
+    // transmission order, so this rarely moves an entry.
+    index = (uint8_t)((aReceiver->mReceptionHead + aReceiver->mReceptionCount) % SIMULATION_RECEPTION_QUEUE_SIZE);
+
+    while (index != aReceiver->mReceptionHead)
+    {
+        prev = (uint8_t)((index + SIMULATION_RECEPTION_QUEUE_SIZE - 1) % SIMULATION_RECEPTION_QUEUE_SIZE);
+
+        if (aReceiver->mReceptions[prev].mTime <= time)
+        {
+            break;
+        }
+
+        aReceiver->mReceptions[index] = aReceiver->mReceptions[prev];
+        index                         = prev;
+    }
+
+    reception           = &aReceiver->mReceptions[index];
+    reception->mTime    = time;
+    reception->mSender  = aSender;
+    reception->mRssi    = aLink->mRssi;
+    reception->mChannel = frame->mChannel;
+    reception->mLength  = frame->mLength;
+    memcpy(reception->mPsdu, frame->mPsdu, frame->mLength);
+    aReceiver->mReceptionCount++;
+
+exit:
+    return;
+}
+
+static void radioDeliver(SimulationNode *aSender)
+{
+    for (uint16_t i = 0; i < simulationGetNodeCount(); i++)
+    {
+        SimulationNode *      receiver = simulationGetNodeAt(i);
+        const SimulationLink *link;
+
+        if (receiver == aSender)
+        {
+            continue;
+        }
+
+        link = simulationGetLink(aSender, receiver);
+
+        if (link->mRssi < SIMULATION_RECEIVE_SENSITIVITY)
+        {
+            continue;
+        }
+
+        if (isLost(link))
+        {
+            sCounters.mLostFrames++;
+            continue;
+        }
+
+        radioQueueReception(receiver, aSender, link);
+    }
+}
+
+static void radioProcessReceptions(SimulationNode *aNode)
+{
+    uint64_t now = simulationGetNow();
+
+    while (aNode->mReceptionCount > 0 && aNode->mReceptions[aNode->mReceptionHead].mTime <= now)
+    {
+        SimulationReception *reception = &aNode->mReceptions[aNode->mReceptionHead];
+
+        aNode->mReceptionHead = (uint8_t)((aNode->mReceptionHead + 1) % SIMULATION_RECEPTION_QUEUE_SIZE);
+        aNode->mReceptionCount--;
+
+        // A radio that is not listening on the channel when the frame ends misses it.
+        if (aNode->mRadioState != OT_RADIO_STATE_RECEIVE || aNode->mReceiveFrame.mChannel != reception->mChannel)
+        {
+            continue;
+        }
+
+        sCounters.mRxFrames++;
+        memcpy(aNode->mReceivePsdu, reception->mPsdu, reception->mLength);
+        aNode->mReceiveFrame.mLength = reception->mLength;
+        aNode->mReceiveFrame.mRssi   = reception->mRssi;
+
+#if OPENTHREAD_ENABLE_RAW_LINK_API
+        // Timestamp
+        aNode->mReceiveFrame.mMsec = otPlatAlarmMilliGetNow();
+        aNode->mReceiveFrame.mUsec = (uint16_t)(now % 1000);
+#endif
+
+        radioProcessFrame(aNode, reception->mSender);
+    }
+}
+
+void simulationMediumInit(void)
+{
+    memset(&sCounters, 0, sizeof(sCounters));
+}
+
+const SimulationCounters *simulationGetCounters(void)
+{
+    return &sCounters;
+}
+
+void simulationRadioInit(SimulationNode *aNode)
+{
+    aNode->mRadioState                  = OT_RADIO_STATE_DISABLED;
+    aNode->mTxPhase                     = SIMULATION_TX_IDLE;
+    aNode->mAckReceived                 = false;
+    aNode->mPromiscuous                 = false;
+    aNode->mSrcMatchEnabled             = false;
+    aNode->mShortAddressMatchTableCount = 0;
+    aNode->mExtAddressMatchTableCount   = 0;
+    aNode->mReceptionHead               = 0;
+    aNode->mReceptionCount              = 0;
+    aNode->mReceiveFrame.mPsdu          = aNode->mReceivePsdu;
+    aNode->mTransmitFrame.mPsdu         = aNode->mTransmitPsdu;
+    aNode->mAckFrame.mPsdu              = aNode->mAckPsdu;
+}
+
+uint64_t simulationRadioGetNextEvent(const SimulationNode *aNode)
+{
+    uint64_t next = (aNode->mTxPhase == SIMULATION_TX_IDLE) ? UINT64_MAX : aNode->mTxEventTime;
+
+    if (aNode->mReceptionCount > 0 && aNode->mReceptions[aNode->mReceptionHead].mTime < next)
+    {
+        next = aNode->mReceptions[aNode->mReceptionHead].mTime;
+    }
+
+    return next;
+}
+
+void simulationRadioProcess(SimulationNode *aNode)
+{
+    uint64_t now = simulationGetNow();
+    int8_t   rssi;
+
+    radioProcessReceptions(aNode);
+
+    otEXPECT(aNode->mTxPhase != SIMULATION_TX_IDLE && aNode->mTxEventTime <= now);
+
+    switch (aNode->mTxPhase)
+    {
+    case SIMULATION_TX_START:
+        otPlatRadioTxStarted(aNode->mInstance, &aNode->mTransmitFrame);
+
+        if (aNode->mTransmitFrame.mIsCcaEnabled && getChannelRssi(aNode, aNode->mTransmitFrame.mChannel, &rssi))
+        {
+            radioTransmitDone(aNode, NULL, OT_ERROR_CHANNEL_ACCESS_FAILURE);
+        }
+        else
+        {
+            aNode->mTxPhase     = SIMULATION_TX_ON_AIR;
+            aNode->mTxEventTime = now + (uint64_t)(SIMULATION_PHY_HEADER_LENGTH + aNode->mTransmitFrame.mLength) *
+                                            SIMULATION_BYTE_TIME;
+        }
+
+        break;
+
+    case SIMULATION_TX_ON_AIR:
+        sCounters.mTxFrames++;
+        sCounters.mTxBytes += aNode->mTransmitFrame.mLength;
+        aNode->mAckReceived = false;
+        aNode->mTxPhase     = SIMULATION_TX_ACK_WAIT;
+        aNode->mTxEventTime = now + SIMULATION_ACK_WAIT_TIME;
+        radioDeliver(aNode);
+
+        if (!isAckRequested(aNode->mTransmitPsdu))
+        {
+            radioTransmitDone(aNode, NULL, OT_ERROR_NONE);
+        }
+
+        break;
+
+    case SIMULATION_TX_ACK_WAIT:
+        if (aNode->mAckReceived)
+        {
+            radioTransmitDone(aNode, &aNode->mAckFrame, OT_ERROR_NONE);
+        }
+        else
+        {
+            radioTransmitDone(aNode, NULL, OT_ERROR_NO_ACK);
+        }
+
+        break;
+
+    case SIMULATION_TX_IDLE:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    uint16_t id = simulationGetNode(aInstance)->mId;
+
+    aIeeeEui64[0] = 0x18;
+    aIeeeEui64[1] = 0xb4;
+    aIeeeEui64[2] = 0x30;
+    aIeeeEui64[3] = 0x00;
+    aIeeeEui64[4] = 0x00;
+    aIeeeEui64[5] = 0x00;
+    aIeeeEui64[6] = (id >> 8) & 0xff;
+    aIeeeEui64[7] = id & 0xff;
+}
+
+void otPlatRadioSetPanId(otInstance *aInstance, uint16_t panid)
+{
+    simulationGetNode(aInstance)->mPanId = panid;
+}
+
+void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    simulationGetNode(aInstance)->mExtAddress = *aExtAddress;
+}
+
+void otPlatRadioSetShortAddress(otInstance *aInstance, uint16_t address)
+{
+    simulationGetNode(aInstance)->mShortAddress = address;
+}
+
+void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
+{
+    simulationGetNode(aInstance)->mPromiscuous = aEnable;
+}
+
+bool otPlatRadioIsEnabled(otInstance *aInstance)
+{
+    return (simulationGetNode(aInstance)->mRadioState != OT_RADIO_STATE_DISABLED) ? true : false;
+}
+
+otError otPlatRadioEnable(otInstance *aInstance)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+
+    if (node->mRadioState == OT_RADIO_STATE_DISABLED)
+    {
+        node->mRadioState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioDisable(otInstance *aInstance)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+
+    node->mRadioState = OT_RADIO_STATE_DISABLED;
+    node->mTxPhase    = SIMULATION_TX_IDLE;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSleep(otInstance *aInstance)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_INVALID_STATE;
+
+    if (node->mRadioState == OT_RADIO_STATE_SLEEP || node->mRadioState == OT_RADIO_STATE_RECEIVE)
+    {
+        error             = OT_ERROR_NONE;
+        node->mRadioState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return error;
+}
+
+otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_INVALID_STATE;
+
+    if (node->mRadioState != OT_RADIO_STATE_DISABLED)
+    {
+        error                        = OT_ERROR_NONE;
+        node->mRadioState            = OT_RADIO_STATE_RECEIVE;
+        node->mReceiveFrame.mChannel = aChannel;
+    }
+
+    return error;
+}
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_INVALID_STATE;
+
+    (void)aFrame;
+
+    if (node->mRadioState == OT_RADIO_STATE_RECEIVE)
+    {
+        error              = OT_ERROR_NONE;
+        node->mRadioState  = OT_RADIO_STATE_TRANSMIT;
+        node->mTxPhase     = SIMULATION_TX_START;
+        node->mTxEventTime = simulationGetNow();
+    }
+
+    return error;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    return &simulationGetNode(aInstance)->mTransmitFrame;
+}
+
+int8_t otPlatRadioGetRssi(otInstance *aInstance)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+    int8_t          rssi = SIMULATION_NOISE_FLOOR;
+
+    // The energy on a channel is the strongest signal of the nodes transmitting on it in range.
+    if (!getChannelRssi(node, node->mReceiveFrame.mChannel, &rssi) || rssi < SIMULATION_NOISE_FLOOR)
+    {
+        rssi = SIMULATION_NOISE_FLOOR;
+    }
+
+    return rssi;
+}
+
+otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    (void)aInstance;
+
+    // The medium reports a missing acknowledgment itself, so the MAC does not start its own ack timer.
+    return OT_RADIO_CAPS_ACK_TIMEOUT;
+}
+
+bool otPlatRadioGetPromiscuous(otInstance *aInstance)
+{
+    return simulationGetNode(aInstance)->mPromiscuous;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
+{
+    simulationGetNode(aInstance)->mSrcMatchEnabled = aEnable;
+}
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, const uint16_t aShortAddress)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mShortAddressMatchTableCount < SIMULATION_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+
+    for (uint8_t i = 0; i < node->mShortAddressMatchTableCount; ++i)
+    {
+        otEXPECT_ACTION(node->mShortAddressMatchTable[i] != aShortAddress, error = OT_ERROR_DUPLICATED);
+    }
+
+    node->mShortAddressMatchTable[node->mShortAddressMatchTableCount++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mExtAddressMatchTableCount < SIMULATION_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+
+    for (uint8_t i = 0; i < node->mExtAddressMatchTableCount; ++i)
+    {
+        otEXPECT_ACTION(memcmp(&node->mExtAddressMatchTable[i], aExtAddress, sizeof(otExtAddress)),
+                        error = OT_ERROR_DUPLICATED);
+    }
+
+    node->mExtAddressMatchTable[node->mExtAddressMatchTableCount++] = *aExtAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, const uint16_t aShortAddress)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_NOT_FOUND;
+
+    for (uint8_t i = 0; i < node->mShortAddressMatchTableCount; ++i)
+    {
+        if (node->mShortAddressMatchTable[i] == aShortAddress)
+        {
+            node->mShortAddressMatchTable[i] = node->mShortAddressMatchTable[--node->mShortAddressMatchTableCount];
+            error                            = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_NOT_FOUND;
+
+    for (uint8_t i = 0; i < node->mExtAddressMatchTableCount; ++i)
+    {
+        if (!memcmp(&node->mExtAddressMatchTable[i], aExtAddress, sizeof(otExtAddress)))
+        {
+            node->mExtAddressMatchTable[i] = node->mExtAddressMatchTable[--node->mExtAddressMatchTableCount];
+            error                          = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
+{
+    simulationGetNode(aInstance)->mShortAddressMatchTableCount = 0;
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
+{
+    simulationGetNode(aInstance)->mExtAddressMatchTableCount = 0;
+}
+
+otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    (void)aInstance;
+    (void)aScanChannel;
+    (void)aScanDuration;
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    (void)aInstance;
+    (void)aPower;
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
+{
+    (void)aInstance;
+    (void)aPower;
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
+{
+    (void)aInstance;
+    return SIMULATION_RECEIVE_SENSITIVITY;
+}
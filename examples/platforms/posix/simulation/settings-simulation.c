@@ -0,0 +1,224 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the in-memory settings storage of the in-process simulation platform.
+ *
+ *   Each node keeps its records in its own buffer, so the settings survive a node reset but not the process.
+ */
+
+#include "simulation.h"
+
+#include <string.h>
+
+#include <openthread/platform/settings.h>
+
+#include "utils/code_utils.h"
+
+OT_TOOL_PACKED_BEGIN
+struct settingsRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+} OT_TOOL_PACKED_END;
+
+static uint16_t recordSize(const struct settingsRecord *aRecord)
+{
+    return (uint16_t)(sizeof(struct settingsRecord) + aRecord->mLength);
+}
+
+static struct settingsRecord *findRecord(SimulationNode *aNode, uint16_t aKey, int aIndex, uint16_t *aOffset)
+{
+    struct settingsRecord *record = NULL;
+    uint16_t               offset = 0;
+
+    while (offset < aNode->mSettingsLength)
+    {
+        struct settingsRecord *cur = (struct settingsRecord *)&aNode->mSettings[offset];
+
+        if (cur->mKey == aKey && aIndex-- == 0)
+        {
+            record = cur;
+            break;
+        }
+
+        offset += recordSize(cur);
+    }
+
+    *aOffset = offset;
+
+    return record;
+}
+
+static void removeRecord(SimulationNode *aNode, uint16_t aOffset)
+{
+    uint16_t size = recordSize((struct settingsRecord *)&aNode->mSettings[aOffset]);
+
+    memmove(&aNode->mSettings[aOffset], &aNode->mSettings[aOffset + size],
+            aNode->mSettingsLength - aOffset - size);
+    aNode->mSettingsLength -= size;
+}
+
+void otPlatSettingsInit(otInstance *aInstance)
+{
+    (void)aInstance;
+}
+
+otError otPlatSettingsBeginChange(otInstance *aInstance)
+{
+    (void)aInstance;
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsCommitChange(otInstance *aInstance)
+{
+    (void)aInstance;
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsAbandonChange(otInstance *aInstance)
+{
+    (void)aInstance;
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    otError                error = OT_ERROR_NONE;
+    uint16_t               offset;
+    struct settingsRecord *record = findRecord(simulationGetNode(aInstance), aKey, aIndex, &offset);
+
+    otEXPECT_ACTION(record != NULL, error = OT_ERROR_NOT_FOUND);
+
+    if (aValueLength != NULL)
+    {
+        if (aValue != NULL)
+        {
+            memcpy(aValue, record + 1, (*aValueLength < record->mLength) ? *aValueLength : record->mLength);
+        }
+
+        *aValueLength = record->mLength;
+    }
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsGetAll(otInstance *aInstance,
+                             uint16_t    aKey,
+                             int         aIndex,
+                             uint8_t *   aValues,
+                             uint16_t    aValueSize,
+                             uint16_t *  aNumValues)
+{
+    SimulationNode *node   = simulationGetNode(aInstance);
+    uint16_t        offset = 0;
+    uint16_t        count  = 0;
+
+    otEXPECT(aIndex >= 0);
+
+    while (offset < node->mSettingsLength && count < *aNumValues)
+    {
+        struct settingsRecord *record = (struct settingsRecord *)&node->mSettings[offset];
+
+        if (record->mKey == aKey && aIndex-- <= 0)
+        {
+            uint8_t *value  = aValues + count * aValueSize;
+            uint16_t length = (record->mLength < aValueSize) ? record->mLength : aValueSize;
+
+            memcpy(value, record + 1, length);
+            memset(value + length, 0, aValueSize - length);
+            count++;
+        }
+
+        offset += recordSize(record);
+    }
+
+exit:
+    *aNumValues = count;
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+    uint16_t        offset;
+
+    while (findRecord(node, aKey, 0, &offset) != NULL)
+    {
+        removeRecord(node, offset);
+    }
+
+    return otPlatSettingsAdd(aInstance, aKey, aValue, aValueLength);
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    SimulationNode *       node  = simulationGetNode(aInstance);
+    otError                error = OT_ERROR_NONE;
+    struct settingsRecord *record;
+
+    otEXPECT_ACTION(node->mSettingsLength + sizeof(struct settingsRecord) + aValueLength <= sizeof(node->mSettings),
+                    error = OT_ERROR_NO_BUFS);
+
+    record          = (struct settingsRecord *)&node->mSettings[node->mSettingsLength];
+    record->mKey    = aKey;
+    record->mLength = aValueLength;
+    memcpy(record + 1, aValue, aValueLength);
+    node->mSettingsLength += recordSize(record);
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    SimulationNode *node  = simulationGetNode(aInstance);
+    otError         error = OT_ERROR_NOT_FOUND;
+    uint16_t        offset;
+
+    while (findRecord(node, aKey, (aIndex < 0) ? 0 : aIndex, &offset) != NULL)
+    {
+        removeRecord(node, offset);
+        error = OT_ERROR_NONE;
+
+        if (aIndex >= 0)
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+void otPlatSettingsWipe(otInstance *aInstance)
+{
+    simulationGetNode(aInstance)->mSettingsLength = 0;
+}
@@ -0,0 +1,511 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the node table, the virtual clock and the alarm, random and misc drivers of the
+ *   in-process simulation platform.
+ */
+
+#include "simulation.h"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/logging.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/random.h>
+
+#include "utils/code_utils.h"
+
+#define US_PER_MS 1000
+
+static SimulationNode *    sNodes        = NULL;
+static uint16_t            sNodeCount    = 0;
+static SimulationNode *    sLastNode     = NULL;
+static SimulationNode *    sCurrentNode  = NULL;
+static size_t              sInstanceSize = 0;
+static uint64_t            sNow          = 0; // microseconds
+static uint32_t            sRandomState  = 1;
+static otPlatMcuPowerState sPowerState   = OT_PLAT_MCU_POWER_STATE_ON;
+
+static void nodeStart(SimulationNode *aNode)
+{
+    size_t instanceSize = sInstanceSize;
+
+    aNode->mIsMsRunning  = false;
+    aNode->mIsUsRunning  = false;
+    aNode->mResetPending = false;
+    simulationRadioInit(aNode);
+
+    // The instance is placed at the start of its buffer, so the node is
+    // found by its instance pointer from the first platform call on.
+    aNode->mInstance = otInstanceInit(aNode->mInstance, &instanceSize);
+    assert(aNode->mInstance != NULL);
+}
+
+static void nodeReset(SimulationNode *aNode)
+{
+    otInstanceFinalize(aNode->mInstance);
+    memset(aNode->mInstance, 0, sInstanceSize);
+    nodeStart(aNode);
+}
+
+static uint64_t alarmGetNextEvent(const SimulationNode *aNode)
+{
+    uint64_t next = UINT64_MAX;
+    int32_t  remaining;
+
+    if (aNode->mIsMsRunning)
+    {
+        remaining = (int32_t)(aNode->mMsAlarm - otPlatAlarmMilliGetNow());
+        next      = (remaining <= 0) ? sNow : (sNow / US_PER_MS + (uint64_t)remaining) * US_PER_MS;
+    }
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+
+    if (aNode->mIsUsRunning)
+    {
+        remaining = (int32_t)(aNode->mUsAlarm - otPlatAlarmMicroGetNow());
+
+        if (remaining <= 0)
+        {
+            next = sNow;
+        }
+        else if (sNow + (uint64_t)remaining < next)
+        {
+            next = sNow + (uint64_t)remaining;
+        }
+    }
+
+#endif // OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+
+    return next;
+}
+
+static void alarmProcess(SimulationNode *aNode)
+{
+    if (aNode->mIsMsRunning && (int32_t)(aNode->mMsAlarm - otPlatAlarmMilliGetNow()) <= 0)
+    {
+        aNode->mIsMsRunning = false;
+        otPlatAlarmMilliFired(aNode->mInstance);
+    }
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+
+    if (aNode->mIsUsRunning && (int32_t)(aNode->mUsAlarm - otPlatAlarmMicroGetNow()) <= 0)
+    {
+        aNode->mIsUsRunning = false;
+        otPlatAlarmMicroFired(aNode->mInstance);
+    }
+
+#endif // OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+}
+
+static void processNode(SimulationNode *aNode)
+{
+    sCurrentNode = aNode;
+
+    if (aNode->mResetPending)
+    {
+        nodeReset(aNode);
+    }
+
+    simulationRadioProcess(aNode);
+    alarmProcess(aNode);
+    otTaskletsProcess(aNode->mInstance);
+
+    sCurrentNode = NULL;
+}
+
+static uint64_t getNextEvent(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint64_t event;
+
+    for (uint16_t i = 0; i < sNodeCount; i++)
+    {
+        SimulationNode *node = &sNodes[i];
+
+        if (node->mResetPending || otTaskletsArePending(node->mInstance))
+        {
+            next = sNow;
+            break;
+        }
+
+        event = alarmGetNextEvent(node);
+
+        if (event < next)
+        {
+            next = event;
+        }
+
+        event = simulationRadioGetNextEvent(node);
+
+        if (event < next)
+        {
+            next = event;
+        }
+    }
+
+    return next;
+}
+
+otError simulationInit(uint16_t aNodeCount, uint32_t aSeed)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(sNodes == NULL && aNodeCount > 0 && aNodeCount <= SIMULATION_MAX_NODES,
+                    error = OT_ERROR_INVALID_ARGS);
+
+    sNow         = 0;
+    sRandomState = (aSeed & 0x7fffffff) != 0 ? (aSeed & 0x7fffffff) : 1;
+    sNodes       = (SimulationNode *)calloc(aNodeCount, sizeof(SimulationNode));
+    otEXPECT_ACTION(sNodes != NULL, error = OT_ERROR_NO_BUFS);
+
+    error = simulationTopologyInit(aNodeCount);
+    otEXPECT(error == OT_ERROR_NONE);
+    simulationMediumInit();
+
+    sInstanceSize = 0;
+    (void)otInstanceInit(NULL, &sInstanceSize);
+
+    for (uint16_t i = 0; i < aNodeCount; i++)
+    {
+        SimulationNode *node = &sNodes[i];
+
+        node->mId          = (uint16_t)(i + 1);
+        node->mResetReason = OT_PLAT_RESET_REASON_POWER_ON;
+        node->mInstance    = (otInstance *)calloc(1, sInstanceSize);
+        otEXPECT_ACTION(node->mInstance != NULL, error = OT_ERROR_NO_BUFS);
+
+        sNodeCount   = node->mId;
+        sCurrentNode = node;
+        nodeStart(node);
+        sCurrentNode = NULL;
+    }
+
+exit:
+
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        simulationDeinit();
+    }
+
+    return error;
+}
+
+void simulationDeinit(void)
+{
+    otEXPECT(sNodes != NULL);
+
+    for (uint16_t i = 0; i < sNodeCount; i++)
+    {
+        if (sNodes[i].mInstance != NULL)
+        {
+            otInstanceFinalize(sNodes[i].mInstance);
+            free(sNodes[i].mInstance);
+        }
+    }
+
+    free(sNodes);
+    sNodes     = NULL;
+    sNodeCount = 0;
+    sLastNode  = NULL;
+
+    simulationTopologyDeinit();
+
+exit:
+    return;
+}
+
+uint16_t simulationGetNodeCount(void)
+{
+    return sNodeCount;
+}
+
+otInstance *simulationGetInstance(uint16_t aNodeId)
+{
+    return (aNodeId >= 1 && aNodeId <= sNodeCount) ? sNodes[aNodeId - 1].mInstance : NULL;
+}
+
+SimulationNode *simulationGetNode(otInstance *aInstance)
+{
+    SimulationNode *node = sLastNode;
+
+    if (node == NULL || node->mInstance != aInstance)
+    {
+        for (node = sNodes; node < sNodes + sNodeCount && node->mInstance != aInstance; node++)
+        {
+        }
+
+        assert(node < sNodes + sNodeCount);
+        sLastNode = node;
+    }
+
+    return node;
+}
+
+SimulationNode *simulationGetNodeAt(uint16_t aIndex)
+{
+    return &sNodes[aIndex];
+}
+
+uint64_t simulationGetNow(void)
+{
+    return sNow;
+}
+
+void simulationRun(uint64_t aDuration)
+{
+    (void)simulationRunUntil(aDuration, NULL, NULL);
+}
+
+bool simulationRunUntil(uint64_t aTimeout, simulationCondition aCondition, void *aContext)
+{
+    uint64_t end  = sNow + aTimeout;
+    bool     done = false;
+    uint64_t next;
+
+    for (;;)
+    {
+        for (uint16_t i = 0; i < sNodeCount; i++)
+        {
+            processNode(&sNodes[i]);
+        }
+
+        next = getNextEvent();
+
+        if (next > sNow)
+        {
+            // Every node is idle at the current time: check the stop
+            // condition, then jump straight to the next due event.
+
+            if (aCondition != NULL && aCondition(aContext))
+            {
+                done = true;
+                break;
+            }
+
+            if (next > end)
+            {
+                sNow = end;
+                break;
+            }
+
+            sNow = next;
+        }
+    }
+
+    return done;
+}
+
+//
+// Alarm
+//
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return (uint32_t)(sNow / US_PER_MS);
+}
+
+void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+
+    node->mMsAlarm     = aT0 + aDt;
+    node->mIsMsRunning = true;
+}
+
+void otPlatAlarmMilliStop(otInstance *aInstance)
+{
+    simulationGetNode(aInstance)->mIsMsRunning = false;
+}
+
+uint32_t otPlatAlarmMicroGetNow(void)
+{
+    return (uint32_t)sNow;
+}
+
+void otPlatAlarmMicroStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+
+    node->mUsAlarm     = aT0 + aDt;
+    node->mIsUsRunning = true;
+}
+
+void otPlatAlarmMicroStop(otInstance *aInstance)
+{
+    simulationGetNode(aInstance)->mIsUsRunning = false;
+}
+
+//
+// Random
+//
+
+uint32_t otPlatRandomGet(void)
+{
+    uint32_t mlcg, p, q;
+    uint64_t tmpstate;
+
+    tmpstate = (uint64_t)33614 * (uint64_t)sRandomState;
+    q        = tmpstate & 0xffffffff;
+    q        = q >> 1;
+    p        = tmpstate >> 32;
+    mlcg     = p + q;
+
+    if (mlcg & 0x80000000)
+    {
+        mlcg &= 0x7fffffff;
+        mlcg++;
+    }
+
+    sRandomState = mlcg;
+
+    return mlcg;
+}
+
+otError otPlatRandomGetTrue(uint8_t *aOutput, uint16_t aOutputLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    /*
+     * THE IMPLEMENTATION BELOW IS NOT COMPLIANT WITH THE THREAD SPECIFICATION.
+     *
+     * A simulation run is reproducible from its seed, so the "true" random
+     * values are drawn from the same pseudo-random number generator.
+     */
+    otEXPECT_ACTION(aOutput && aOutputLength, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t length = 0; length < aOutputLength; length++)
+    {
+        aOutput[length] = (uint8_t)otPlatRandomGet();
+    }
+
+exit:
+    return error;
+}
+
+//
+// Misc
+//
+
+void otPlatReset(otInstance *aInstance)
+{
+    SimulationNode *node = simulationGetNode(aInstance);
+
+    // The instance is still on the call stack, it is re-initialized by the
+    // next simulation step.
+    node->mResetPending = true;
+    node->mResetReason  = OT_PLAT_RESET_REASON_SOFTWARE;
+}
+
+otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
+{
+    return simulationGetNode(aInstance)->mResetReason;
+}
+
+void otPlatWakeHost(void)
+{
+}
+
+otError otPlatSetMcuPowerState(otInstance *aInstance, otPlatMcuPowerState aState)
+{
+    otError error = OT_ERROR_NONE;
+
+    (void)aInstance;
+
+    switch (aState)
+    {
+    case OT_PLAT_MCU_POWER_STATE_ON:
+    case OT_PLAT_MCU_POWER_STATE_LOW_POWER:
+        sPowerState = aState;
+        break;
+
+    default:
+        error = OT_ERROR_FAILED;
+        break;
+    }
+
+    return error;
+}
+
+otPlatMcuPowerState otPlatGetMcuPowerState(otInstance *aInstance)
+{
+    (void)aInstance;
+    return sPowerState;
+}
+
+void *otPlatCAlloc(size_t aNum, size_t aSize)
+{
+    return calloc(aNum, aSize);
+}
+
+void otPlatFree(void *aPtr)
+{
+    free(aPtr);
+}
+
+void otTaskletsSignalPending(otInstance *aInstance)
+{
+    // Pending tasklets are polled by `simulationRunUntil()`.
+    (void)aInstance;
+}
+
+//
+// Logging
+//
+
+#if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED) || \
+    (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL)
+OT_TOOL_WEAK void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    va_list args;
+
+    fprintf(stderr, "[%u] %" PRIu64 ".%06u ", sCurrentNode != NULL ? sCurrentNode->mId : 0, sNow / 1000000,
+            (unsigned int)(sNow % 1000000));
+
+    va_start(args, aFormat);
+    vfprintf(stderr, aFormat, args);
+    va_end(args);
+
+    fprintf(stderr, "\n");
+
+    (void)aLogLevel;
+    (void)aLogRegion;
+}
+#endif
@@ -0,0 +1,394 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the in-process multi-node simulation platform definitions.
+ *
+ *   The simulation platform hosts several OpenThread instances in one process. All nodes share a discrete-event
+ *   virtual clock that jumps directly to the next due alarm or radio event, and exchange frames over an in-memory
+ *   radio medium. It requires `OPENTHREAD_ENABLE_MULTIPLE_INSTANCES`.
+ */
+
+#ifndef SIMULATION_H_
+#define SIMULATION_H_
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/radio.h>
+
+#if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+#error "The simulation platform requires OPENTHREAD_ENABLE_MULTIPLE_INSTANCES."
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def SIMULATION_MAX_NODES
+ *
+ * The maximum number of nodes in one simulation.
+ *
+ */
+#ifndef SIMULATION_MAX_NODES
+#define SIMULATION_MAX_NODES 128
+#endif
+
+/**
+ * @def SIMULATION_SETTINGS_SIZE
+ *
+ * The size (in bytes) of the in-memory settings storage of each node.
+ *
+ */
+#ifndef SIMULATION_SETTINGS_SIZE
+#define SIMULATION_SETTINGS_SIZE 4096
+#endif
+
+/**
+ * @def SIMULATION_RECEPTION_QUEUE_SIZE
+ *
+ * The number of frames that may be in flight towards one node, i.e. transmitted but not yet received because of the
+ * propagation delay of their link.
+ *
+ */
+#ifndef SIMULATION_RECEPTION_QUEUE_SIZE
+#define SIMULATION_RECEPTION_QUEUE_SIZE 8
+#endif
+
+enum
+{
+    SIMULATION_MAX_SRC_MATCH_ENTRIES = OPENTHREAD_CONFIG_MAX_CHILDREN,
+};
+
+/**
+ * This enumeration defines the transmit phases of a simulated radio.
+ *
+ */
+typedef enum SimulationTxPhase
+{
+    SIMULATION_TX_IDLE     = 0, ///< No transmission in progress.
+    SIMULATION_TX_START    = 1, ///< `otPlatRadioTransmit()` was called, the frame goes on air at the next step.
+    SIMULATION_TX_ON_AIR   = 2, ///< The frame is on air and is delivered when its airtime elapses.
+    SIMULATION_TX_ACK_WAIT = 3, ///< The frame was delivered and the sender waits for the acknowledgment.
+} SimulationTxPhase;
+
+/**
+ * This structure represents a directed radio link between two nodes.
+ *
+ */
+typedef struct SimulationLink
+{
+    int8_t   mRssi;     ///< The receive signal strength (dBm). Below the receive sensitivity there is no link.
+    uint16_t mLossRate; ///< The frame loss probability, in units of 1/0xffff.
+    uint32_t mDelay;    ///< The propagation delay (microseconds).
+} SimulationLink;
+
+/**
+ * This structure holds the radio medium counters.
+ *
+ */
+typedef struct SimulationCounters
+{
+    uint32_t mTxFrames;       ///< The number of frames put on air (without acknowledgments).
+    uint32_t mTxBytes;        ///< The number of PSDU bytes of the frames put on air.
+    uint32_t mRxFrames;       ///< The number of frames that reached a radio in receive state on the right channel.
+    uint32_t mLostFrames;     ///< The number of frames (and acknowledgments) dropped by the link loss rate.
+    uint32_t mOverflowFrames; ///< The number of frames dropped because a reception queue was full.
+} SimulationCounters;
+
+/**
+ * This structure represents a frame in flight towards a node.
+ *
+ */
+typedef struct SimulationReception
+{
+    uint64_t               mTime;
+    struct SimulationNode *mSender;
+    int8_t                 mRssi;
+    uint8_t                mChannel;
+    uint8_t                mLength;
+    uint8_t                mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+} SimulationReception;
+
+/**
+ * This structure represents the state of a simulated node.
+ *
+ */
+typedef struct SimulationNode
+{
+    otInstance *      mInstance;
+    uint16_t          mId;
+    bool              mResetPending;
+    otPlatResetReason mResetReason;
+
+    bool     mIsMsRunning;
+    uint32_t mMsAlarm;
+    bool     mIsUsRunning;
+    uint32_t mUsAlarm;
+
+    otRadioState      mRadioState;
+    SimulationTxPhase mTxPhase;
+    uint64_t          mTxEventTime;
+    bool              mAckReceived;
+    bool              mPromiscuous;
+    uint16_t          mPanId;
+    uint16_t          mShortAddress;
+    otExtAddress      mExtAddress;
+    otRadioFrame      mReceiveFrame;
+    otRadioFrame      mTransmitFrame;
+    otRadioFrame      mAckFrame;
+    uint8_t           mReceivePsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t           mTransmitPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t           mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
+
+    SimulationReception mReceptions[SIMULATION_RECEPTION_QUEUE_SIZE];
+    uint8_t             mReceptionHead;
+    uint8_t             mReceptionCount;
+
+    bool         mSrcMatchEnabled;
+    uint8_t      mShortAddressMatchTableCount;
+    uint8_t      mExtAddressMatchTableCount;
+    uint16_t     mShortAddressMatchTable[SIMULATION_MAX_SRC_MATCH_ENTRIES];
+    otExtAddress mExtAddressMatchTable[SIMULATION_MAX_SRC_MATCH_ENTRIES];
+
+    uint16_t mSettingsLength;
+    uint8_t  mSettings[SIMULATION_SETTINGS_SIZE];
+} SimulationNode;
+
+/**
+ * This function initializes the simulation and creates @p aNodeCount nodes.
+ *
+ * Nodes are numbered from 1 to @p aNodeCount. The virtual clock starts at zero.
+ *
+ * @param[in]  aNodeCount  The number of nodes.
+ * @param[in]  aSeed       The seed of the pseudo-random number generator shared by all nodes.
+ *
+ * @retval OT_ERROR_NONE          Successfully created all nodes.
+ * @retval OT_ERROR_INVALID_ARGS  @p aNodeCount is zero or larger than `SIMULATION_MAX_NODES`.
+ * @retval OT_ERROR_NO_BUFS       Could not allocate the nodes.
+ *
+ */
+otError simulationInit(uint16_t aNodeCount, uint32_t aSeed);
+
+/**
+ * This function finalizes all nodes and frees the simulation.
+ *
+ */
+void simulationDeinit(void);
+
+/**
+ * This function returns the number of nodes.
+ *
+ * @returns The number of nodes.
+ *
+ */
+uint16_t simulationGetNodeCount(void);
+
+/**
+ * This function returns the OpenThread instance of a node.
+ *
+ * @param[in]  aNodeId  The node ID (1 to the number of nodes).
+ *
+ * @returns A pointer to the OpenThread instance, or NULL if @p aNodeId is not valid.
+ *
+ */
+otInstance *simulationGetInstance(uint16_t aNodeId);
+
+/**
+ * This function returns the current virtual time.
+ *
+ * @returns The current virtual time (microseconds).
+ *
+ */
+uint64_t simulationGetNow(void);
+
+/**
+ * This function pointer is called by `simulationRunUntil()` after each virtual time step.
+ *
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ * @retval TRUE   The condition is satisfied and the simulation should stop.
+ * @retval FALSE  The simulation should continue.
+ *
+ */
+typedef bool (*simulationCondition)(void *aContext);
+
+/**
+ * This function runs the simulation for @p aDuration of virtual time.
+ *
+ * @param[in]  aDuration  The virtual time to run (microseconds).
+ *
+ */
+void simulationRun(uint64_t aDuration);
+
+/**
+ * This function runs the simulation until @p aCondition is satisfied or @p aTimeout of virtual time elapsed.
+ *
+ * @param[in]  aTimeout    The maximum virtual time to run (microseconds).
+ * @param[in]  aCondition  The stop condition, evaluated whenever the virtual clock advances.
+ * @param[in]  aContext    A pointer to application-specific context passed to @p aCondition.
+ *
+ * @retval TRUE   @p aCondition was satisfied.
+ * @retval FALSE  @p aTimeout elapsed first.
+ *
+ */
+bool simulationRunUntil(uint64_t aTimeout, simulationCondition aCondition, void *aContext);
+
+/**
+ * This function sets the directed radio link from one node to another.
+ *
+ * All links default to a loss-free full mesh (RSSI of -20 dBm, no loss, no delay).
+ *
+ * @param[in]  aSrcId  The transmitting node ID, or zero for all nodes.
+ * @param[in]  aDstId  The receiving node ID, or zero for all nodes.
+ * @param[in]  aLink   A pointer to the link parameters.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the link.
+ * @retval OT_ERROR_INVALID_ARGS  A node ID is not valid.
+ *
+ */
+otError simulationSetLink(uint16_t aSrcId, uint16_t aDstId, const SimulationLink *aLink);
+
+/**
+ * This function loads a topology file.
+ *
+ * Each line of the file reads `<src> <dst> <rssi> [<loss-percent> [<delay-us>]]` and sets the directed link from
+ * node `<src>` to node `<dst>`, where `*` stands for all nodes. Empty lines and lines starting with `#` are ignored.
+ * Lines apply in order, so a file typically starts with `* * -128` to remove all links.
+ *
+ * @param[in]  aFileName  The path of the topology file.
+ *
+ * @retval OT_ERROR_NONE          Successfully loaded the topology.
+ * @retval OT_ERROR_NOT_FOUND     Could not open the file.
+ * @retval OT_ERROR_PARSE         A line could not be parsed.
+ * @retval OT_ERROR_INVALID_ARGS  A line refers to a node that does not exist.
+ *
+ */
+otError simulationLoadTopology(const char *aFileName);
+
+/**
+ * This function returns the radio medium counters.
+ *
+ * @returns A pointer to the radio medium counters.
+ *
+ */
+const SimulationCounters *simulationGetCounters(void);
+
+/**
+ * This function returns the node that owns an OpenThread instance.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ * @returns A pointer to the node.
+ *
+ */
+SimulationNode *simulationGetNode(otInstance *aInstance);
+
+/**
+ * This function returns the node at a given index.
+ *
+ * @param[in]  aIndex  The node index (0 to the number of nodes minus one).
+ *
+ * @returns A pointer to the node.
+ *
+ */
+SimulationNode *simulationGetNodeAt(uint16_t aIndex);
+
+/**
+ * This function initializes the topology of @p aNodeCount nodes as a loss-free full mesh.
+ *
+ * @param[in]  aNodeCount  The number of nodes.
+ *
+ * @retval OT_ERROR_NONE     Successfully initialized the topology.
+ * @retval OT_ERROR_NO_BUFS  Could not allocate the link table.
+ *
+ */
+otError simulationTopologyInit(uint16_t aNodeCount);
+
+/**
+ * This function frees the topology.
+ *
+ */
+void simulationTopologyDeinit(void);
+
+/**
+ * This function returns the directed radio link from one node to another.
+ *
+ * @param[in]  aSrc  A pointer to the transmitting node.
+ * @param[in]  aDst  A pointer to the receiving node.
+ *
+ * @returns A pointer to the link parameters.
+ *
+ */
+const SimulationLink *simulationGetLink(const SimulationNode *aSrc, const SimulationNode *aDst);
+
+/**
+ * This function initializes the radio medium.
+ *
+ */
+void simulationMediumInit(void);
+
+/**
+ * This function initializes the radio state of a node.
+ *
+ * @param[in]  aNode  A pointer to the node.
+ *
+ */
+void simulationRadioInit(SimulationNode *aNode);
+
+/**
+ * This function returns the virtual time of the next radio event of a node.
+ *
+ * @param[in]  aNode  A pointer to the node.
+ *
+ * @returns The virtual time of the next radio event, or UINT64_MAX if there is none.
+ *
+ */
+uint64_t simulationRadioGetNextEvent(const SimulationNode *aNode);
+
+/**
+ * This function processes the radio events of a node that are due.
+ *
+ * @param[in]  aNode  A pointer to the node.
+ *
+ */
+void simulationRadioProcess(SimulationNode *aNode);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SIMULATION_H_
@@ -0,0 +1,203 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the link table of the in-process simulation platform.
+ */
+
+#include "simulation.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils/code_utils.h"
+
+enum
+{
+    SIMULATION_DEFAULT_RSSI = -20, // dBm
+    SIMULATION_MAX_LINE     = 256,
+};
+
+static SimulationLink *sLinks     = NULL;
+static uint16_t        sNodeCount = 0;
+
+otError simulationTopologyInit(uint16_t aNodeCount)
+{
+    otError error = OT_ERROR_NONE;
+
+    sLinks = (SimulationLink *)calloc((size_t)aNodeCount * aNodeCount, sizeof(SimulationLink));
+    otEXPECT_ACTION(sLinks != NULL, error = OT_ERROR_NO_BUFS);
+
+    sNodeCount = aNodeCount;
+
+    for (size_t i = 0; i < (size_t)aNodeCount * aNodeCount; i++)
+    {
+        sLinks[i].mRssi = SIMULATION_DEFAULT_RSSI;
+    }
+
+exit:
+    return error;
+}
+
+void simulationTopologyDeinit(void)
+{
+    free(sLinks);
+    sLinks     = NULL;
+    sNodeCount = 0;
+}
+
+const SimulationLink *simulationGetLink(const SimulationNode *aSrc, const SimulationNode *aDst)
+{
+    return &sLinks[(size_t)(aSrc->mId - 1) * sNodeCount + (size_t)(aDst->mId - 1)];
+}
+
+otError simulationSetLink(uint16_t aSrcId, uint16_t aDstId, const SimulationLink *aLink)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aSrcId <= sNodeCount && aDstId <= sNodeCount, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t src = 1; src <= sNodeCount; src++)
+    {
+        if (aSrcId != 0 && aSrcId != src)
+        {
+            continue;
+        }
+
+        for (uint16_t dst = 1; dst <= sNodeCount; dst++)
+        {
+            if ((aDstId == 0 || aDstId == dst) && src != dst)
+            {
+                sLinks[(size_t)(src - 1) * sNodeCount + (size_t)(dst - 1)] = *aLink;
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+static otError parseNodeId(const char *aToken, uint16_t *aNodeId)
+{
+    otError       error = OT_ERROR_NONE;
+    char *        end;
+    unsigned long id;
+
+    otEXPECT_ACTION(aToken != NULL, error = OT_ERROR_PARSE);
+
+    if (strcmp(aToken, "*") == 0)
+    {
+        *aNodeId = 0;
+        goto exit;
+    }
+
+    id = strtoul(aToken, &end, 0);
+    otEXPECT_ACTION(*end == '\0', error = OT_ERROR_PARSE);
+    otEXPECT_ACTION(id >= 1 && id <= sNodeCount, error = OT_ERROR_INVALID_ARGS);
+    *aNodeId = (uint16_t)id;
+
+exit:
+    return error;
+}
+
+static otError parseLine(char *aLine)
+{
+    otError        error      = OT_ERROR_NONE;
+    const char *   delimiters = " \t\r\n";
+    char *         token      = strtok(aLine, delimiters);
+    char *         end;
+    uint16_t       src;
+    uint16_t       dst;
+    long           rssi;
+    double         loss;
+    unsigned long  delay;
+    SimulationLink link;
+
+    otEXPECT(token != NULL && token[0] != '#');
+
+    memset(&link, 0, sizeof(link));
+
+    error = parseNodeId(token, &src);
+    otEXPECT(error == OT_ERROR_NONE);
+    error = parseNodeId(strtok(NULL, delimiters), &dst);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    token = strtok(NULL, delimiters);
+    otEXPECT_ACTION(token != NULL, error = OT_ERROR_PARSE);
+    rssi = strtol(token, &end, 0);
+    otEXPECT_ACTION(*end == '\0' && rssi >= -128 && rssi <= 127, error = OT_ERROR_PARSE);
+    link.mRssi = (int8_t)rssi;
+
+    if ((token = strtok(NULL, delimiters)) != NULL)
+    {
+        loss = strtod(token, &end);
+        otEXPECT_ACTION(*end == '\0' && loss >= 0 && loss <= 100, error = OT_ERROR_PARSE);
+        link.mLossRate = (uint16_t)(loss * 0xffff / 100 + 0.5);
+    }
+
+    if ((token = strtok(NULL, delimiters)) != NULL)
+    {
+        delay = strtoul(token, &end, 0);
+        otEXPECT_ACTION(*end == '\0' && delay <= UINT32_MAX, error = OT_ERROR_PARSE);
+        link.mDelay = (uint32_t)delay;
+    }
+
+    otEXPECT_ACTION(strtok(NULL, delimiters) == NULL, error = OT_ERROR_PARSE);
+
+    error = simulationSetLink(src, dst, &link);
+
+exit:
+    return error;
+}
+
+otError simulationLoadTopology(const char *aFileName)
+{
+    otError error = OT_ERROR_NONE;
+    FILE *  file  = fopen(aFileName, "r");
+    char    line[SIMULATION_MAX_LINE];
+
+    otEXPECT_ACTION(file != NULL, error = OT_ERROR_NOT_FOUND);
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        error = parseLine(line);
+        otEXPECT(error == OT_ERROR_NONE);
+    }
+
+exit:
+
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+
+    return error;
+}
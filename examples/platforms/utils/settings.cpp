@@ -107,26 +107,87 @@ struct settingsBlock
 #define SETTINGS_CONFIG_PAGE_NUM 2
 #endif // SETTINGS_CONFIG_PAGE_NUM
 
-static uint32_t sSettingsBaseAddress;
-static uint32_t sSettingsUsedSize;
+/**
+ * @def SETTINGS_CONFIG_INDEX_SIZE
+ *
+ * The maximum number of valid settings records tracked by the in-RAM index (6 bytes of RAM each).
+ *
+ * When there are more valid records than fit in the index, settings are looked up by scanning the flash until the
+ * next compaction or reboot finds that they fit again.
+ *
+ */
+#ifndef SETTINGS_CONFIG_INDEX_SIZE
+#define SETTINGS_CONFIG_INDEX_SIZE 32
+#endif // SETTINGS_CONFIG_INDEX_SIZE
+
+#if (SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2 \
+                                  : SETTINGS_CONFIG_PAGE_SIZE) > 0x10000
+#error "The settings area must not be larger than 64 KiB."
+#endif
+
+enum
+{
+    kSettingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
+                                                 : SETTINGS_CONFIG_PAGE_SIZE,
+    kSettingsIndexSize = SETTINGS_CONFIG_INDEX_SIZE,
+};
+
+/**
+ * The in-RAM index holds one entry per valid settings record, sorted by key and then by position in the log, so
+ * the Nth value of a key is found with a binary search and read from flash directly. It is only used while it holds
+ * all the valid records (`sSettingsIndexComplete`).
+ *
+ */
+struct settingsIndexEntry
+{
+    uint16_t key;
+    uint16_t length;
+    uint16_t offset; ///< Offset of the settings block from the base address of the settings area in use.
+};
+
+static uint32_t                  sSettingsBaseAddress;
+static uint32_t                  sSettingsUsedSize;
+static uint32_t                  sSettingsErasedSize;
+static struct settingsIndexEntry sSettingsIndex[kSettingsIndexSize];
+static uint16_t                  sSettingsIndexLength;
+static bool                      sSettingsIndexComplete;
+static bool                      sSettingsInChange;
 
 static uint16_t getAlignLength(uint16_t length)
 {
     return (length + 3) & 0xfffc;
 }
 
+static bool isValidBlock(const struct settingsBlock &aBlock)
+{
+    return !(aBlock.flag & kBlockAddCompleteFlag) && (aBlock.flag & kBlockDeleteFlag);
+}
+
+static uint32_t getSwapAddress(void)
+{
+    return (sSettingsBaseAddress == SETTINGS_CONFIG_BASE_ADDRESS) ? (SETTINGS_CONFIG_BASE_ADDRESS + kSettingsSize)
+                                                                  : SETTINGS_CONFIG_BASE_ADDRESS;
+}
+
 static void setSettingsFlag(uint32_t aBase, uint32_t aFlag)
 {
     utilsFlashWrite(aBase, reinterpret_cast<uint8_t *>(&aFlag), sizeof(aFlag));
 }
 
+static void clearBlockFlag(uint16_t aOffset, uint16_t aFlag)
+{
+    struct settingsBlock block;
+
+    utilsFlashRead(sSettingsBaseAddress + aOffset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+    block.flag &= (~aFlag);
+    utilsFlashWrite(sSettingsBaseAddress + aOffset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+}
+
 static void initSettings(uint32_t aBase, uint32_t aFlag)
 {
-    uint32_t address      = aBase;
-    uint32_t settingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
-                                                         : SETTINGS_CONFIG_PAGE_SIZE;
+    uint32_t address = aBase;
 
-    while (address < (aBase + settingsSize))
+    while (address < (aBase + kSettingsSize))
     {
         utilsFlashErasePage(address);
         utilsFlashStatusWait(1000);
@@ -136,79 +197,391 @@ static void initSettings(uint32_t aBase, uint32_t aFlag)
     setSettingsFlag(aBase, aFlag);
 }
 
-static uint32_t swapSettingsBlock(otInstance *aInstance)
+static bool isPageErased(uint32_t aAddress)
 {
-    uint32_t oldBase      = sSettingsBaseAddress;
-    uint32_t swapAddress  = oldBase;
-    uint32_t usedSize     = sSettingsUsedSize;
-    uint8_t  pageNum      = SETTINGS_CONFIG_PAGE_NUM;
-    uint32_t settingsSize = pageNum > 1 ? SETTINGS_CONFIG_PAGE_SIZE * pageNum / 2 : SETTINGS_CONFIG_PAGE_SIZE;
+    bool     erased = true;
+    uint32_t words[8];
 
-    (void)aInstance;
+    for (uint32_t offset = 0; offset < SETTINGS_CONFIG_PAGE_SIZE && erased; offset += sizeof(words))
+    {
+        utilsFlashRead(aAddress + offset, reinterpret_cast<uint8_t *>(words), sizeof(words));
+
+        for (uint8_t i = 0; i < sizeof(words) / sizeof(words[0]) && erased; i++)
+        {
+            erased = (words[i] == 0xffffffff);
+        }
+    }
+
+    return erased;
+}
+
+/**
+ * This function erases the next page of the settings area not in use, so that a later swap does not have to erase
+ * the whole area at once.
+ *
+ */
+static void eraseSwapPage(void)
+{
+    otEXPECT(SETTINGS_CONFIG_PAGE_NUM > 1 && sSettingsErasedSize < kSettingsSize);
 
-    otEXPECT(pageNum > 1);
+    utilsFlashErasePage(getSwapAddress() + sSettingsErasedSize);
+    utilsFlashStatusWait(1000);
+    sSettingsErasedSize += SETTINGS_CONFIG_PAGE_SIZE;
 
-    sSettingsBaseAddress =
-        (swapAddress == SETTINGS_CONFIG_BASE_ADDRESS) ? (swapAddress + settingsSize) : SETTINGS_CONFIG_BASE_ADDRESS;
+exit:
+    return;
+}
 
-    initSettings(sSettingsBaseAddress, static_cast<uint32_t>(kSettingsInSwap));
-    sSettingsUsedSize = kSettingsFlagSize;
-    swapAddress += kSettingsFlagSize;
+// Returns the position of the first index entry with a key not less than aKey.
+static uint16_t findIndexLowerBound(uint16_t aKey)
+{
+    uint16_t low  = 0;
+    uint16_t high = sSettingsIndexLength;
 
-    while (swapAddress < (oldBase + usedSize))
+    while (low < high)
     {
-        OT_TOOL_PACKED_BEGIN
-        struct addSettingsBlock
+        uint16_t middle = low + (high - low) / 2;
+
+        if (sSettingsIndex[middle].key < aKey)
         {
-            struct settingsBlock block;
-            uint8_t              data[kSettingsBlockDataSize];
-        } OT_TOOL_PACKED_END addBlock;
-        bool                 valid = true;
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+// Returns the position following the last index entry with key aKey, starting the search at aPosition.
+static uint16_t findIndexUpperBound(uint16_t aKey, uint16_t aPosition)
+{
+    while (aPosition < sSettingsIndexLength && sSettingsIndex[aPosition].key == aKey)
+    {
+        aPosition++;
+    }
+
+    return aPosition;
+}
+
+static void removeIndexEntries(uint16_t aPosition, uint16_t aCount)
+{
+    memmove(&sSettingsIndex[aPosition], &sSettingsIndex[aPosition + aCount],
+            (sSettingsIndexLength - aPosition - aCount) * sizeof(sSettingsIndex[0]));
+    sSettingsIndexLength -= aCount;
+}
+
+/**
+ * This function adds a valid settings record to the index.
+ *
+ * A record with the index 0 flag starts a new list of values for its key, and replaces the entries already indexed
+ * for the key.
+ *
+ */
+static otError indexSetting(uint16_t aKey, bool aIndex0, uint16_t aLength, uint16_t aOffset)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first = findIndexLowerBound(aKey);
+    uint16_t end   = findIndexUpperBound(aKey, first);
+
+    if (aIndex0)
+    {
+        removeIndexEntries(first, end - first);
+        end = first;
+    }
+
+    otEXPECT_ACTION(sSettingsIndexLength < kSettingsIndexSize, error = OT_ERROR_NO_BUFS);
+
+    memmove(&sSettingsIndex[end + 1], &sSettingsIndex[end], (sSettingsIndexLength - end) * sizeof(sSettingsIndex[0]));
+    sSettingsIndex[end].key    = aKey;
+    sSettingsIndex[end].length = aLength;
+    sSettingsIndex[end].offset = static_cast<uint16_t>(aOffset);
+    sSettingsIndexLength++;
 
-        utilsFlashRead(swapAddress, reinterpret_cast<uint8_t *>(&addBlock.block), sizeof(struct settingsBlock));
-        swapAddress += sizeof(struct settingsBlock);
+exit:
+    return error;
+}
+
+// Returns whether a record starts a new list of values for its key: a complete record with the index 0 flag.
+static bool isListStart(const struct settingsBlock &aBlock)
+{
+    return !(aBlock.flag & kBlockAddCompleteFlag) && !(aBlock.flag & kBlockIndex0Flag);
+}
+
+/**
+ * This function returns the offset of the first record of the current list of values of a key: the last list start
+ * record of the key, or the start of the log.
+ *
+ */
+static uint32_t scanListStart(uint16_t aKey)
+{
+    uint32_t start = kSettingsFlagSize;
 
-        if (!(addBlock.block.flag & kBlockAddCompleteFlag) && (addBlock.block.flag & kBlockDeleteFlag))
+    for (uint32_t offset = kSettingsFlagSize; offset < sSettingsUsedSize;)
+    {
+        struct settingsBlock block;
+
+        utilsFlashRead(sSettingsBaseAddress + offset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+
+        if (block.key == aKey && isListStart(block))
         {
-            uint32_t address = swapAddress + getAlignLength(addBlock.block.length);
+            start = offset;
+        }
 
-            while (address < (oldBase + usedSize))
-            {
-                struct settingsBlock block;
+        offset += getAlignLength(block.length) + sizeof(struct settingsBlock);
+    }
+
+    return start;
+}
+
+/**
+ * This function finds the value at position aIndex in the list of values of a key, with the index if it is complete
+ * or with a single scan of the log otherwise.
+ *
+ */
+static otError findSetting(uint16_t aKey, uint32_t aIndex, uint16_t *aOffset, uint16_t *aLength)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    if (sSettingsIndexComplete)
+    {
+        uint32_t position = static_cast<uint32_t>(findIndexLowerBound(aKey)) + aIndex;
+
+        otEXPECT(position < sSettingsIndexLength && sSettingsIndex[position].key == aKey);
+
+        *aOffset = sSettingsIndex[position].offset;
+        *aLength = sSettingsIndex[position].length;
+        error    = OT_ERROR_NONE;
+    }
+    else
+    {
+        uint32_t index = 0;
+
+        for (uint32_t offset = kSettingsFlagSize; offset < sSettingsUsedSize;)
+        {
+            struct settingsBlock block;
 
-                utilsFlashRead(address, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+            utilsFlashRead(sSettingsBaseAddress + offset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
 
-                if (!(block.flag & kBlockAddCompleteFlag) && (block.flag & kBlockDeleteFlag) &&
-                    !(block.flag & kBlockIndex0Flag) && (block.key == addBlock.block.key))
+            if (block.key == aKey)
+            {
+                // A value found before a later list start is no longer part of the list.
+                if (isListStart(block))
                 {
-                    valid = false;
-                    break;
+                    index = 0;
+                    error = OT_ERROR_NOT_FOUND;
                 }
 
-                address += (getAlignLength(block.length) + sizeof(struct settingsBlock));
+                if (isValidBlock(block))
+                {
+                    if (index == aIndex)
+                    {
+                        *aOffset = static_cast<uint16_t>(offset);
+                        *aLength = block.length;
+                        error    = OT_ERROR_NONE;
+                    }
+
+                    index++;
+                }
             }
 
-            if (valid)
+            offset += getAlignLength(block.length) + sizeof(struct settingsBlock);
+        }
+    }
+
+exit:
+    return error;
+}
+
+/**
+ * This function rebuilds the index and the used size from the log of the settings area in use.
+ *
+ */
+static void loadSettings(void)
+{
+    sSettingsUsedSize      = kSettingsFlagSize;
+    sSettingsIndexLength   = 0;
+    sSettingsIndexComplete = true;
+
+    while (sSettingsUsedSize < kSettingsSize)
+    {
+        struct settingsBlock block;
+
+        utilsFlashRead(sSettingsBaseAddress + sSettingsUsedSize, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+
+        if (!(block.flag & kBlockAddBeginFlag))
+        {
+            bool index0 = !(block.flag & kBlockIndex0Flag);
+
+            if (isValidBlock(block))
             {
-                utilsFlashRead(swapAddress, addBlock.data, getAlignLength(addBlock.block.length));
-                utilsFlashWrite(sSettingsBaseAddress + sSettingsUsedSize, reinterpret_cast<uint8_t *>(&addBlock),
-                                getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock));
-                sSettingsUsedSize += (sizeof(struct settingsBlock) + getAlignLength(addBlock.block.length));
+                if (sSettingsIndexComplete &&
+                    indexSetting(block.key, index0, block.length, static_cast<uint16_t>(sSettingsUsedSize)) !=
+                        OT_ERROR_NONE)
+                {
+                    sSettingsIndexComplete = false;
+                }
+            }
+            else if (index0 && !(block.flag & kBlockAddCompleteFlag))
+            {
+                // A deleted record with the index 0 flag still hides the older values of its key.
+                uint16_t first = findIndexLowerBound(block.key);
+
+                removeIndexEntries(first, findIndexUpperBound(block.key, first) - first);
             }
+
+            sSettingsUsedSize += (getAlignLength(block.length) + sizeof(struct settingsBlock));
         }
-        else if (addBlock.block.flag == 0xff)
+        else
         {
             break;
         }
+    }
+}
+
+/**
+ * This function fills the index with one entry per key holding the offset of the last list start record of the key,
+ * and returns whether all of them fit. It is only used while the index is incomplete, which is rebuilt afterwards.
+ *
+ */
+static bool loadListStarts(void)
+{
+    bool complete = true;
+
+    sSettingsIndexLength = 0;
+
+    for (uint32_t offset = kSettingsFlagSize; offset < sSettingsUsedSize;)
+    {
+        struct settingsBlock block;
+
+        utilsFlashRead(sSettingsBaseAddress + offset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+
+        if (isListStart(block))
+        {
+            uint16_t position = findIndexLowerBound(block.key);
+
+            if (position < sSettingsIndexLength && sSettingsIndex[position].key == block.key)
+            {
+                sSettingsIndex[position].offset = static_cast<uint16_t>(offset);
+            }
+            else if (indexSetting(block.key, false, 0, static_cast<uint16_t>(offset)) != OT_ERROR_NONE)
+            {
+                complete = false;
+            }
+        }
+
+        offset += getAlignLength(block.length) + sizeof(struct settingsBlock);
+    }
+
+    return complete;
+}
+
+// Returns the offset of the current list of values of a key from the entries added by loadListStarts().
+static uint32_t getListStart(uint16_t aKey, bool aListStartsComplete)
+{
+    uint32_t start    = kSettingsFlagSize;
+    uint16_t position = findIndexLowerBound(aKey);
+
+    if (position < sSettingsIndexLength && sSettingsIndex[position].key == aKey)
+    {
+        start = sSettingsIndex[position].offset;
+    }
+    else if (!aListStartsComplete)
+    {
+        start = scanListStart(aKey);
+    }
+
+    return start;
+}
+
+/**
+ * This function moves all valid settings records to the other settings area.
+ *
+ * With a complete index, the records are copied in index order, which keeps the values of each key in order and
+ * needs no rescan of the log. Otherwise, the log is copied in order without the records that are deleted or hidden
+ * by a later record with the index 0 flag, with the list start of each key looked up once before the copy, and the
+ * index is rebuilt from the compacted log. Pages of the other area not yet erased by eraseSwapPage() are erased first.
+ *
+ */
+static uint32_t swapSettingsBlock(otInstance *aInstance)
+{
+    uint32_t oldBase = sSettingsBaseAddress;
+    uint32_t newBase = getSwapAddress();
+    uint32_t newSize = kSettingsFlagSize;
+    OT_TOOL_PACKED_BEGIN
+    struct addSettingsBlock
+    {
+        struct settingsBlock block;
+        uint8_t              data[kSettingsBlockDataSize + 1]; // with room for the alignment padding
+    } OT_TOOL_PACKED_END addBlock;
+
+    (void)aInstance;
+
+    otEXPECT(SETTINGS_CONFIG_PAGE_NUM > 1);
+
+    while (sSettingsErasedSize < kSettingsSize)
+    {
+        eraseSwapPage();
+    }
+
+    setSettingsFlag(newBase, static_cast<uint32_t>(kSettingsInSwap));
+
+    if (sSettingsIndexComplete)
+    {
+        for (uint16_t i = 0; i < sSettingsIndexLength; i++)
+        {
+            struct settingsIndexEntry &entry = sSettingsIndex[i];
+            uint16_t                   size  = sizeof(struct settingsBlock) + getAlignLength(entry.length);
+
+            utilsFlashRead(oldBase + entry.offset, reinterpret_cast<uint8_t *>(&addBlock), size);
+
+            if (i == 0 || sSettingsIndex[i - 1].key != entry.key)
+            {
+                addBlock.block.flag &= (~kBlockIndex0Flag);
+            }
+
+            utilsFlashWrite(newBase + newSize, reinterpret_cast<uint8_t *>(&addBlock), size);
+            entry.offset = static_cast<uint16_t>(newSize);
+            newSize += size;
+        }
+    }
+    else
+    {
+        bool listStartsComplete = loadListStarts();
+
+        for (uint32_t offset = kSettingsFlagSize; offset < sSettingsUsedSize;)
+        {
+            uint16_t size;
 
-        swapAddress += getAlignLength(addBlock.block.length);
+            utilsFlashRead(oldBase + offset, reinterpret_cast<uint8_t *>(&addBlock.block), sizeof(struct settingsBlock));
+            size = sizeof(struct settingsBlock) + getAlignLength(addBlock.block.length);
+
+            if (isValidBlock(addBlock.block) && offset >= getListStart(addBlock.block.key, listStartsComplete))
+            {
+                utilsFlashRead(oldBase + offset, reinterpret_cast<uint8_t *>(&addBlock), size);
+                utilsFlashWrite(newBase + newSize, reinterpret_cast<uint8_t *>(&addBlock), size);
+                newSize += size;
+            }
+
+            offset += size;
+        }
     }
 
-    setSettingsFlag(sSettingsBaseAddress, static_cast<uint32_t>(kSettingsInUse));
+    setSettingsFlag(newBase, static_cast<uint32_t>(kSettingsInUse));
     setSettingsFlag(oldBase, static_cast<uint32_t>(kSettingsNotUse));
+    sSettingsBaseAddress = newBase;
+    sSettingsUsedSize    = newSize;
+    sSettingsErasedSize  = 0;
+
+    if (!sSettingsIndexComplete)
+    {
+        loadSettings();
+    }
 
 exit:
-    return settingsSize - sSettingsUsedSize;
+    return kSettingsSize - sSettingsUsedSize;
 }
 
 static otError addSetting(otInstance *   aInstance,
@@ -224,8 +597,7 @@ static otError addSetting(otInstance *   aInstance,
         struct settingsBlock block;
         uint8_t              data[kSettingsBlockDataSize];
     } OT_TOOL_PACKED_END addBlock;
-    uint32_t settingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
-                                                         : SETTINGS_CONFIG_PAGE_SIZE;
+    uint16_t offset;
 
     addBlock.block.flag = 0xff;
     addBlock.block.key  = aKey;
@@ -238,13 +610,15 @@ static otError addSetting(otInstance *   aInstance,
     addBlock.block.flag &= (~kBlockAddBeginFlag);
     addBlock.block.length = aValueLength;
 
-    if ((sSettingsUsedSize + getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock)) >= settingsSize)
+    if ((sSettingsUsedSize + getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock)) >= kSettingsSize)
     {
         otEXPECT_ACTION(swapSettingsBlock(aInstance) >=
                             (getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock)),
                         error = OT_ERROR_NO_BUFS);
     }
 
+    offset = static_cast<uint16_t>(sSettingsUsedSize);
+
     utilsFlashWrite(sSettingsBaseAddress + sSettingsUsedSize, reinterpret_cast<uint8_t *>(&addBlock.block),
                     sizeof(struct settingsBlock));
 
@@ -259,6 +633,50 @@ static otError addSetting(otInstance *   aInstance,
                     sizeof(struct settingsBlock));
     sSettingsUsedSize += (sizeof(struct settingsBlock) + getAlignLength(addBlock.block.length));
 
+    if (aIndex0)
+    {
+        // The new record replaces the values of the key, delete them now that it is complete so that they are not
+        // resurrected if the new record is deleted later on.
+        if (sSettingsIndexComplete)
+        {
+            uint16_t first = findIndexLowerBound(aKey);
+            uint16_t end   = findIndexUpperBound(aKey, first);
+
+            for (uint16_t i = first; i < end; i++)
+            {
+                clearBlockFlag(sSettingsIndex[i].offset, kBlockDeleteFlag);
+            }
+        }
+        else
+        {
+            for (uint32_t position = kSettingsFlagSize; position < offset;)
+            {
+                struct settingsBlock block;
+
+                utilsFlashRead(sSettingsBaseAddress + position, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+
+                if (block.key == aKey && isValidBlock(block))
+                {
+                    clearBlockFlag(static_cast<uint16_t>(position), kBlockDeleteFlag);
+                }
+
+                position += getAlignLength(block.length) + sizeof(struct settingsBlock);
+            }
+        }
+    }
+
+    if (sSettingsIndexComplete && indexSetting(aKey, aIndex0, aValueLength, offset) != OT_ERROR_NONE)
+    {
+        sSettingsIndexComplete = false;
+    }
+
+    // Within a change, no page of the standby area is erased per write. The commit erases a single page, and any
+    // page still not erased when the settings area fills up is erased by swapSettingsBlock().
+    if (!sSettingsInChange)
+    {
+        eraseSwapPage();
+    }
+
 exit:
     return error;
 }
@@ -266,9 +684,7 @@ exit:
 // settings API
 void otPlatSettingsInit(otInstance *aInstance)
 {
-    uint8_t  index;
-    uint32_t settingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
-                                                         : SETTINGS_CONFIG_PAGE_SIZE;
+    uint8_t index;
 
     (void)aInstance;
 
@@ -280,7 +696,7 @@ void otPlatSettingsInit(otInstance *aInstance)
     {
         uint32_t blockFlag;
 
-        sSettingsBaseAddress += settingsSize * index;
+        sSettingsBaseAddress += kSettingsSize * index;
         utilsFlashRead(sSettingsBaseAddress, reinterpret_cast<uint8_t *>(&blockFlag), sizeof(blockFlag));
 
         if (blockFlag == kSettingsInUse)
@@ -294,100 +710,167 @@ void otPlatSettingsInit(otInstance *aInstance)
         initSettings(sSettingsBaseAddress, static_cast<uint32_t>(kSettingsInUse));
     }
 
-    sSettingsUsedSize = kSettingsFlagSize;
+    loadSettings();
+    sSettingsInChange = false;
 
-    while (sSettingsUsedSize < settingsSize)
-    {
-        struct settingsBlock block;
-
-        utilsFlashRead(sSettingsBaseAddress + sSettingsUsedSize, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+    // The pages of the other area are erased in order, count the ones still erased from an earlier boot.
+    sSettingsErasedSize = 0;
 
-        if (!(block.flag & kBlockAddBeginFlag))
-        {
-            sSettingsUsedSize += (getAlignLength(block.length) + sizeof(struct settingsBlock));
-        }
-        else
-        {
-            break;
-        }
+    while (SETTINGS_CONFIG_PAGE_NUM > 1 && sSettingsErasedSize < kSettingsSize &&
+           isPageErased(getSwapAddress() + sSettingsErasedSize))
+    {
+        sSettingsErasedSize += SETTINGS_CONFIG_PAGE_SIZE;
     }
 }
 
+/**
+ * The records are written to flash as they are changed, a change only skips the erasing of a standby area page after
+ * each write (see addSetting()).
+ *
+ */
 otError otPlatSettingsBeginChange(otInstance *aInstance)
 {
+    otError error = OT_ERROR_NONE;
+
     (void)aInstance;
-    return OT_ERROR_NONE;
+
+    otEXPECT_ACTION(!sSettingsInChange, error = OT_ERROR_ALREADY);
+    sSettingsInChange = true;
+
+exit:
+    return error;
 }
 
 otError otPlatSettingsCommitChange(otInstance *aInstance)
 {
+    otError error = OT_ERROR_NONE;
+
     (void)aInstance;
-    return OT_ERROR_NONE;
+
+    otEXPECT_ACTION(sSettingsInChange, error = OT_ERROR_INVALID_STATE);
+    sSettingsInChange = false;
+    eraseSwapPage();
+
+exit:
+    return error;
 }
 
 otError otPlatSettingsAbandonChange(otInstance *aInstance)
 {
-    (void)aInstance;
-    return OT_ERROR_NONE;
+    return otPlatSettingsCommitChange(aInstance);
 }
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     otError  error       = OT_ERROR_NOT_FOUND;
-    uint32_t address     = sSettingsBaseAddress + kSettingsFlagSize;
     uint16_t valueLength = 0;
-    int      index       = 0;
+    uint16_t offset;
 
     (void)aInstance;
 
-    while (address < (sSettingsBaseAddress + sSettingsUsedSize))
+    otEXPECT(aIndex >= 0);
+    otEXPECT((error = findSetting(aKey, static_cast<uint32_t>(aIndex), &offset, &valueLength)) == OT_ERROR_NONE);
+
+    // only perform read if an input buffer was passed in
+    if (aValue != NULL && aValueLength != NULL)
     {
-        struct settingsBlock block;
+        uint16_t readLength = valueLength;
+
+        // adjust read length if input buffer length is smaller
+        if (readLength > *aValueLength)
+        {
+            readLength = *aValueLength;
+        }
+
+        utilsFlashRead(sSettingsBaseAddress + offset + sizeof(struct settingsBlock), aValue, readLength);
+    }
 
-        utilsFlashRead(address, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+exit:
+
+    if (aValueLength != NULL)
+    {
+        *aValueLength = valueLength;
+    }
+
+    return error;
+}
+
+// Reads a value into a buffer of aValueSize bytes, truncated or padded with zeros.
+static void readValue(uint16_t aOffset, uint16_t aLength, uint8_t *aValue, uint16_t aValueSize)
+{
+    if (aLength > aValueSize)
+    {
+        aLength = aValueSize;
+    }
+
+    utilsFlashRead(sSettingsBaseAddress + aOffset + sizeof(struct settingsBlock), aValue, aLength);
+    memset(aValue + aLength, 0, aValueSize - aLength);
+}
+
+otError otPlatSettingsGetAll(otInstance *aInstance,
+                             uint16_t    aKey,
+                             int         aIndex,
+                             uint8_t *   aValues,
+                             uint16_t    aValueSize,
+                             uint16_t *  aNumValues)
+{
+    uint16_t count = 0;
+
+    (void)aInstance;
+
+    otEXPECT(aIndex >= 0);
+
+    if (sSettingsIndexComplete)
+    {
+        uint32_t position = static_cast<uint32_t>(findIndexLowerBound(aKey)) + static_cast<uint32_t>(aIndex);
 
-        if (block.key == aKey)
+        while (count < *aNumValues && position < sSettingsIndexLength && sSettingsIndex[position].key == aKey)
         {
-            if (!(block.flag & kBlockIndex0Flag))
-            {
-                index = 0;
-            }
+            readValue(sSettingsIndex[position].offset, sSettingsIndex[position].length, aValues + count * aValueSize,
+                      aValueSize);
+            position++;
+            count++;
+        }
+    }
+    else
+    {
+        // The values are read in a single scan of the log, the ones read before a later list start are overwritten.
+        uint32_t index = 0;
 
-            if (!(block.flag & kBlockAddCompleteFlag) && (block.flag & kBlockDeleteFlag))
+        for (uint32_t offset = kSettingsFlagSize; offset < sSettingsUsedSize;)
+        {
+            struct settingsBlock block;
+
+            utilsFlashRead(sSettingsBaseAddress + offset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+
+            if (block.key == aKey)
             {
-                if (index == aIndex)
+                if (isListStart(block))
                 {
-                    uint16_t readLength = block.length;
+                    index = 0;
+                    count = 0;
+                }
 
-                    // only perform read if an input buffer was passed in
-                    if (aValue != NULL && aValueLength != NULL)
+                if (isValidBlock(block))
+                {
+                    if (index >= static_cast<uint32_t>(aIndex) && count < *aNumValues)
                     {
-                        // adjust read length if input buffer length is smaller
-                        if (readLength > *aValueLength)
-                        {
-                            readLength = *aValueLength;
-                        }
-
-                        utilsFlashRead(address + sizeof(struct settingsBlock), aValue, readLength);
+                        readValue(static_cast<uint16_t>(offset), block.length, aValues + count * aValueSize,
+                                  aValueSize);
+                        count++;
                     }
 
-                    valueLength = block.length;
-                    error       = OT_ERROR_NONE;
+                    index++;
                 }
-
-                index++;
             }
-        }
 
-        address += (getAlignLength(block.length) + sizeof(struct settingsBlock));
-    }
-
-    if (aValueLength != NULL)
-    {
-        *aValueLength = valueLength;
+            offset += getAlignLength(block.length) + sizeof(struct settingsBlock);
+        }
     }
 
-    return error;
+exit:
+    *aNumValues = count;
+    return OT_ERROR_NONE;
 }
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
@@ -406,47 +889,57 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
 
 otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
-    otError  error   = OT_ERROR_NOT_FOUND;
-    uint32_t address = sSettingsBaseAddress + kSettingsFlagSize;
-    int      index   = 0;
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint16_t offset;
+    uint16_t length;
 
     (void)aInstance;
 
-    while (address < (sSettingsBaseAddress + sSettingsUsedSize))
+    if (aIndex == -1)
     {
-        struct settingsBlock block;
+        otEXPECT((error = findSetting(aKey, 0, &offset, &length)) == OT_ERROR_NONE);
 
-        utilsFlashRead(address, reinterpret_cast<uint8_t *>(&block), sizeof(block));
-
-        if (block.key == aKey)
+        if (sSettingsIndexComplete)
         {
-            if (!(block.flag & kBlockIndex0Flag))
+            uint16_t first = findIndexLowerBound(aKey);
+            uint16_t end   = findIndexUpperBound(aKey, first);
+
+            for (uint16_t i = first; i < end; i++)
             {
-                index = 0;
+                clearBlockFlag(sSettingsIndex[i].offset, kBlockDeleteFlag);
             }
 
-            if (!(block.flag & kBlockAddCompleteFlag) && (block.flag & kBlockDeleteFlag))
+            removeIndexEntries(first, end - first);
+        }
+        else
+        {
+            do
             {
-                if (aIndex == index || aIndex == -1)
-                {
-                    error = OT_ERROR_NONE;
-                    block.flag &= (~kBlockDeleteFlag);
-                    utilsFlashWrite(address, reinterpret_cast<uint8_t *>(&block), sizeof(block));
-                }
+                clearBlockFlag(offset, kBlockDeleteFlag);
+            } while (findSetting(aKey, 0, &offset, &length) == OT_ERROR_NONE);
+        }
+    }
+    else
+    {
+        uint16_t nextOffset;
 
-                if (index == 1 && aIndex == 0)
-                {
-                    block.flag &= (~kBlockIndex0Flag);
-                    utilsFlashWrite(address, reinterpret_cast<uint8_t *>(&block), sizeof(block));
-                }
+        otEXPECT(aIndex >= 0);
+        otEXPECT((error = findSetting(aKey, static_cast<uint32_t>(aIndex), &offset, &length)) == OT_ERROR_NONE);
 
-                index++;
-            }
+        if (aIndex == 0 && findSetting(aKey, 1, &nextOffset, &length) == OT_ERROR_NONE)
+        {
+            clearBlockFlag(nextOffset, kBlockIndex0Flag);
         }
 
-        address += (getAlignLength(block.length) + sizeof(struct settingsBlock));
+        clearBlockFlag(offset, kBlockDeleteFlag);
+
+        if (sSettingsIndexComplete)
+        {
+            removeIndexEntries(static_cast<uint16_t>(findIndexLowerBound(aKey) + aIndex), 1);
+        }
     }
 
+exit:
     return error;
 }
 
@@ -302,6 +302,40 @@ OTAPI otError OTCALL otCommissionerGeneratePSKc(otInstance *   aInstance,
                                                 const uint8_t *aExtPanId,
                                                 uint8_t *      aPSKc);
 
+/**
+ * This function pointer is called when a PSKc requested with otCommissionerGeneratePSKcAsync() is generated.
+ *
+ * @param[in]  aPSKc     A pointer to the generated PSKc.
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+typedef void(OTCALL *otCommissionerPSKcCallback)(const uint8_t *aPSKc, void *aContext);
+
+/**
+ * This method generates PSKc without blocking.
+ *
+ * The PBKDF2 iterations are run in steps from tasklets, and the callback is called from a tasklet once the PSKc is
+ * generated. Recently generated PSKc values are cached, in which case the callback is called from the next tasklet.
+ *
+ * @param[in]  aInstance     A pointer to an OpenThread instance.
+ * @param[in]  aPassPhrase   The commissioning passphrase.
+ * @param[in]  aNetworkName  The network name for PSKc computation.
+ * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+ * @param[in]  aCallback     A pointer to a function called once the PSKc is generated.
+ * @param[in]  aContext      A pointer to application-specific context.
+ *
+ * @retval OT_ERROR_NONE          Successfully started generating PSKc.
+ * @retval OT_ERROR_INVALID_ARGS  If any of the input arguments is invalid.
+ * @retval OT_ERROR_BUSY          A PSKc is already being generated.
+ *
+ */
+OTAPI otError OTCALL otCommissionerGeneratePSKcAsync(otInstance *               aInstance,
+                                                     const char *               aPassPhrase,
+                                                     const char *               aNetworkName,
+                                                     const uint8_t *            aExtPanId,
+                                                     otCommissionerPSKcCallback aCallback,
+                                                     void *                     aContext);
+
 /**
  * @}
  *
@@ -335,6 +335,31 @@ otLogLevel otGetDynamicLogLevel(otInstance *aInstance);
  */
 otError otSetDynamicLogLevel(otInstance *aInstance, otLogLevel aLogLevel);
 
+/**
+ * This function gets the memory usage report of an OpenThread instance.
+ *
+ * The report gives, for the statically reserved tables and caches, the number of entries in use versus reserved.
+ * Entries which do not apply to the build configuration are reported as empty.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aReport    A pointer to where the memory report is placed.
+ *
+ */
+void otInstanceGetMemoryReport(otInstance *aInstance, otMemoryReport *aReport);
+
+/**
+ * This function returns the memory footprint of the subsystems of an OpenThread instance.
+ *
+ * The footprint is fixed at build time. Entries with a zero `mDepth` are members of the instance, the entries with a
+ * `mDepth` of one that follow an entry are parts of it.
+ *
+ * @param[out]  aNumEntries  A pointer to where the number of entries is placed.
+ *
+ * @returns A pointer to the footprint entries.
+ *
+ */
+const otMemoryFootprintEntry *otInstanceGetFootprint(uint8_t *aNumEntries);
+
 /**
  * @}
  *
@@ -161,6 +161,9 @@ otRadioFrame *otLinkRawGetTransmitBuffer(otInstance *aInstance);
                                     due to activity on the channel.
  *                              OT_ERROR_ABORT when transmission was aborted for other reasons.
  *
+ * The transmit buffer is free again when this function is called, so it may form the next frame and call
+ * otLinkRawTransmit() right away.
+ *
  */
 typedef void (*otLinkRawTransmitDone)(otInstance *  aInstance,
                                       otRadioFrame *aFrame,
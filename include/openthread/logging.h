@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2017, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for run-time control of the logs.
+ */
+
+#ifndef OPENTHREAD_LOGGING_H_
+#define OPENTHREAD_LOGGING_H_
+
+#include "openthread/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-logging
+ *
+ * @brief
+ *   This module includes functions for the per-region dynamic log levels.
+ *
+ *   The log level of each region can only be changed when the dynamic log level feature
+ *   (`OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL`) is enabled. The compile-time log level
+ *   (`OPENTHREAD_CONFIG_LOG_LEVEL`) still bounds which logs are built in.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This function returns the current dynamic log level of a log region.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aLogRegion  The log region.
+ *
+ * @returns The currently set log level of @p aLogRegion.
+ *
+ */
+otLogLevel otLoggingGetLevel(otInstance *aInstance, otLogRegion aLogRegion);
+
+/**
+ * This function sets the dynamic log level of a log region.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aLogRegion  The log region.
+ * @param[in]  aLogLevel   The log level.
+ *
+ * @retval OT_ERROR_NONE               The log level was changed successfully.
+ * @retval OT_ERROR_INVALID_ARGS       @p aLogRegion or @p aLogLevel is not valid.
+ * @retval OT_ERROR_DISABLED_FEATURE   The dynamic log level feature is disabled.
+ *                                     (@sa `OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL` configuration option).
+ *
+ */
+otError otLoggingSetLevel(otInstance *aInstance, otLogRegion aLogRegion, otLogLevel aLogLevel);
+
+/**
+ * This function indicates whether logs of a given level and region are currently enabled.
+ *
+ * The log macros call this function before evaluating their arguments, so that nothing is formatted for a filtered
+ * log.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aLogLevel   The log level.
+ * @param[in]  aLogRegion  The log region.
+ *
+ * @retval TRUE   Logs of @p aLogLevel are enabled in @p aLogRegion.
+ * @retval FALSE  Logs of @p aLogLevel are filtered in @p aLogRegion.
+ *
+ */
+bool otLoggingIsEnabled(otInstance *aInstance, otLogLevel aLogLevel, otLogRegion aLogRegion);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_LOGGING_H_
@@ -316,6 +316,16 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 OTAPI void OTCALL otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Get the 6LoWPAN send queue scheduling counters.
+ *
+ * @param[in]   aInstance  A pointer to the OpenThread instance.
+ *
+ * @returns A pointer to the send queue scheduling counters.
+ *
+ */
+OTAPI const otSendQueueCounters *OTCALL otMessageGetSendQueueCounters(otInstance *aInstance);
+
 /**
  * @}
  *
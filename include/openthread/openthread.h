@@ -65,6 +65,7 @@ extern "C" {
  *
  * @defgroup api-instance Instance
  * @defgroup api-tasklets Tasklets
+ * @defgroup api-logging Logging
  *
  * @}
  *
@@ -91,6 +91,19 @@ void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat
  */
 void otPlatLogv(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list ap);
 
+/**
+ * This function outputs binary log data.
+ *
+ * This function is only used when `OPENTHREAD_CONFIG_LOG_BINARY` is enabled. The data is a chunk of the stream of
+ * binary log records, a record may be split across consecutive calls. The default (weak) implementation passes the
+ * data to `otPlatLog()` as lines of hex digits.
+ *
+ * @param[in]  aData    A pointer to the binary log data.
+ * @param[in]  aLength  The number of bytes in @p aData.
+ *
+ */
+void otPlatLogBinary(const uint8_t *aData, uint16_t aLength);
+
 /**
  * @}
  *
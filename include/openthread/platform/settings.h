@@ -174,6 +174,51 @@ otError otPlatSettingsAbandonChange(otInstance *aInstance);
  */
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength);
 
+/// Fetches consecutive values of a setting
+/** This function fetches the values of the setting identified
+ *  by aKey, starting with the value at aIndex, and writes them
+ *  to the array pointed to by aValues, one value every
+ *  aValueSize bytes. Values longer than aValueSize are
+ *  truncated, shorter values are padded with zeros.
+ *
+ *  This function is meant for list-based settings that are
+ *  read as a whole (e.g. at boot), so that the platform can
+ *  fetch all the values in one pass over its storage instead
+ *  of one `otPlatSettingsGet()` call per value.
+ *
+ *  The implementation of this function is optional. OpenThread
+ *  provides a default implementation which calls
+ *  `otPlatSettingsGet()` for each value.
+ *
+ *  @param[in]     aInstance
+ *                 The OpenThread instance structure.
+ *  @param[in]     aKey
+ *                 The key associated with the requested setting.
+ *  @param[in]     aIndex
+ *                 The index of the first item to get.
+ *  @param[out]    aValues
+ *                 A pointer to an array of *aNumValues entries of
+ *                 aValueSize bytes each.
+ *  @param[in]     aValueSize
+ *                 The size of an entry in aValues.
+ *  @param[inout]  aNumValues
+ *                 A pointer to the number of entries in aValues.
+ *                 At return, the number of values fetched is
+ *                 written, which is smaller than the number of
+ *                 entries when the end of the list is reached.
+ *
+ *  @retval OT_ERROR_NONE
+ *          The values were fetched successfully (possibly none).
+ *  @retval OT_ERROR_NOT_IMPLEMENTED
+ *          The settings are not implemented on this platform.
+ */
+otError otPlatSettingsGetAll(otInstance *aInstance,
+                             uint16_t    aKey,
+                             int         aIndex,
+                             uint8_t *   aValues,
+                             uint16_t    aValueSize,
+                             uint16_t *  aNumValues);
+
 /// Sets or replaces the value of a setting
 /** This function sets or replaces the value of a setting
  *  identified by aKey. If there was more than one
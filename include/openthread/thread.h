@@ -552,6 +552,56 @@ OTAPI otError OTCALL otThreadSendDiagnosticReset(otInstance *        aInstance,
  */
 OTAPI const otIpCounters *OTCALL otThreadGetIp6Counters(otInstance *aInstance);
 
+/**
+ * Get the counters of network information writes to non-volatile storage.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the network information store counters.
+ *
+ */
+OTAPI const otNetworkInfoStoreCounters *OTCALL otThreadGetNetworkInfoStoreCounters(otInstance *aInstance);
+
+/**
+ * Get the counters of the derived key cache.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the key cache counters.
+ *
+ */
+OTAPI const otKeyCacheCounters *OTCALL otThreadGetKeyCacheCounters(otInstance *aInstance);
+
+/**
+ * This function indicates whether or not Network Data deltas are enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns TRUE if Network Data deltas are enabled, FALSE otherwise.
+ *
+ * @sa otThreadSetNetworkDataDeltaEnabled
+ *
+ */
+OTAPI bool OTCALL otThreadIsNetworkDataDeltaEnabled(otInstance *aInstance);
+
+/**
+ * This function enables or disables Network Data deltas.
+ *
+ * When enabled, the device asks for the changes since the version of the Network Data it holds when requesting
+ * Network Data, and routers multicast the changes since the previous version when the Network Data changes.
+ * Network Data deltas are not part of the Thread Specification.
+ *
+ * Routers only send deltas when built with `OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE`. A router multicasts the
+ * full Network Data while a child that is rx-on-when-idle and holds only the stable Network Data is attached.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEnabled   TRUE to enable Network Data deltas, FALSE otherwise.
+ *
+ * @sa otThreadIsNetworkDataDeltaEnabled
+ *
+ */
+OTAPI void OTCALL otThreadSetNetworkDataDeltaEnabled(otInstance *aInstance, bool aEnabled);
+
 /**
  * @}
  *
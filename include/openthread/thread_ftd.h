@@ -178,6 +178,16 @@ OTAPI uint16_t OTCALL otThreadGetJoinerUdpPort(otInstance *aInstance);
  */
 OTAPI otError OTCALL otThreadSetJoinerUdpPort(otInstance *aInstance, uint16_t aJoinerUdpPort);
 
+/**
+ * Get the Joiner Router relay counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Joiner Router relay counters.
+ *
+ */
+OTAPI const otJoinerRouterCounters *OTCALL otThreadGetJoinerRouterCounters(otInstance *aInstance);
+
 /**
  * Set Steering data out of band
  *
@@ -1042,6 +1042,77 @@ typedef struct otIpCounters
     uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
 } otIpCounters;
 
+/**
+ * This structure represents the counters of network information writes to non-volatile storage.
+ *
+ */
+typedef struct otNetworkInfoStoreCounters
+{
+    uint32_t mStores;            ///< The number of network information writes issued to non-volatile storage.
+    uint32_t mCoalescedStores;   ///< The number of store requests merged into an already pending write.
+    uint32_t mSyncStores;        ///< The number of frame counter writes done on the transmit path.
+    uint32_t mFrameCounterAhead; ///< The current window by which stored frame counters lead the used ones.
+} otNetworkInfoStoreCounters;
+
+/**
+ * This structure represents the counters of the derived key cache.
+ *
+ */
+typedef struct otKeyCacheCounters
+{
+    uint32_t mDerivations; ///< The number of key derivations (HMAC-SHA256 computations) performed.
+    uint32_t mHits;        ///< The number of keys served from the derived key cache.
+} otKeyCacheCounters;
+
+/**
+ * This structure represents the Joiner Router relay counters.
+ *
+ * The batch delay is the time the first Joiner datagram of a Relay Receive notification was held for the datagrams
+ * that follow it. The relay latency is the time from sending a Relay Receive notification for a Joiner until the next
+ * Relay Transmit notification for that Joiner is received, which covers the mesh path and the Commissioner.
+ *
+ */
+typedef struct otJoinerRouterCounters
+{
+    uint32_t mRelayRxMessages;      ///< The number of Relay Receive notifications sent.
+    uint32_t mRelayRxDatagrams;     ///< The number of Joiner datagrams sent in Relay Receive notifications.
+    uint32_t mRelayRxDrops;         ///< The number of Joiner datagrams that could not be relayed.
+    uint32_t mRelayTxMessages;      ///< The number of Relay Transmit notifications forwarded to Joiners.
+    uint32_t mJoinersRejected;      ///< The number of datagrams dropped because too many Joiners were being relayed.
+    uint32_t mTotalBatchDelay;      ///< Sum of the batch delays (in milliseconds).
+    uint32_t mMaxBatchDelay;        ///< Maximum batch delay (in milliseconds).
+    uint32_t mRelayLatencySamples;  ///< The number of relay latency samples.
+    uint32_t mTotalRelayLatency;    ///< Sum of the relay latencies (in milliseconds).
+    uint32_t mMaxRelayLatency;      ///< Maximum relay latency (in milliseconds).
+    uint16_t mActiveJoiners;        ///< The number of Joiners being relayed.
+    uint16_t mMaxActiveJoiners;     ///< Maximum number of Joiners relayed at the same time.
+    uint16_t mEntrustQueueDepth;    ///< The number of Joiner Entrust messages waiting to be sent.
+    uint16_t mMaxEntrustQueueDepth; ///< Maximum number of Joiner Entrust messages waiting to be sent.
+} otJoinerRouterCounters;
+
+#define OT_SEND_QUEUE_NUM_PRIORITIES 4 ///< Number of message priority levels in the 6LoWPAN send queue.
+#define OT_SEND_QUEUE_DELAY_BUCKETS 8  ///< Number of buckets in a send queue delay histogram.
+
+/**
+ * This structure represents the 6LoWPAN send queue scheduling counters.
+ *
+ * The queue delay of a message is the time from when the message is queued until its first frame is handed to the
+ * MAC for direct transmission, measured modulo 65536 milliseconds. The upper bounds of the delay histogram buckets are
+ * 5, 10, 50, 100, 500, 1000 and 5000 milliseconds, the last bucket counts all larger delays. Per-priority arrays are
+ * indexed by the message priority level (0 being the highest priority).
+ *
+ */
+typedef struct otSendQueueCounters
+{
+    uint32_t mDirectMessages;     ///< The number of messages whose direct transmission was started.
+    uint32_t mFragmentedMessages; ///< The number of messages sent as more than one fragment.
+    uint32_t mInterleavedFrames;  ///< The number of frames sent while another message was partially sent.
+    uint32_t mTotalDelay;         ///< Sum of the queue delays (in milliseconds).
+    uint32_t mMaxDelay;           ///< Maximum queue delay (in milliseconds).
+    uint32_t mStaleDrops[OT_SEND_QUEUE_NUM_PRIORITIES]; ///< Messages dropped after missing their deadline.
+    uint32_t mDelayHistogram[OT_SEND_QUEUE_NUM_PRIORITIES][OT_SEND_QUEUE_DELAY_BUCKETS]; ///< Queue delay histograms.
+} otSendQueueCounters;
+
 /**
  * This structure represents the message buffer information.
  */
@@ -1069,6 +1140,43 @@ typedef struct otBufferInfo
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
 } otBufferInfo;
 
+/**
+ * This structure represents the usage of a statically reserved memory region (e.g. a table or a cache).
+ *
+ */
+typedef struct otMemoryUsage
+{
+    uint16_t mEntrySize;    ///< The size of an entry (in bytes).
+    uint32_t mUsedEntries;  ///< The number of entries in use.
+    uint32_t mTotalEntries; ///< The number of entries reserved.
+} otMemoryUsage;
+
+/**
+ * This structure represents the memory usage report of an OpenThread instance.
+ *
+ */
+typedef struct otMemoryReport
+{
+    uint32_t      mInstanceSize;        ///< The size of the instance (in bytes).
+    uint32_t      mInstancePadding;     ///< The bytes of the instance not part of any subsystem (e.g. alignment).
+    otMemoryUsage mMessageBuffers;      ///< The message buffer pool.
+    otMemoryUsage mHeap;                ///< The heap (one byte per entry).
+    otMemoryUsage mChildTable;          ///< The child table.
+    otMemoryUsage mEidCache;            ///< The EID-to-RLOC cache.
+    otMemoryUsage mLowpanCompressCache; ///< The 6LoWPAN compressed header cache.
+} otMemoryReport;
+
+/**
+ * This structure represents the size of a subsystem of an OpenThread instance.
+ *
+ */
+typedef struct otMemoryFootprintEntry
+{
+    const char *mName;  ///< The name of the subsystem.
+    uint32_t    mSize;  ///< The size of the subsystem (in bytes).
+    uint8_t     mDepth; ///< Zero for a member of the instance, one for a part of the preceding member.
+} otMemoryFootprintEntry;
+
 /**
  * This structure represents an IPv6 network interface unicast address.
  *
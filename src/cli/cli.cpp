@@ -45,6 +45,7 @@
 #include <openthread/icmp6.h>
 #include <openthread/joiner.h>
 #include <openthread/link.h>
+#include <openthread/logging.h>
 #include <openthread/openthread.h>
 
 #if OPENTHREAD_FTD
@@ -156,10 +157,14 @@ const struct Command Interpreter::sCommands[] = {
     {"leaderpartitionid", &Interpreter::ProcessLeaderPartitionId},
     {"leaderweight", &Interpreter::ProcessLeaderWeight},
 #endif
+    {"log", &Interpreter::ProcessLog},
 #if OPENTHREAD_ENABLE_MAC_FILTER
     {"macfilter", &Interpreter::ProcessMacFilter},
 #endif
     {"masterkey", &Interpreter::ProcessMasterKey},
+#ifndef OTDLL
+    {"memory", &Interpreter::ProcessMemory},
+#endif
     {"mode", &Interpreter::ProcessMode},
 #if OPENTHREAD_FTD
     {"neighbor", &Interpreter::ProcessNeighbor},
@@ -459,6 +464,28 @@ void Interpreter::ProcessBufferInfo(int argc, char *argv[])
     mServer->OutputFormat("application coap: %d %d\r\n", bufferInfo.mApplicationCoapMessages,
                           bufferInfo.mApplicationCoapBuffers);
 
+    {
+        static const char *const kPriorityNames[OT_SEND_QUEUE_NUM_PRIORITIES] = {"high", "med", "low", "vlow"};
+
+        const otSendQueueCounters *counters = otMessageGetSendQueueCounters(mInstance);
+
+        mServer->OutputFormat("6lo sched: %d %d %d %d %d\r\n", counters->mDirectMessages,
+                              counters->mFragmentedMessages, counters->mInterleavedFrames, counters->mTotalDelay,
+                              counters->mMaxDelay);
+
+        for (uint8_t i = 0; i < OT_SEND_QUEUE_NUM_PRIORITIES; i++)
+        {
+            mServer->OutputFormat("6lo delay %s:", kPriorityNames[i]);
+
+            for (uint8_t j = 0; j < OT_SEND_QUEUE_DELAY_BUCKETS; j++)
+            {
+                mServer->OutputFormat(" %d", counters->mDelayHistogram[i][j]);
+            }
+
+            mServer->OutputFormat(" stale %d\r\n", counters->mStaleDrops[i]);
+        }
+    }
+
     AppendResult(OT_ERROR_NONE);
 }
 
@@ -667,7 +694,16 @@ void Interpreter::ProcessCounters(int argc, char *argv[])
 {
     if (argc == 0)
     {
+#if OPENTHREAD_FTD && !defined(OTDLL)
+        mServer->OutputFormat("joiner\r\n");
+#endif
+#ifndef OTDLL
+        mServer->OutputFormat("keycache\r\n");
+#endif
         mServer->OutputFormat("mac\r\n");
+#ifndef OTDLL
+        mServer->OutputFormat("netinfo\r\n");
+#endif
         mServer->OutputFormat("Done\r\n");
     }
     else
@@ -707,6 +743,42 @@ void Interpreter::ProcessCounters(int argc, char *argv[])
             mServer->OutputFormat("    RxErrFcs: %d\r\n", counters->mRxErrFcs);
             mServer->OutputFormat("    RxErrOther: %d\r\n", counters->mRxErrOther);
         }
+#ifndef OTDLL
+        else if (strcmp(argv[0], "keycache") == 0)
+        {
+            const otKeyCacheCounters *counters = otThreadGetKeyCacheCounters(mInstance);
+            mServer->OutputFormat("Derivations: %d\r\n", counters->mDerivations);
+            mServer->OutputFormat("Hits: %d\r\n", counters->mHits);
+        }
+        else if (strcmp(argv[0], "netinfo") == 0)
+        {
+            const otNetworkInfoStoreCounters *counters = otThreadGetNetworkInfoStoreCounters(mInstance);
+            mServer->OutputFormat("Stores: %d\r\n", counters->mStores);
+            mServer->OutputFormat("    CoalescedStores: %d\r\n", counters->mCoalescedStores);
+            mServer->OutputFormat("    SyncStores: %d\r\n", counters->mSyncStores);
+            mServer->OutputFormat("FrameCounterAhead: %d\r\n", counters->mFrameCounterAhead);
+        }
+#endif
+#if OPENTHREAD_FTD && !defined(OTDLL)
+        else if (strcmp(argv[0], "joiner") == 0)
+        {
+            const otJoinerRouterCounters *counters = otThreadGetJoinerRouterCounters(mInstance);
+            mServer->OutputFormat("RelayRx: %d\r\n", counters->mRelayRxMessages);
+            mServer->OutputFormat("    Datagrams: %d\r\n", counters->mRelayRxDatagrams);
+            mServer->OutputFormat("    Drops: %d\r\n", counters->mRelayRxDrops);
+            mServer->OutputFormat("    TotalBatchDelay: %d\r\n", counters->mTotalBatchDelay);
+            mServer->OutputFormat("    MaxBatchDelay: %d\r\n", counters->mMaxBatchDelay);
+            mServer->OutputFormat("RelayTx: %d\r\n", counters->mRelayTxMessages);
+            mServer->OutputFormat("    LatencySamples: %d\r\n", counters->mRelayLatencySamples);
+            mServer->OutputFormat("    TotalLatency: %d\r\n", counters->mTotalRelayLatency);
+            mServer->OutputFormat("    MaxLatency: %d\r\n", counters->mMaxRelayLatency);
+            mServer->OutputFormat("Joiners: %d\r\n", counters->mActiveJoiners);
+            mServer->OutputFormat("    MaxJoiners: %d\r\n", counters->mMaxActiveJoiners);
+            mServer->OutputFormat("    Rejected: %d\r\n", counters->mJoinersRejected);
+            mServer->OutputFormat("EntrustQueue: %d\r\n", counters->mEntrustQueueDepth);
+            mServer->OutputFormat("    MaxEntrustQueue: %d\r\n", counters->mMaxEntrustQueueDepth);
+        }
+#endif
     }
 }
 
@@ -1276,6 +1348,74 @@ exit:
 }
 #endif // OPENTHREAD_FTD
 
+void Interpreter::ProcessLog(int argc, char *argv[])
+{
+    static const struct
+    {
+        const char *mName;
+        otLogRegion mRegion;
+    } kRegions[] = {
+        {"api", OT_LOG_REGION_API},
+        {"mle", OT_LOG_REGION_MLE},
+        {"arp", OT_LOG_REGION_ARP},
+        {"netdata", OT_LOG_REGION_NET_DATA},
+        {"icmp", OT_LOG_REGION_ICMP},
+        {"ip6", OT_LOG_REGION_IP6},
+        {"mac", OT_LOG_REGION_MAC},
+        {"mem", OT_LOG_REGION_MEM},
+        {"ncp", OT_LOG_REGION_NCP},
+        {"meshcop", OT_LOG_REGION_MESH_COP},
+        {"netdiag", OT_LOG_REGION_NET_DIAG},
+        {"platform", OT_LOG_REGION_PLATFORM},
+        {"coap", OT_LOG_REGION_COAP},
+        {"cli", OT_LOG_REGION_CLI},
+        {"core", OT_LOG_REGION_CORE},
+        {"util", OT_LOG_REGION_UTIL},
+    };
+
+    otError error = OT_ERROR_NONE;
+    long    value;
+    size_t  i;
+
+    VerifyOrExit(argc >= 1 && strcmp(argv[0], "level") == 0, error = OT_ERROR_INVALID_ARGS);
+
+    if (argc == 1)
+    {
+        mServer->OutputFormat("%d\r\n", otGetDynamicLogLevel(mInstance));
+        ExitNow();
+    }
+
+    for (i = 0; i < OT_ARRAY_LENGTH(kRegions); i++)
+    {
+        if (strcmp(argv[1], kRegions[i].mName) == 0)
+        {
+            break;
+        }
+    }
+
+    if (i == OT_ARRAY_LENGTH(kRegions))
+    {
+        // `log level <level>` sets the level of all regions.
+        VerifyOrExit(argc == 2, error = OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = ParseLong(argv[1], value));
+        VerifyOrExit(value >= OT_LOG_LEVEL_NONE && value <= OT_LOG_LEVEL_DEBG, error = OT_ERROR_INVALID_ARGS);
+        error = otSetDynamicLogLevel(mInstance, static_cast<otLogLevel>(value));
+    }
+    else if (argc == 2)
+    {
+        mServer->OutputFormat("%d\r\n", otLoggingGetLevel(mInstance, kRegions[i].mRegion));
+    }
+    else
+    {
+        SuccessOrExit(error = ParseLong(argv[2], value));
+        VerifyOrExit(value >= OT_LOG_LEVEL_NONE && value <= OT_LOG_LEVEL_DEBG, error = OT_ERROR_INVALID_ARGS);
+        error = otLoggingSetLevel(mInstance, kRegions[i].mRegion, static_cast<otLogLevel>(value));
+    }
+
+exit:
+    AppendResult(error);
+}
+
 #if OPENTHREAD_FTD
 void Interpreter::ProcessPSKc(int argc, char *argv[])
 {
@@ -1332,6 +1472,41 @@ exit:
     AppendResult(error);
 }
 
+#ifndef OTDLL
+void Interpreter::ProcessMemory(int argc, char *argv[])
+{
+    const otMemoryFootprintEntry *footprint;
+    uint8_t                       numEntries;
+    otMemoryReport                report;
+
+    OT_UNUSED_VARIABLE(argc);
+    OT_UNUSED_VARIABLE(argv);
+
+    footprint = otInstanceGetFootprint(&numEntries);
+    otInstanceGetMemoryReport(mInstance, &report);
+
+    mServer->OutputFormat("instance: %d padding: %d\r\n", report.mInstanceSize, report.mInstancePadding);
+
+    for (uint8_t i = 0; i < numEntries; i++)
+    {
+        mServer->OutputFormat("%s%s: %d\r\n", footprint[i].mDepth ? "  " : "", footprint[i].mName, footprint[i].mSize);
+    }
+
+    OutputMemoryUsage("msgbuf", report.mMessageBuffers);
+    OutputMemoryUsage("heap", report.mHeap);
+    OutputMemoryUsage("child", report.mChildTable);
+    OutputMemoryUsage("eidcache", report.mEidCache);
+    OutputMemoryUsage("6locache", report.mLowpanCompressCache);
+
+    AppendResult(OT_ERROR_NONE);
+}
+
+void Interpreter::OutputMemoryUsage(const char *aName, const otMemoryUsage &aUsage)
+{
+    mServer->OutputFormat("%s: %d/%d x %d\r\n", aName, aUsage.mUsedEntries, aUsage.mTotalEntries, aUsage.mEntrySize);
+}
+#endif // OTDLL
+
 void Interpreter::ProcessMode(int argc, char *argv[])
 {
     otError          error = OT_ERROR_NONE;
@@ -247,7 +247,11 @@ private:
     void ProcessLeaderPartitionId(int argc, char *argv[]);
     void ProcessLeaderWeight(int argc, char *argv[]);
 #endif
+    void ProcessLog(int argc, char *argv[]);
     void ProcessMasterKey(int argc, char *argv[]);
+#ifndef OTDLL
+    void ProcessMemory(int argc, char *argv[]);
+#endif
     void ProcessMode(int argc, char *argv[]);
 #if OPENTHREAD_FTD
     void ProcessNeighbor(int argc, char *argv[]);
@@ -322,6 +326,10 @@ private:
     void ProcessInstance(int argc, char *argv[]);
 #endif
 
+#ifndef OTDLL
+    void OutputMemoryUsage(const char *aName, const otMemoryUsage &aUsage);
+#endif
+
 #ifndef OTDLL
     static void s_HandleIcmpReceive(void *               aContext,
                                     otMessage *          aMessage,
@@ -280,7 +280,8 @@ otError otCommissionerGeneratePSKc(otInstance *   aInstance,
 #if OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER
     Instance &instance = *static_cast<Instance *>(aInstance);
 
-    error = instance.GetThreadNetif().GetCommissioner().GeneratePSKc(aPassPhrase, aNetworkName, aExtPanId, aPSKc);
+    error = instance.GetThreadNetif().GetCommissioner().GetPskcGenerator().Generate(aPassPhrase, aNetworkName,
+                                                                                     aExtPanId, aPSKc);
 #else
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aPassPhrase);
@@ -291,3 +292,29 @@ otError otCommissionerGeneratePSKc(otInstance *   aInstance,
 
     return error;
 }
+
+otError otCommissionerGeneratePSKcAsync(otInstance *               aInstance,
+                                        const char *               aPassPhrase,
+                                        const char *               aNetworkName,
+                                        const uint8_t *            aExtPanId,
+                                        otCommissionerPSKcCallback aCallback,
+                                        void *                     aContext)
+{
+    otError error = OT_ERROR_DISABLED_FEATURE;
+
+#if OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    error = instance.GetThreadNetif().GetCommissioner().GetPskcGenerator().GenerateAsync(
+        aPassPhrase, aNetworkName, aExtPanId, aCallback, aContext);
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aPassPhrase);
+    OT_UNUSED_VARIABLE(aNetworkName);
+    OT_UNUSED_VARIABLE(aExtPanId);
+    OT_UNUSED_VARIABLE(aCallback);
+    OT_UNUSED_VARIABLE(aContext);
+#endif
+
+    return error;
+}
@@ -154,6 +154,18 @@ otError otSetDynamicLogLevel(otInstance *aInstance, otLogLevel aLogLevel)
     return error;
 }
 
+void otInstanceGetMemoryReport(otInstance *aInstance, otMemoryReport *aReport)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetMemoryReport(*aReport);
+}
+
+const otMemoryFootprintEntry *otInstanceGetFootprint(uint8_t *aNumEntries)
+{
+    return Instance::GetFootprint(*aNumEntries);
+}
+
 const char *otGetVersionString(void)
 {
 /**
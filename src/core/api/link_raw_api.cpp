@@ -275,6 +275,11 @@ void LinkRaw::InvokeTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame,
 
     if (mTransmitDoneCallback)
     {
+        // Clear the callback before invoking it, so that the next frame can be submitted from within the callback.
+        otLinkRawTransmitDone callback = mTransmitDoneCallback;
+
+        mTransmitDoneCallback = NULL;
+
         if (aError == OT_ERROR_NONE)
         {
             otLogInfoPlat(&mInstance, "LinkRaw Invoke Transmit Done");
@@ -284,8 +289,7 @@ void LinkRaw::InvokeTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame,
             otLogWarnPlat(&mInstance, "LinkRaw Invoke Transmit Failed (err=0x%x)", aError);
         }
 
-        mTransmitDoneCallback(&mInstance, aFrame, aAckFrame, aError);
-        mTransmitDoneCallback = NULL;
+        callback(&mInstance, aFrame, aAckFrame, aError);
     }
 
 #if OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
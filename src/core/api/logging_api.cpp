@@ -0,0 +1,92 @@
+/*
+ *  Copyright (c) 2017, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread logging API.
+ */
+
+#include "openthread-core-config.h"
+#include "openthread/logging.h"
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+
+using namespace ot;
+
+otLogLevel otLoggingGetLevel(otInstance *aInstance, otLogRegion aLogRegion)
+{
+    otLogLevel logLevel;
+
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    logLevel = instance.GetDynamicLogLevel(aLogRegion);
+#else
+    logLevel = static_cast<otLogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL);
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aLogRegion);
+#endif
+
+    return logLevel;
+}
+
+otError otLoggingSetLevel(otInstance *aInstance, otLogRegion aLogRegion, otLogLevel aLogLevel)
+{
+    otError error = OT_ERROR_NONE;
+
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    VerifyOrExit(aLogRegion >= OT_LOG_REGION_API && aLogRegion <= OT_LOG_REGION_UTIL, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aLogLevel <= OT_LOG_LEVEL_DEBG, error = OT_ERROR_INVALID_ARGS);
+
+    instance.SetDynamicLogLevel(aLogRegion, aLogLevel);
+
+exit:
+#else
+    error = OT_ERROR_DISABLED_FEATURE;
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aLogRegion);
+    OT_UNUSED_VARIABLE(aLogLevel);
+#endif
+
+    return error;
+}
+
+bool otLoggingIsEnabled(otInstance *aInstance, otLogLevel aLogLevel, otLogRegion aLogRegion)
+{
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+    return static_cast<Instance *>(aInstance)->IsDynamicLogEnabled(aLogLevel, aLogRegion);
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    return aLogLevel <= OPENTHREAD_CONFIG_LOG_LEVEL;
+#endif
+}
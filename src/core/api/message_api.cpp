@@ -221,4 +221,11 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+const otSendQueueCounters *otMessageGetSendQueueCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetMeshForwarder().GetSendQueueCounters();
+}
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
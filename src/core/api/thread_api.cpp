@@ -524,3 +524,31 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance)
 
     return &instance.GetThreadNetif().GetMeshForwarder().GetCounters();
 }
+
+const otNetworkInfoStoreCounters *otThreadGetNetworkInfoStoreCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetMle().GetStoreCounters();
+}
+
+const otKeyCacheCounters *otThreadGetKeyCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetKeyManager().GetKeyCacheCounters();
+}
+
+bool otThreadIsNetworkDataDeltaEnabled(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMle().IsNetworkDataDeltaEnabled();
+}
+
+void otThreadSetNetworkDataDeltaEnabled(otInstance *aInstance, bool aEnabled)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetMle().SetNetworkDataDeltaEnabled(aEnabled);
+}
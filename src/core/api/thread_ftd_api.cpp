@@ -122,6 +122,13 @@ otError otThreadSetJoinerUdpPort(otInstance *aInstance, uint16_t aJoinerUdpPort)
     return instance.GetThreadNetif().GetJoinerRouter().SetJoinerUdpPort(aJoinerUdpPort);
 }
 
+const otJoinerRouterCounters *otThreadGetJoinerRouterCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetJoinerRouter().GetCounters();
+}
+
 uint32_t otThreadGetContextIdReuseDelay(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -0,0 +1,542 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary (deferred) log.
+ */
+
+#include "binary_log.hpp"
+
+#include <stddef.h>
+#include "utils/wrap_string.h"
+
+#include <openthread/platform/alarm-milli.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/logging.hpp"
+#include "common/owner-locator.hpp"
+
+const char otLogBinaryFormatAnchor[] = "otLogBinaryFormatAnchor";
+
+namespace ot {
+
+/**
+ * This macro prevents the compiler from moving memory accesses across it, so that a record is completely written
+ * before the write index is published (and completely read before the read index is released).
+ *
+ */
+#if defined(__GNUC__)
+#define BINARY_LOG_COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define BINARY_LOG_COMPILER_BARRIER()
+#endif
+
+const char BinaryLogBuffer::kDumpFormat[] = "[%s len=%03u]%D";
+
+BinaryLogBuffer::RecordWriter::RecordWriter(uint8_t *aRecord, uint16_t aSize)
+    : mRecord(aRecord)
+    , mSize(aSize)
+    , mLength(0)
+{
+}
+
+void BinaryLogBuffer::RecordWriter::WriteUint8(uint8_t aValue)
+{
+    WriteBytes(&aValue, sizeof(aValue));
+}
+
+void BinaryLogBuffer::RecordWriter::WriteUint16(uint16_t aValue)
+{
+    uint8_t bytes[sizeof(uint16_t)];
+
+    for (uint8_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(aValue >> (8 * i));
+    }
+
+    WriteBytes(bytes, sizeof(bytes));
+}
+
+void BinaryLogBuffer::RecordWriter::WriteUint32(uint32_t aValue)
+{
+    uint8_t bytes[sizeof(uint32_t)];
+
+    for (uint8_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(aValue >> (8 * i));
+    }
+
+    WriteBytes(bytes, sizeof(bytes));
+}
+
+void BinaryLogBuffer::RecordWriter::WriteUint64(uint64_t aValue)
+{
+    uint8_t bytes[sizeof(uint64_t)];
+
+    for (uint8_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(aValue >> (8 * i));
+    }
+
+    WriteBytes(bytes, sizeof(bytes));
+}
+
+void BinaryLogBuffer::RecordWriter::WriteBytes(const void *aBuf, uint16_t aLength)
+{
+    // A value which does not fit marks the record as full, so that no
+    // later (smaller) argument gets written out of order.
+
+    if (aLength > GetRemaining())
+    {
+        mLength = mSize;
+        ExitNow();
+    }
+
+    memcpy(mRecord + mLength, aBuf, aLength);
+    mLength += aLength;
+
+exit:
+    return;
+}
+
+void BinaryLogBuffer::RecordWriter::WriteString(const char *aString)
+{
+    const char *string = (aString != NULL) ? aString : "(null)";
+    uint16_t    length = 0;
+
+    VerifyOrExit(GetRemaining() > 0);
+
+    while (length < kMaxStringSize && string[length] != '\0')
+    {
+        length++;
+    }
+
+    if (length >= GetRemaining())
+    {
+        length = GetRemaining() - 1;
+    }
+
+    WriteUint8(static_cast<uint8_t>(length));
+    WriteBytes(string, length);
+
+exit:
+    return;
+}
+
+BinaryLogBuffer::BinaryLogBuffer(uint8_t *aBuffer, uint16_t aBufferSize)
+    : mBuffer(aBuffer)
+    , mBufferSize(aBufferSize)
+    , mReadIndex(0)
+    , mWriteIndex(0)
+    , mDroppedCount(0)
+{
+}
+
+uint32_t BinaryLogBuffer::GetFormatId(const char *aFormat)
+{
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(aFormat) -
+                                 reinterpret_cast<uintptr_t>(otLogBinaryFormatAnchor));
+}
+
+void BinaryLogBuffer::WriteHeader(uint8_t *   aRecord,
+                                  otLogLevel  aLogLevel,
+                                  otLogRegion aLogRegion,
+                                  uint16_t    aArgsLength,
+                                  uint32_t    aTimestamp,
+                                  const char *aFormat)
+{
+    RecordWriter writer(aRecord, kHeaderSize);
+
+    writer.WriteUint8(static_cast<uint8_t>(aLogLevel));
+    writer.WriteUint8(static_cast<uint8_t>(aLogRegion));
+    writer.WriteUint16(aArgsLength);
+    writer.WriteUint32(aTimestamp);
+    writer.WriteUint32(GetFormatId(aFormat));
+}
+
+void BinaryLogBuffer::WriteArgs(RecordWriter &aWriter, const char *aFormat, va_list aArgs)
+{
+    enum Length
+    {
+        kLengthDefault,
+        kLengthLong,
+        kLengthLongLong,
+        kLengthIntMax,
+        kLengthSize,
+        kLengthPtrDiff,
+        kLengthLongDouble,
+    };
+
+    for (const char *cur = aFormat; *cur != '\0'; cur++)
+    {
+        Length length = kLengthDefault;
+
+        if (*cur != '%')
+        {
+            continue;
+        }
+
+        cur++;
+
+        while (*cur == '-' || *cur == '+' || *cur == ' ' || *cur == '#' || *cur == '0')
+        {
+            cur++;
+        }
+
+        while ((*cur >= '0' && *cur <= '9') || *cur == '.' || *cur == '*')
+        {
+            if (*cur == '*')
+            {
+                aWriter.WriteUint32(static_cast<uint32_t>(va_arg(aArgs, int)));
+            }
+
+            cur++;
+        }
+
+        while (*cur == 'h' || *cur == 'l' || *cur == 'j' || *cur == 'z' || *cur == 't' || *cur == 'L')
+        {
+            switch (*cur)
+            {
+            case 'l':
+                length = (length == kLengthLong) ? kLengthLongLong : kLengthLong;
+                break;
+
+            case 'j':
+                length = kLengthIntMax;
+                break;
+
+            case 'z':
+                length = kLengthSize;
+                break;
+
+            case 't':
+                length = kLengthPtrDiff;
+                break;
+
+            case 'L':
+                length = kLengthLongDouble;
+                break;
+
+            default:
+                break;
+            }
+
+            cur++;
+        }
+
+        switch (*cur)
+        {
+        case 'd':
+        case 'i':
+            switch (length)
+            {
+            case kLengthLong:
+                aWriter.WriteUint64(static_cast<uint64_t>(va_arg(aArgs, long)));
+                break;
+
+            case kLengthLongLong:
+                aWriter.WriteUint64(static_cast<uint64_t>(va_arg(aArgs, long long)));
+                break;
+
+            case kLengthIntMax:
+                aWriter.WriteUint64(static_cast<uint64_t>(va_arg(aArgs, intmax_t)));
+                break;
+
+            case kLengthSize:
+                aWriter.WriteUint64(static_cast<uint64_t>(va_arg(aArgs, size_t)));
+                break;
+
+            case kLengthPtrDiff:
+                aWriter.WriteUint64(static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t)));
+                break;
+
+            default:
+                aWriter.WriteUint32(static_cast<uint32_t>(va_arg(aArgs, int)));
+                break;
+            }
+
+            break;
+
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c':
+            switch (length)
+            {
+            case kLengthLong:
+                aWriter.WriteUint64(va_arg(aArgs, unsigned long));
+                break;
+
+            case kLengthLongLong:
+                aWriter.WriteUint64(va_arg(aArgs, unsigned long long));
+                break;
+
+            case kLengthIntMax:
+                aWriter.WriteUint64(va_arg(aArgs, uintmax_t));
+                break;
+
+            case kLengthSize:
+                aWriter.WriteUint64(va_arg(aArgs, size_t));
+                break;
+
+            case kLengthPtrDiff:
+                aWriter.WriteUint64(static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t)));
+                break;
+
+            default:
+                aWriter.WriteUint32(va_arg(aArgs, unsigned int));
+                break;
+            }
+
+            break;
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double   value = (length == kLengthLongDouble) ? static_cast<double>(va_arg(aArgs, long double))
+                                                           : va_arg(aArgs, double);
+            uint64_t bits;
+
+            memcpy(&bits, &value, sizeof(bits));
+            aWriter.WriteUint64(bits);
+            break;
+        }
+
+        case 's':
+            aWriter.WriteString(va_arg(aArgs, const char *));
+            break;
+
+        case 'p':
+            aWriter.WriteUint64(reinterpret_cast<uintptr_t>(va_arg(aArgs, void *)));
+            break;
+
+        case 'n':
+            (void)va_arg(aArgs, void *);
+            break;
+
+        case '\0':
+            ExitNow();
+
+        default:
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+otError BinaryLogBuffer::Append(otLogLevel  aLogLevel,
+                                otLogRegion aLogRegion,
+                                uint32_t    aTimestamp,
+                                const char *aFormat,
+                                va_list     aArgs)
+{
+    uint8_t      record[kMaxRecordSize];
+    RecordWriter writer(record + kHeaderSize, sizeof(record) - kHeaderSize);
+
+    WriteArgs(writer, aFormat, aArgs);
+    WriteHeader(record, aLogLevel, aLogRegion, writer.GetLength(), aTimestamp, aFormat);
+
+    return Write(record, kHeaderSize + writer.GetLength());
+}
+
+otError BinaryLogBuffer::AppendDump(otLogLevel  aLogLevel,
+                                    otLogRegion aLogRegion,
+                                    uint32_t    aTimestamp,
+                                    const char *aId,
+                                    const void *aBuf,
+                                    size_t      aLength)
+{
+    uint8_t      record[kMaxRecordSize];
+    RecordWriter writer(record + kHeaderSize, sizeof(record) - kHeaderSize);
+    uint16_t     length;
+
+    writer.WriteString(aId);
+    writer.WriteUint32(static_cast<uint32_t>(aLength));
+
+    length = (writer.GetRemaining() > sizeof(uint16_t)) ? writer.GetRemaining() - sizeof(uint16_t) : 0;
+
+    if (aLength < length)
+    {
+        length = static_cast<uint16_t>(aLength);
+    }
+
+    writer.WriteUint16(length);
+    writer.WriteBytes(aBuf, length);
+
+    WriteHeader(record, aLogLevel, aLogRegion, writer.GetLength(), aTimestamp, kDumpFormat);
+
+    return Write(record, kHeaderSize + writer.GetLength());
+}
+
+otError BinaryLogBuffer::Write(const uint8_t *aRecord, uint16_t aLength)
+{
+    otError  error      = OT_ERROR_NONE;
+    uint16_t readIndex  = mReadIndex;
+    uint16_t writeIndex = mWriteIndex;
+    uint16_t freeSpace;
+    uint16_t chunk;
+
+    // One byte is always left unused to tell a full buffer from an empty one.
+
+    if (readIndex > writeIndex)
+    {
+        freeSpace = readIndex - writeIndex - 1;
+    }
+    else
+    {
+        freeSpace = mBufferSize - writeIndex + readIndex - 1;
+    }
+
+    if (aLength > freeSpace)
+    {
+        mDroppedCount++;
+        ExitNow(error = OT_ERROR_NO_BUFS);
+    }
+
+    chunk = mBufferSize - writeIndex;
+
+    if (chunk > aLength)
+    {
+        chunk = aLength;
+    }
+
+    memcpy(mBuffer + writeIndex, aRecord, chunk);
+    memcpy(mBuffer, aRecord + chunk, aLength - chunk);
+
+    writeIndex = static_cast<uint16_t>((static_cast<uint32_t>(writeIndex) + aLength) % mBufferSize);
+
+    BINARY_LOG_COMPILER_BARRIER();
+    mWriteIndex = writeIndex;
+
+exit:
+    return error;
+}
+
+const uint8_t *BinaryLogBuffer::GetReadChunk(uint16_t &aLength) const
+{
+    uint16_t readIndex  = mReadIndex;
+    uint16_t writeIndex = mWriteIndex;
+
+    aLength = (writeIndex >= readIndex) ? (writeIndex - readIndex) : (mBufferSize - readIndex);
+
+    BINARY_LOG_COMPILER_BARRIER();
+
+    return mBuffer + readIndex;
+}
+
+void BinaryLogBuffer::Consume(uint16_t aLength)
+{
+    uint16_t readIndex = mReadIndex;
+
+    BINARY_LOG_COMPILER_BARRIER();
+    mReadIndex = static_cast<uint16_t>((static_cast<uint32_t>(readIndex) + aLength) % mBufferSize);
+}
+
+#if OPENTHREAD_CONFIG_LOG_BINARY
+
+BinaryLog::BinaryLog(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mBuffer(mStorage, sizeof(mStorage))
+    , mReportedDroppedCount(0)
+    , mTasklet(aInstance, &BinaryLog::HandleTasklet, this)
+{
+}
+
+void BinaryLog::Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
+{
+    mBuffer.Append(aLogLevel, aLogRegion, otPlatAlarmMilliGetNow(), aFormat, aArgs);
+    mTasklet.Post();
+}
+
+void BinaryLog::Dump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const void *aBuf, size_t aLength)
+{
+    mBuffer.AppendDump(aLogLevel, aLogRegion, otPlatAlarmMilliGetNow(), aId, aBuf, aLength);
+    mTasklet.Post();
+}
+
+void BinaryLog::HandleTasklet(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<BinaryLog>().Flush();
+}
+
+void BinaryLog::Flush(void)
+{
+    uint32_t droppedCount;
+
+    while (!mBuffer.IsEmpty())
+    {
+        uint16_t       length;
+        const uint8_t *chunk = mBuffer.GetReadChunk(length);
+
+        otPlatLogBinary(chunk, length);
+        mBuffer.Consume(length);
+    }
+
+    droppedCount = mBuffer.GetDroppedCount() - mReportedDroppedCount;
+    VerifyOrExit(droppedCount != 0);
+
+    mReportedDroppedCount = mBuffer.GetDroppedCount();
+    otLogBinary(&GetInstance(), OT_LOG_LEVEL_WARN, OT_LOG_REGION_CORE, "Binary log overflow, %u records dropped",
+                static_cast<unsigned int>(droppedCount));
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY
+
+} // namespace ot
+
+#if OPENTHREAD_CONFIG_LOG_BINARY
+
+void otLogBinary(otInstance *aInstance, otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    va_list args;
+
+    VerifyOrExit(aInstance != NULL);
+
+    va_start(args, aFormat);
+    static_cast<ot::Instance *>(aInstance)->GetBinaryLog().Log(aLogLevel, aLogRegion, aFormat, args);
+    va_end(args);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY
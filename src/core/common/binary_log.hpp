@@ -0,0 +1,303 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary (deferred) log.
+ */
+
+#ifndef BINARY_LOG_HPP_
+#define BINARY_LOG_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/types.h>
+#include <openthread/platform/logging.h>
+
+#include "common/locator.hpp"
+#include "common/tasklet.hpp"
+
+/**
+ * The reference point in the firmware image from which the binary log format string identifiers are computed.
+ *
+ */
+extern "C" const char otLogBinaryFormatAnchor[];
+
+namespace ot {
+
+/**
+ * @addtogroup core-logging
+ *
+ * @brief
+ *   This module includes definitions for the binary log.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This class implements a single-producer/single-consumer ring buffer of binary log records.
+ *
+ * Instead of formatting a log message, a record holds the identifier of the format string followed by the raw
+ * arguments, so that the formatting is done later by a host tool. The format string identifier is the offset of the
+ * format string from `otLogBinaryFormatAnchor` in the firmware image (see `GetFormatId()`).
+ *
+ * Each record is encoded (little-endian) as:
+ *
+ *    | Level (1) | Region (1) | Args Length (2) | Timestamp in ms (4) | Format Id (4) | Args ...
+ *
+ * The arguments are encoded following the conversion specifications in the format string:
+ *
+ * - `*` field width or precision and integers without a length modifier (or with `h`/`hh`): 4 bytes.
+ * - Integers with `l`, `ll`, `j`, `z` or `t` length modifiers, `%p` and floating point values: 8 bytes.
+ * - `%s`: one byte length followed by the string characters (no null character).
+ * - `%D` (used only by `AppendDump()`): two bytes length followed by the raw bytes.
+ *
+ * The producer only moves the write index and the consumer only moves the read index, so records can be appended
+ * while the buffer is being drained without any locking.
+ *
+ */
+class BinaryLogBuffer
+{
+public:
+    enum
+    {
+        kHeaderSize    = 12,  ///< Size of a record header (in bytes).
+        kMaxRecordSize = 192, ///< Maximum size of a record (in bytes).
+        kMaxStringSize = 64,  ///< Maximum number of characters encoded for a `%s` argument.
+    };
+
+    /**
+     * This constructor initializes the buffer.
+     *
+     * @param[in]  aBuffer      A pointer to the storage used for the ring buffer.
+     * @param[in]  aBufferSize  The size of @p aBuffer (in bytes).
+     *
+     */
+    BinaryLogBuffer(uint8_t *aBuffer, uint16_t aBufferSize);
+
+    /**
+     * This method appends a log record.
+     *
+     * @param[in]  aLogLevel   The log level.
+     * @param[in]  aLogRegion  The log region.
+     * @param[in]  aTimestamp  The time of the log (in milliseconds).
+     * @param[in]  aFormat     A pointer to the format string.
+     * @param[in]  aArgs       Arguments for the format specification.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the record.
+     * @retval OT_ERROR_NO_BUFS  Insufficient space in the buffer, the record was dropped.
+     *
+     */
+    otError Append(otLogLevel  aLogLevel,
+                   otLogRegion aLogRegion,
+                   uint32_t    aTimestamp,
+                   const char *aFormat,
+                   va_list     aArgs);
+
+    /**
+     * This method appends a record holding a memory dump.
+     *
+     * The dump is truncated when it does not fit in a single record, the record still carries the original length.
+     *
+     * @param[in]  aLogLevel   The log level.
+     * @param[in]  aLogRegion  The log region.
+     * @param[in]  aTimestamp  The time of the log (in milliseconds).
+     * @param[in]  aId         A pointer to a NULL-terminated string describing the dump.
+     * @param[in]  aBuf        A pointer to the bytes to dump.
+     * @param[in]  aLength     Number of bytes to dump.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the record.
+     * @retval OT_ERROR_NO_BUFS  Insufficient space in the buffer, the record was dropped.
+     *
+     */
+    otError AppendDump(otLogLevel  aLogLevel,
+                       otLogRegion aLogRegion,
+                       uint32_t    aTimestamp,
+                       const char *aId,
+                       const void *aBuf,
+                       size_t      aLength);
+
+    /**
+     * This method indicates whether the buffer is empty.
+     *
+     * @retval TRUE   The buffer is empty.
+     * @retval FALSE  The buffer contains at least one record.
+     *
+     */
+    bool IsEmpty(void) const { return mReadIndex == mWriteIndex; }
+
+    /**
+     * This method returns the oldest contiguous chunk of bytes in the buffer.
+     *
+     * A chunk may end in the middle of a record when the record wraps around the end of the ring buffer.
+     *
+     * @param[out]  aLength  A reference to return the number of bytes in the chunk.
+     *
+     * @returns A pointer to the first byte of the chunk.
+     *
+     */
+    const uint8_t *GetReadChunk(uint16_t &aLength) const;
+
+    /**
+     * This method removes bytes from the head of the buffer.
+     *
+     * @param[in]  aLength  Number of bytes to remove (at most the length returned by `GetReadChunk()`).
+     *
+     */
+    void Consume(uint16_t aLength);
+
+    /**
+     * This method returns the number of records dropped due to insufficient space.
+     *
+     * @returns The number of dropped records.
+     *
+     */
+    uint32_t GetDroppedCount(void) const { return mDroppedCount; }
+
+    /**
+     * This static method returns the identifier of a format string.
+     *
+     * @param[in]  aFormat  A pointer to the format string (which must be part of the firmware image).
+     *
+     * @returns The format string identifier.
+     *
+     */
+    static uint32_t GetFormatId(const char *aFormat);
+
+private:
+    class RecordWriter
+    {
+    public:
+        RecordWriter(uint8_t *aRecord, uint16_t aSize);
+
+        void     WriteUint8(uint8_t aValue);
+        void     WriteUint16(uint16_t aValue);
+        void     WriteUint32(uint32_t aValue);
+        void     WriteUint64(uint64_t aValue);
+        void     WriteBytes(const void *aBuf, uint16_t aLength);
+        void     WriteString(const char *aString);
+        uint16_t GetLength(void) const { return mLength; }
+        uint16_t GetRemaining(void) const { return mSize - mLength; }
+
+    private:
+        uint8_t *mRecord;
+        uint16_t mSize;
+        uint16_t mLength;
+    };
+
+    static void WriteHeader(uint8_t *   aRecord,
+                            otLogLevel  aLogLevel,
+                            otLogRegion aLogRegion,
+                            uint16_t    aArgsLength,
+                            uint32_t    aTimestamp,
+                            const char *aFormat);
+    static void WriteArgs(RecordWriter &aWriter, const char *aFormat, va_list aArgs);
+    otError     Write(const uint8_t *aRecord, uint16_t aLength);
+
+    static const char kDumpFormat[];
+
+    uint8_t *         mBuffer;
+    uint16_t          mBufferSize;
+    volatile uint16_t mReadIndex;
+    volatile uint16_t mWriteIndex;
+    uint32_t          mDroppedCount;
+};
+
+#if OPENTHREAD_CONFIG_LOG_BINARY
+
+/**
+ * This class implements the binary log of an OpenThread instance.
+ *
+ * Records are appended to a `BinaryLogBuffer` from the log call sites and drained from a tasklet through
+ * `otPlatLogBinary()`.
+ *
+ */
+class BinaryLog : public InstanceLocator
+{
+public:
+    /**
+     * This constructor initializes the binary log.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit BinaryLog(Instance &aInstance);
+
+    /**
+     * This method appends a log record.
+     *
+     * @param[in]  aLogLevel   The log level.
+     * @param[in]  aLogRegion  The log region.
+     * @param[in]  aFormat     A pointer to the format string.
+     * @param[in]  aArgs       Arguments for the format specification.
+     *
+     */
+    void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs);
+
+    /**
+     * This method appends a memory dump record.
+     *
+     * @param[in]  aLogLevel   The log level.
+     * @param[in]  aLogRegion  The log region.
+     * @param[in]  aId         A pointer to a NULL-terminated string describing the dump.
+     * @param[in]  aBuf        A pointer to the bytes to dump.
+     * @param[in]  aLength     Number of bytes to dump.
+     *
+     */
+    void Dump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const void *aBuf, size_t aLength);
+
+    /**
+     * This method passes all buffered records to `otPlatLogBinary()`.
+     *
+     */
+    void Flush(void);
+
+private:
+    static void HandleTasklet(Tasklet &aTasklet);
+
+    uint8_t         mStorage[OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE];
+    BinaryLogBuffer mBuffer;
+    uint32_t        mReportedDroppedCount;
+    Tasklet         mTasklet;
+};
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // BINARY_LOG_HPP_
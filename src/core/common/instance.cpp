@@ -55,6 +55,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
     , mTimerMicroScheduler(*this)
 #endif
+#if OPENTHREAD_CONFIG_LOG_BINARY
+    , mBinaryLog(*this)
+#endif
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     , mActiveScanCallback(NULL)
     , mActiveScanCallbackContext(NULL)
@@ -81,11 +84,11 @@ Instance::Instance(void)
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     , mLinkRaw(*this)
 #endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
-#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
-    , mLogLevel(static_cast<otLogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL))
-#endif
     , mIsInitialized(false)
 {
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+    SetDynamicLogLevel(static_cast<otLogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL));
+#endif
 }
 
 #if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
@@ -168,6 +171,256 @@ void Instance::AfterInit(void)
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+otLogLevel Instance::GetDynamicLogLevel(void) const
+{
+    otLogLevel logLevel = OT_LOG_LEVEL_DEBG;
+
+    while ((logLevel > OT_LOG_LEVEL_NONE) && (mLogRegionMasks[logLevel - 1] == 0))
+    {
+        logLevel--;
+    }
+
+    return logLevel;
+}
+
+void Instance::SetDynamicLogLevel(otLogLevel aLogLevel)
+{
+    for (uint8_t level = OT_LOG_LEVEL_CRIT; level <= OT_LOG_LEVEL_DEBG; level++)
+    {
+        mLogRegionMasks[level - 1] = (level <= aLogLevel) ? 0xffffffffUL : 0;
+    }
+}
+
+otLogLevel Instance::GetDynamicLogLevel(otLogRegion aLogRegion) const
+{
+    otLogLevel logLevel = OT_LOG_LEVEL_DEBG;
+
+    while ((logLevel > OT_LOG_LEVEL_NONE) && !IsDynamicLogEnabled(logLevel, aLogRegion))
+    {
+        logLevel--;
+    }
+
+    return logLevel;
+}
+
+void Instance::SetDynamicLogLevel(otLogRegion aLogRegion, otLogLevel aLogLevel)
+{
+    for (uint8_t level = OT_LOG_LEVEL_CRIT; level <= OT_LOG_LEVEL_DEBG; level++)
+    {
+        if (level <= aLogLevel)
+        {
+            mLogRegionMasks[level - 1] |= (1UL << aLogRegion);
+        }
+        else
+        {
+            mLogRegionMasks[level - 1] &= ~(1UL << aLogRegion);
+        }
+    }
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+
+// The members of `Instance` in declaration order. `aMember(name, type)` is a member of the instance (a depth 0 entry of
+// `sFootprint`), and `aPart(name, type)` a part of the preceding member (a depth 1 entry). Both `sFootprint` and
+// `InstanceLayout` are generated from this list, so a member is listed only once.
+#define OT_INSTANCE_FOOTPRINT(aMember, aPart)         \
+    aMember(TimerMilliScheduler, TimerMilliScheduler) \
+    OT_FOOTPRINT_TIMER_MICRO(aMember, aPart)          \
+    aMember(TaskletScheduler, TaskletScheduler)       \
+    OT_FOOTPRINT_BINARY_LOG(aMember, aPart)           \
+    OT_FOOTPRINT_THREAD(aMember, aPart)               \
+    OT_FOOTPRINT_LINK_RAW(aMember, aPart)             \
+    OT_FOOTPRINT_LOG_LEVELS(aMember, aPart)
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+#define OT_FOOTPRINT_TIMER_MICRO(aMember, aPart) aMember(TimerMicroScheduler, TimerMicroScheduler)
+#else
+#define OT_FOOTPRINT_TIMER_MICRO(aMember, aPart)
+#endif
+
+#if OPENTHREAD_CONFIG_LOG_BINARY
+#define OT_FOOTPRINT_BINARY_LOG(aMember, aPart) aMember(BinaryLog, BinaryLog)
+#else
+#define OT_FOOTPRINT_BINARY_LOG(aMember, aPart)
+#endif
+
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#define OT_FOOTPRINT_THREAD(aMember, aPart)        \
+    aMember(ScanCallbacks, FootprintScanCallbacks) \
+    aMember(Notifier, Notifier)                    \
+    aMember(Settings, Settings)                    \
+    OT_FOOTPRINT_MBEDTLS_HEAP(aMember, aPart)      \
+    aMember(Ip6, Ip6::Ip6)                         \
+    aMember(ThreadNetif, ThreadNetif)              \
+    aPart(Coap, Coap::Coap)                        \
+    aPart(KeyManager, KeyManager)                  \
+    aPart(Lowpan, Lowpan::Lowpan)                  \
+    aPart(Mac, Mac::Mac)                           \
+    aPart(MeshForwarder, MeshForwarder)            \
+    aPart(Mle, Mle::MleRouter)                     \
+    aPart(NetworkDataLeader, NetworkData::Leader)  \
+    OT_FOOTPRINT_DTLS(aMember, aPart)              \
+    OT_FOOTPRINT_COMMISSIONER(aMember, aPart)      \
+    OT_FOOTPRINT_JOINER(aMember, aPart)            \
+    OT_FOOTPRINT_ADDRESS_RESOLVER(aMember, aPart)  \
+    OT_FOOTPRINT_APPLICATION_COAP(aMember, aPart)  \
+    OT_FOOTPRINT_CHANNEL_MONITOR(aMember, aPart)   \
+    OT_FOOTPRINT_CHANNEL_MANAGER(aMember, aPart)   \
+    OT_FOOTPRINT_ANNOUNCE_SENDER(aMember, aPart)   \
+    aMember(MessagePool, MessagePool)
+
+// The scan callbacks and their contexts, laid out as in `Instance`.
+struct FootprintScanCallbacks
+{
+    otHandleActiveScanResult mActiveScanCallback;
+    void *                   mActiveScanCallbackContext;
+    otHandleEnergyScanResult mEnergyScanCallback;
+    void *                   mEnergyScanCallbackContext;
+};
+
+#if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+#define OT_FOOTPRINT_MBEDTLS_HEAP(aMember, aPart) aMember(MbedTls, Crypto::MbedTls) aMember(Heap, Utils::Heap)
+#else
+#define OT_FOOTPRINT_MBEDTLS_HEAP(aMember, aPart)
+#endif
+
+#if OPENTHREAD_ENABLE_DTLS
+#define OT_FOOTPRINT_DTLS(aMember, aPart) aPart(Dtls, MeshCoP::Dtls) aPart(CoapSecure, Coap::CoapSecure)
+#else
+#define OT_FOOTPRINT_DTLS(aMember, aPart)
+#endif
+
+#if OPENTHREAD_ENABLE_COMMISSIONER && OPENTHREAD_FTD
+#define OT_FOOTPRINT_COMMISSIONER(aMember, aPart) aPart(Commissioner, MeshCoP::Commissioner)
+#else
+#define OT_FOOTPRINT_COMMISSIONER(aMember, aPart)
+#endif
+
+#if OPENTHREAD_ENABLE_JOINER
+#define OT_FOOTPRINT_JOINER(aMember, aPart) aPart(Joiner, MeshCoP::Joiner)
+#else
+#define OT_FOOTPRINT_JOINER(aMember, aPart)
+#endif
+
+#if OPENTHREAD_FTD
+#define OT_FOOTPRINT_ADDRESS_RESOLVER(aMember, aPart) aPart(AddressResolver, AddressResolver)
+#else
+#define OT_FOOTPRINT_ADDRESS_RESOLVER(aMember, aPart)
+#endif
+
+#if OPENTHREAD_ENABLE_APPLICATION_COAP
+#define OT_FOOTPRINT_APPLICATION_COAP(aMember, aPart) aMember(ApplicationCoap, Coap::ApplicationCoap)
+#else
+#define OT_FOOTPRINT_APPLICATION_COAP(aMember, aPart)
+#endif
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR
+#define OT_FOOTPRINT_CHANNEL_MONITOR(aMember, aPart) aMember(ChannelMonitor, Utils::ChannelMonitor)
+#else
+#define OT_FOOTPRINT_CHANNEL_MONITOR(aMember, aPart)
+#endif
+
+#if OPENTHREAD_ENABLE_CHANNEL_MANAGER
+#define OT_FOOTPRINT_CHANNEL_MANAGER(aMember, aPart) aMember(ChannelManager, Utils::ChannelManager)
+#else
+#define OT_FOOTPRINT_CHANNEL_MANAGER(aMember, aPart)
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER
+#define OT_FOOTPRINT_ANNOUNCE_SENDER(aMember, aPart) aMember(AnnounceSender, AnnounceSender)
+#else
+#define OT_FOOTPRINT_ANNOUNCE_SENDER(aMember, aPart)
+#endif
+#else // OPENTHREAD_MTD || OPENTHREAD_FTD
+#define OT_FOOTPRINT_THREAD(aMember, aPart)
+#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+#define OT_FOOTPRINT_LINK_RAW(aMember, aPart) aMember(LinkRaw, LinkRaw)
+#else
+#define OT_FOOTPRINT_LINK_RAW(aMember, aPart)
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+typedef uint32_t FootprintLogLevels[OT_LOG_LEVEL_DEBG];
+#define OT_FOOTPRINT_LOG_LEVELS(aMember, aPart) aMember(LogLevels, FootprintLogLevels)
+#else
+#define OT_FOOTPRINT_LOG_LEVELS(aMember, aPart)
+#endif
+
+#define OT_FOOTPRINT_ENTRY_MEMBER(aName, aType) {#aName, sizeof(aType), 0},
+#define OT_FOOTPRINT_ENTRY_PART(aName, aType) {#aName, sizeof(aType), 1},
+#define OT_FOOTPRINT_LAYOUT_MEMBER(aName, aType) aType m##aName;
+#define OT_FOOTPRINT_LAYOUT_PART(aName, aType)
+
+const otMemoryFootprintEntry Instance::sFootprint[] = {
+    OT_INSTANCE_FOOTPRINT(OT_FOOTPRINT_ENTRY_MEMBER, OT_FOOTPRINT_ENTRY_PART)};
+
+// The members of `Instance` with the same types and in the same order, so with the same size and padding.
+struct InstanceLayout : public otInstance
+{
+    OT_INSTANCE_FOOTPRINT(OT_FOOTPRINT_LAYOUT_MEMBER, OT_FOOTPRINT_LAYOUT_PART)
+    bool mIsInitialized;
+};
+
+// This fails to compile (negative array size) when the members listed in `OT_INSTANCE_FOOTPRINT` differ from those of
+// `Instance`, e.g. when a member is added to `Instance` without a footprint entry.
+typedef char InstanceFootprintCheck[(sizeof(InstanceLayout) == sizeof(Instance)) ? 1 : -1];
+
+#if OPENTHREAD_CONFIG_MAX_INSTANCE_SIZE
+// This fails to compile (negative array size) when the instance does not fit in the configured budget.
+typedef char InstanceSizeCheck[(sizeof(Instance) <= OPENTHREAD_CONFIG_MAX_INSTANCE_SIZE) ? 1 : -1];
+#endif
+
+const otMemoryFootprintEntry *Instance::GetFootprint(uint8_t &aNumEntries)
+{
+    aNumEntries = static_cast<uint8_t>(OT_ARRAY_LENGTH(sFootprint));
+
+    return sFootprint;
+}
+
+void Instance::GetMemoryReport(otMemoryReport &aReport)
+{
+    memset(&aReport, 0, sizeof(aReport));
+
+    aReport.mInstanceSize    = sizeof(Instance);
+    aReport.mInstancePadding = sizeof(Instance);
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(sFootprint); i++)
+    {
+        if (sFootprint[i].mDepth == 0)
+        {
+            aReport.mInstancePadding -= sFootprint[i].mSize;
+        }
+    }
+
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    aReport.mMessageBuffers.mEntrySize    = sizeof(Buffer);
+    aReport.mMessageBuffers.mTotalEntries = kNumBuffers;
+    aReport.mMessageBuffers.mUsedEntries  = kNumBuffers - mMessagePool.GetFreeBufferCount();
+
+#if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    aReport.mHeap.mEntrySize    = 1;
+    aReport.mHeap.mTotalEntries = static_cast<uint32_t>(mHeap.GetCapacity());
+    aReport.mHeap.mUsedEntries  = static_cast<uint32_t>(mHeap.GetCapacity() - mHeap.GetFreeSize());
+#endif
+
+#if OPENTHREAD_FTD
+    {
+        ChildTable &childTable = mThreadNetif.GetMle().GetChildTable();
+
+        aReport.mChildTable.mEntrySize    = sizeof(Child);
+        aReport.mChildTable.mTotalEntries = childTable.GetMaxChildren();
+        aReport.mChildTable.mUsedEntries  = childTable.GetNumChildren(ChildTable::kInStateAnyExceptInvalid);
+    }
+
+    mThreadNetif.GetAddressResolver().GetCacheUsage(aReport.mEidCache);
+#endif
+
+    mThreadNetif.GetLowpan().GetCompressCacheUsage(aReport.mLowpanCompressCache);
+#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+}
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 void Instance::Finalize(void)
 {
@@ -280,6 +533,11 @@ template <> KeyManager &Instance::Get(void)
     return GetThreadNetif().GetKeyManager();
 }
 
+template <> Lowpan::Lowpan &Instance::Get(void)
+{
+    return GetThreadNetif().GetLowpan();
+}
+
 #if OPENTHREAD_FTD
 template <> AddressResolver &Instance::Get(void)
 {
@@ -354,6 +612,11 @@ template <> MeshCoP::Commissioner &Instance::Get(void)
 {
     return GetThreadNetif().GetCommissioner();
 }
+
+template <> MeshCoP::PskcGenerator &Instance::Get(void)
+{
+    return GetThreadNetif().GetCommissioner().GetPskcGenerator();
+}
 #endif
 
 #if OPENTHREAD_ENABLE_JOINER
@@ -441,4 +704,11 @@ template <> TaskletScheduler &Instance::Get(void)
     return GetTaskletScheduler();
 }
 
+#if OPENTHREAD_CONFIG_LOG_BINARY
+template <> BinaryLog &Instance::Get(void)
+{
+    return GetBinaryLog();
+}
+#endif
+
 } // namespace ot
@@ -42,6 +42,8 @@
 #include <openthread/types.h>
 #include <openthread/platform/logging.h>
 
+#include "common/binary_log.hpp"
+
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
 #include "api/link_raw.hpp"
 #include "common/message.hpp"
@@ -176,22 +178,87 @@ public:
      */
     TaskletScheduler &GetTaskletScheduler(void) { return mTaskletScheduler; }
 
+#if OPENTHREAD_CONFIG_LOG_BINARY
+    /**
+     * This method returns a reference to the binary log object.
+     *
+     * @returns A reference to the binary log object.
+     *
+     */
+    BinaryLog &GetBinaryLog(void) { return mBinaryLog; }
+#endif
+
+    /**
+     * This method gets the memory usage report of the instance.
+     *
+     * @param[out]  aReport  A reference to where the memory report is placed.
+     *
+     */
+    void GetMemoryReport(otMemoryReport &aReport);
+
+    /**
+     * This static method returns the memory footprint of the subsystems of the instance.
+     *
+     * @param[out]  aNumEntries  A reference to where the number of entries is placed.
+     *
+     * @returns A pointer to the footprint entries.
+     *
+     */
+    static const otMemoryFootprintEntry *GetFootprint(uint8_t &aNumEntries);
+
 #if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
     /**
      * This method returns the current dynamic log level.
      *
+     * With per-region log levels, this is the highest level enabled in any region.
+     *
      * @returns the currently set dynamic log level.
      *
      */
-    otLogLevel GetDynamicLogLevel(void) const { return mLogLevel; }
+    otLogLevel GetDynamicLogLevel(void) const;
 
     /**
-     * This method sets the dynamic log level.
+     * This method sets the dynamic log level of all regions.
      *
      * @param[in]  aLogLevel The dynamic log level.
      *
      */
-    void SetDynamicLogLevel(otLogLevel aLogLevel) { mLogLevel = aLogLevel; }
+    void SetDynamicLogLevel(otLogLevel aLogLevel);
+
+    /**
+     * This method returns the current dynamic log level of a region.
+     *
+     * @param[in]  aLogRegion  The log region.
+     *
+     * @returns the currently set dynamic log level of @p aLogRegion.
+     *
+     */
+    otLogLevel GetDynamicLogLevel(otLogRegion aLogRegion) const;
+
+    /**
+     * This method sets the dynamic log level of a region.
+     *
+     * @param[in]  aLogRegion  The log region.
+     * @param[in]  aLogLevel   The dynamic log level.
+     *
+     */
+    void SetDynamicLogLevel(otLogRegion aLogRegion, otLogLevel aLogLevel);
+
+    /**
+     * This method indicates whether logs of a given level and region are enabled.
+     *
+     * @param[in]  aLogLevel   The log level.
+     * @param[in]  aLogRegion  The log region.
+     *
+     * @retval TRUE   Logs of @p aLogLevel are enabled in @p aLogRegion.
+     * @retval FALSE  Logs of @p aLogLevel are filtered in @p aLogRegion.
+     *
+     */
+    bool IsDynamicLogEnabled(otLogLevel aLogLevel, otLogRegion aLogRegion) const
+    {
+        return (aLogLevel == OT_LOG_LEVEL_NONE) ||
+               ((aLogLevel <= OT_LOG_LEVEL_DEBG) && (mLogRegionMasks[aLogLevel - 1] & (1UL << aLogRegion)) != 0);
+    }
 #endif
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -380,11 +447,16 @@ private:
     Instance(void);
     void AfterInit(void);
 
+    static const otMemoryFootprintEntry sFootprint[];
+
     TimerMilliScheduler mTimerMilliScheduler;
 #if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
     TimerMicroScheduler mTimerMicroScheduler;
 #endif
     TaskletScheduler mTaskletScheduler;
+#if OPENTHREAD_CONFIG_LOG_BINARY
+    BinaryLog mBinaryLog;
+#endif
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otHandleActiveScanResult mActiveScanCallback;
@@ -425,7 +497,8 @@ private:
     LinkRaw mLinkRaw;
 #endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
 #if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
-    otLogLevel mLogLevel;
+    // Bit `region` of `mLogRegionMasks[level - 1]` is set when `level` is enabled in `region`.
+    uint32_t mLogRegionMasks[OT_LOG_LEVEL_DEBG];
 #endif
     bool mIsInitialized;
 };
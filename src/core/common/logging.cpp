@@ -37,6 +37,7 @@
 
 #include <openthread/openthread.h>
 
+#include "common/code_utils.hpp"
 #include "common/instance.hpp"
 
 /*
@@ -57,7 +58,23 @@
 extern "C" {
 #endif
 
-#if OPENTHREAD_CONFIG_LOG_PKT_DUMP == 1
+#if (OPENTHREAD_CONFIG_LOG_PKT_DUMP == 1) && OPENTHREAD_CONFIG_LOG_BINARY
+void otDump(otInstance * aInstance,
+            otLogLevel   aLogLevel,
+            otLogRegion  aLogRegion,
+            const char * aId,
+            const void * aBuf,
+            const size_t aLength)
+{
+    VerifyOrExit(aInstance != NULL);
+    VerifyOrExit(otLoggingIsEnabled(aInstance, aLogLevel, aLogRegion));
+
+    static_cast<ot::Instance *>(aInstance)->GetBinaryLog().Dump(aLogLevel, aLogRegion, aId, aBuf, aLength);
+
+exit:
+    return;
+}
+#elif OPENTHREAD_CONFIG_LOG_PKT_DUMP == 1
 /**
  * This static method outputs a line of the memory dump.
  *
@@ -135,6 +152,8 @@ void otDump(otInstance * aInstance,
     char         buf[80];
     char *       cur = buf;
 
+    VerifyOrExit(otLoggingIsEnabled(aInstance, aLogLevel, aLogRegion));
+
     for (size_t i = 0; i < (width - idlen) / 2 - 5; i++)
     {
         snprintf(cur, sizeof(buf) - static_cast<size_t>(cur - buf), "=");
@@ -166,6 +185,9 @@ void otDump(otInstance * aInstance,
     }
 
     otLogDump("%s", buf);
+
+exit:
+    return;
 }
 #else  // OPENTHREAD_CONFIG_LOG_PKT_DUMP
 void otDump(otInstance *, otLogLevel, otLogRegion, const char *, const void *, const size_t)
@@ -337,6 +359,30 @@ void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat
 }
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_BINARY
+/* by default, binary log data is passed to `otPlatLog()` as lines of hex digits */
+OT_TOOL_WEAK void otPlatLogBinary(const uint8_t *aData, uint16_t aLength)
+{
+    const uint16_t kBytesPerLine = 32;
+    char           hex[2 * kBytesPerLine + 1];
+
+    while (aLength > 0)
+    {
+        uint16_t length = (aLength < kBytesPerLine) ? aLength : kBytesPerLine;
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            snprintf(&hex[2 * i], sizeof(hex) - 2 * i, "%02x", aData[i]);
+        }
+
+        otPlatLog(OT_LOG_LEVEL_CRIT, OT_LOG_REGION_CORE, "[BIN] %s", hex);
+
+        aData += length;
+        aLength -= length;
+    }
+}
+#endif
+
 #ifdef __cplusplus
 };
 #endif
@@ -41,6 +41,7 @@
 #include "utils/wrap_string.h"
 
 #include <openthread/instance.h>
+#include <openthread/logging.h>
 #include <openthread/types.h>
 #include <openthread/platform/logging.h>
 
@@ -1725,22 +1726,60 @@ void otDump(otInstance * aIntsance,
 #if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL == 1
 
 /**
- * Local/private macro to dynamically filter log level.
+ * Local/private macro to dynamically filter log level and region.
+ *
+ * The filter is checked before the arguments are evaluated, so no formatting helper is called for a filtered log.
  */
-#define _otDynamicLog(aInstance, aLogLevel, aRegion, aFormat, ...)  \
-    do                                                              \
-    {                                                               \
-        if (otGetDynamicLogLevel(aInstance) >= aLogLevel)           \
-            _otPlatLog(aLogLevel, aRegion, aFormat, ##__VA_ARGS__); \
+#define _otDynamicLog(aInstance, aLogLevel, aRegion, aFormat, ...)             \
+    do                                                                         \
+    {                                                                          \
+        if (otLoggingIsEnabled(aInstance, aLogLevel, aRegion))                 \
+            _otLogEmit(aInstance, aLogLevel, aRegion, aFormat, ##__VA_ARGS__); \
     } while (false)
 
 #else // OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
 
 #define _otDynamicLog(aInstance, aLogLevel, aRegion, aFormat, ...) \
-    _otPlatLog(aLogLevel, aRegion, aFormat, ##__VA_ARGS__)
+    _otLogEmit(aInstance, aLogLevel, aRegion, aFormat, ##__VA_ARGS__)
 
 #endif // OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
 
+#if OPENTHREAD_CONFIG_LOG_BINARY
+
+#if defined(WINDOWS_LOGGING) || !defined(__GNUC__)
+#error "OPENTHREAD_CONFIG_LOG_BINARY requires a GNU compatible toolchain"
+#endif
+
+/**
+ * This function appends a record to the binary log of an OpenThread instance.
+ *
+ * Only the identifier of @p aFormat and the raw arguments are recorded, the formatting is done later by the
+ * `tools/binary-log` decoder.
+ *
+ * @param[in]  aInstance   A pointer to the OpenThread instance.
+ * @param[in]  aLogLevel   The log level.
+ * @param[in]  aLogRegion  The log region.
+ * @param[in]  aFormat     A pointer to the format string (a string literal in the firmware image).
+ * @param[in]  ...         Arguments for the format specification.
+ *
+ */
+void otLogBinary(otInstance *aInstance, otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...);
+
+/**
+ * Local/private macro to emit a log message into the binary log.
+ */
+#define _otLogEmit(aInstance, aLogLevel, aRegion, aFormat, ...) \
+    otLogBinary(aInstance, aLogLevel, aRegion, aFormat, ##__VA_ARGS__)
+
+#else // OPENTHREAD_CONFIG_LOG_BINARY
+
+/**
+ * Local/private macro to emit a log message through the platform log function.
+ */
+#define _otLogEmit(aInstance, aLogLevel, aRegion, aFormat, ...) _otPlatLog(aLogLevel, aRegion, aFormat, ##__VA_ARGS__)
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY
+
 /**
  * `OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION` is a configuration parameter (see `openthread-core-default-config.h`) which
  * specifies the function/macro to be used for logging in OpenThread. By default it is set to `otPlatLog()`.
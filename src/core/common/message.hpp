@@ -96,7 +96,11 @@ struct MessageInfo
     uint16_t    mLength;      ///< Number of bytes within the message.
     uint16_t    mOffset;      ///< A byte offset within the message.
     uint16_t    mDatagramTag; ///< The datagram tag used for 6LoWPAN fragmentation.
-    RssAverager mRssAverager; ///< The averager maintaining the received signal strength (RSS) average.
+    union
+    {
+        RssAverager mRssAverager; ///< The averager maintaining the received signal strength (RSS) average.
+        uint16_t    mTimestamp;   ///< The time (in milliseconds, lower 16 bits) when the message was queued for tx.
+    } mRssTimestamp;              ///< RSS average of a received message, or queued time of a message being sent.
 
     uint8_t mChildMask[8]; ///< A bit-vector to indicate which sleepy children need to receive this.
     uint8_t mTimeout;      ///< Seconds remaining before dropping the message.
@@ -474,6 +478,28 @@ public:
      */
     void SetDatagramTag(uint16_t aTag) { mBuffer.mHead.mInfo.mDatagramTag = aTag; }
 
+    /**
+     * This method returns the time (in milliseconds) when the message was queued for transmission.
+     *
+     * Only the lower 16 bits of the time are kept. The timestamp shares its storage with the RSS average, which is
+     * only maintained for received messages, so it replaces the RSS average of a received message that is forwarded.
+     *
+     * @returns The lower 16 bits of the message timestamp.
+     *
+     */
+    uint16_t GetTimestamp(void) const { return mBuffer.mHead.mInfo.mRssTimestamp.mTimestamp; }
+
+    /**
+     * This method sets the time (in milliseconds) when the message was queued for transmission.
+     *
+     * @param[in]  aTimestamp  The message timestamp (only the lower 16 bits are kept).
+     *
+     */
+    void SetTimestamp(uint32_t aTimestamp)
+    {
+        mBuffer.mHead.mInfo.mRssTimestamp.mTimestamp = static_cast<uint16_t>(aTimestamp);
+    }
+
     /**
      * This method returns whether or not the message forwarding is scheduled for the child.
      *
@@ -646,7 +672,7 @@ public:
      * @param[in] aRss A new RSS value (in dBm) to be added to average.
      *
      */
-    void AddRss(int8_t aRss) { mBuffer.mHead.mInfo.mRssAverager.Add(aRss); }
+    void AddRss(int8_t aRss) { mBuffer.mHead.mInfo.mRssTimestamp.mRssAverager.Add(aRss); }
 
     /**
      * This method returns the average RSS (Received Signal Strength) associated with the message.
@@ -654,7 +680,7 @@ public:
      * @returns The current average RSS value (in dBm) or OT_RADIO_RSSI_INVALID if no average is available.
      *
      */
-    int8_t GetAverageRss(void) const { return mBuffer.mHead.mInfo.mRssAverager.GetAverage(); }
+    int8_t GetAverageRss(void) const { return mBuffer.mHead.mInfo.mRssTimestamp.mRssAverager.GetAverage(); }
 
     /**
      * This method returns a const reference to RssAverager of the message.
@@ -662,7 +688,7 @@ public:
      * @returns A const reference to the RssAverager of the message.
      *
      */
-    const RssAverager &GetRssAverager(void) const { return mBuffer.mHead.mInfo.mRssAverager; }
+    const RssAverager &GetRssAverager(void) const { return mBuffer.mHead.mInfo.mRssTimestamp.mRssAverager; }
 
     /**
      * This static method updates a checksum.
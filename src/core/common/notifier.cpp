@@ -38,19 +38,26 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/owner-locator.hpp"
+#include "common/timer.hpp"
 
 namespace ot {
 
-Notifier::Callback::Callback(Handler aHandler, void *aOwner)
+Notifier::Callback::Callback(Handler aHandler, void *aOwner, uint32_t aFlagsMask)
     : OwnerLocator(aOwner)
     , mHandler(aHandler)
     , mNext(this)
+    , mFlagsMask(aFlagsMask)
+    , mInvocationCount(0)
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+    , mDispatchTime(0)
+#endif
 {
 }
 
 Notifier::Notifier(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mFlags(0)
+    , mDispatchCount(0)
     , mTask(aInstance, &Notifier::HandleStateChanged, this)
     , mCallbacks(NULL)
 {
@@ -167,15 +174,32 @@ void Notifier::HandleStateChanged(void)
     VerifyOrExit(flags != 0);
 
     mFlags = 0;
+    mDispatchCount++;
 
     LogChangedFlags(flags);
 
     for (Callback *callback = mCallbacks; callback != NULL; callback = callback->mNext)
     {
-        if (callback->mHandler != NULL)
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+        uint32_t start;
+#endif
+
+        if ((callback->mHandler == NULL) || ((callback->mFlagsMask & flags) == 0))
         {
-            callback->mHandler(*callback, flags);
+            continue;
         }
+
+        callback->mInvocationCount++;
+
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+        start = GetDispatchTimestamp();
+#endif
+
+        callback->mHandler(*callback, flags);
+
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+        callback->mDispatchTime += GetDispatchTimestamp() - start;
+#endif
     }
 
     for (unsigned int i = 0; i < kMaxExternalHandlers; i++)
@@ -192,6 +216,17 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+uint32_t Notifier::GetDispatchTimestamp(void)
+{
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    return TimerMicro::GetNow();
+#else
+    return TimerMilli::GetNow();
+#endif
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
 
 void Notifier::LogChangedFlags(uint32_t aFlags) const
@@ -202,6 +237,8 @@ void Notifier::LogChangedFlags(uint32_t aFlags) const
     int      len = sizeof(stringBuffer) - 1;
     int      charsWritten;
 
+    VerifyOrExit(otLoggingIsEnabled(&GetInstance(), OT_LOG_LEVEL_INFO, OT_LOG_REGION_CORE));
+
     for (uint8_t bit = 0; bit < 32; bit++)
     {
         VerifyOrExit(flags != 0);
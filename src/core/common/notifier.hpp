@@ -88,15 +88,52 @@ public:
         /**
          * This constructor initializes a `Callback` instance
          *
+         * The handler is only invoked for changes that include at least one of the flags in @p aFlagsMask.
+         *
          * @param[in] aHandler    A function pointer to the callback handler.
          * @param[in] aOwner      A pointer to the owner of the `Callback` instance.
+         * @param[in] aFlagsMask  A bit-field indicating the `OT_CHANGED_<STATE>` flags the callback is interested in.
+         *
+         */
+        Callback(Handler aHandler, void *aOwner, uint32_t aFlagsMask);
+
+        /**
+         * This method returns the flags the callback is interested in.
+         *
+         * @returns The bit-field of `OT_CHANGED_<STATE>` flags the callback was registered with.
          *
          */
-        Callback(Handler aHandler, void *aOwner);
+        uint32_t GetFlagsMask(void) const { return mFlagsMask; }
+
+        /**
+         * This method returns the number of times the handler was invoked.
+         *
+         * @returns The number of invocations of the handler.
+         *
+         */
+        uint32_t GetInvocationCount(void) const { return mInvocationCount; }
+
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+        /**
+         * This method returns the total time spent in the handler.
+         *
+         * The time is in microseconds when `OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER` is enabled, in milliseconds
+         * otherwise.
+         *
+         * @returns The total time spent in the handler.
+         *
+         */
+        uint32_t GetDispatchTime(void) const { return mDispatchTime; }
+#endif
 
     private:
         Handler   mHandler;
         Callback *mNext;
+        uint32_t  mFlagsMask;
+        uint32_t  mInvocationCount;
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+        uint32_t mDispatchTime;
+#endif
     };
 
     /**
@@ -166,6 +203,14 @@ public:
      */
     bool IsPending(void) const { return (mFlags != 0); }
 
+    /**
+     * This method returns the number of times changed flags were dispatched to the callbacks.
+     *
+     * @returns The number of dispatched batches of changed flags.
+     *
+     */
+    uint32_t GetDispatchCount(void) const { return mDispatchCount; }
+
 private:
     enum
     {
@@ -185,7 +230,12 @@ private:
     void        LogChangedFlags(uint32_t aFlags) const;
     const char *FlagToString(uint32_t aFlag) const;
 
+#if OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+    static uint32_t GetDispatchTimestamp(void);
+#endif
+
     uint32_t         mFlags;
+    uint32_t         mDispatchCount;
     Tasklet          mTask;
     Callback *       mCallbacks;
     ExternalCallback mExternalCallbacks[kMaxExternalHandlers];
@@ -42,6 +42,7 @@
 #include "common/logging.hpp"
 #include "meshcop/dataset.hpp"
 #include "thread/mle.hpp"
+#include "utils/wrap_string.h"
 
 namespace ot {
 
@@ -231,9 +232,22 @@ exit:
     return error;
 }
 
+otError Settings::BeginChange(void)
+{
+    return otPlatSettingsBeginChange(&GetInstance());
+}
+
+otError Settings::CommitChange(void)
+{
+    return otPlatSettingsCommitChange(&GetInstance());
+}
+
 Settings::ChildInfoIterator::ChildInfoIterator(Instance &aInstance)
     : SettingsBase(aInstance)
     , mIndex(0)
+    , mBatchStart(0)
+    , mBatchLength(0)
+    , mBatchIsLast(false)
     , mIsDone(false)
 {
     Reset();
@@ -241,8 +255,11 @@ Settings::ChildInfoIterator::ChildInfoIterator(Instance &aInstance)
 
 void Settings::ChildInfoIterator::Reset(void)
 {
-    mIndex  = 0;
-    mIsDone = false;
+    mIndex       = 0;
+    mBatchStart  = 0;
+    mBatchLength = 0;
+    mBatchIsLast = false;
+    mIsDone      = false;
     Read();
 }
 
@@ -261,7 +278,11 @@ otError Settings::ChildInfoIterator::Delete(void)
 
     VerifyOrExit(!mIsDone, error = OT_ERROR_INVALID_STATE);
     SuccessOrExit(error = otPlatSettingsDelete(&GetInstance(), kKeyChildInfo, mIndex));
-    LogChildInfo("Removed", mChildInfo);
+    LogChildInfo("Removed", GetChildInfo());
+
+    // The following entries moved in the platform list, so the batch is read again from the next index.
+    mBatchLength = 0;
+    mBatchIsLast = false;
 
 exit:
     LogFailure(error, "removing ChildInfo entry");
@@ -270,16 +291,27 @@ exit:
 
 void Settings::ChildInfoIterator::Read(void)
 {
-    uint16_t size = sizeof(ChildInfo);
-    otError  error;
+    if ((mIndex < mBatchStart || mIndex >= mBatchStart + mBatchLength) && !mBatchIsLast)
+    {
+        uint16_t numValues = kReadBatchSize;
 
-    SuccessOrExit(error = otPlatSettingsGet(&GetInstance(), kKeyChildInfo, mIndex,
-                                            reinterpret_cast<uint8_t *>(&mChildInfo), &size));
-    VerifyOrExit(size >= sizeof(ChildInfo), error = OT_ERROR_NOT_FOUND);
-    LogChildInfo("Read", mChildInfo);
+        if (otPlatSettingsGetAll(&GetInstance(), kKeyChildInfo, mIndex, reinterpret_cast<uint8_t *>(mChildInfo),
+                                 sizeof(ChildInfo), &numValues) != OT_ERROR_NONE)
+        {
+            numValues = 0;
+        }
 
-exit:
-    mIsDone = (error != OT_ERROR_NONE);
+        mBatchStart  = mIndex;
+        mBatchLength = static_cast<uint8_t>(numValues);
+        mBatchIsLast = (numValues < kReadBatchSize);
+    }
+
+    mIsDone = (mIndex < mBatchStart || mIndex >= mBatchStart + mBatchLength);
+
+    if (!mIsDone)
+    {
+        LogChildInfo("Read", GetChildInfo());
+    }
 }
 
 otError Settings::ReadFixedSize(Key aKey, void *aBuffer, uint16_t aExpectedSize) const
@@ -322,3 +354,40 @@ otError Settings::Delete(Key aKey)
 }
 
 } // namespace ot
+
+/* by default, the values are fetched one by one with `otPlatSettingsGet()` */
+OT_TOOL_WEAK otError otPlatSettingsGetAll(otInstance *aInstance,
+                                          uint16_t    aKey,
+                                          int         aIndex,
+                                          uint8_t *   aValues,
+                                          uint16_t    aValueSize,
+                                          uint16_t *  aNumValues)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t count = 0;
+
+    for (; count < *aNumValues; count++)
+    {
+        uint8_t *value  = aValues + count * aValueSize;
+        uint16_t length = aValueSize;
+
+        error = otPlatSettingsGet(aInstance, aKey, aIndex + count, value, &length);
+
+        if (error == OT_ERROR_NOT_FOUND)
+        {
+            error = OT_ERROR_NONE;
+            break;
+        }
+
+        SuccessOrExit(error);
+
+        if (length < aValueSize)
+        {
+            memset(value + length, 0, aValueSize - length);
+        }
+    }
+
+exit:
+    *aNumValues = count;
+    return error;
+}
@@ -343,9 +343,30 @@ public:
      */
     otError DeleteChildInfo(void);
 
+    /**
+     * This method starts a sequence of settings changes which the platform may batch until `CommitChange()`.
+     *
+     * @retval OT_ERROR_NONE     Successfully started the change sequence.
+     * @retval OT_ERROR_ALREADY  A change sequence is already in progress.
+     *
+     */
+    otError BeginChange(void);
+
+    /**
+     * This method ends a sequence of settings changes started with `BeginChange()`.
+     *
+     * @retval OT_ERROR_NONE              Successfully committed the changes.
+     * @retval OT_ERROR_INVALID_STATE     `BeginChange()` has not been called.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not batch settings changes.
+     *
+     */
+    otError CommitChange(void);
+
     /**
      * This class defines an iterator to access all Child Info entries in the settings.
      *
+     * The entries are read from the platform in batches of `kReadBatchSize` with `otPlatSettingsGetAll()`.
+     *
      */
     class ChildInfoIterator : public SettingsBase
     {
@@ -389,7 +410,7 @@ public:
          * @returns A reference to `ChildInfo` structure corresponding to current iterator entry.
          *
          */
-        const ChildInfo &GetChildInfo(void) const { return mChildInfo; }
+        const ChildInfo &GetChildInfo(void) const { return mChildInfo[mIndex - mBatchStart]; }
 
         /**
          * This method deletes the current Child Info entry.
@@ -402,10 +423,18 @@ public:
         otError Delete(void);
 
     private:
+        enum
+        {
+            kReadBatchSize = 8, ///< Number of Child Info entries read from the platform at once.
+        };
+
         void Read(void);
 
-        ChildInfo mChildInfo;
+        ChildInfo mChildInfo[kReadBatchSize];
         uint8_t   mIndex;
+        uint8_t   mBatchStart;
+        uint8_t   mBatchLength;
+        bool      mBatchIsLast;
         bool      mIsDone;
     };
 
@@ -40,68 +40,117 @@
 
 #if OPENTHREAD_ENABLE_COMMISSIONER && OPENTHREAD_FTD
 
-void otPbkdf2Cmac(const uint8_t *aPassword,
-                  uint16_t       aPasswordLen,
-                  const uint8_t *aSalt,
-                  uint16_t       aSaltLen,
-                  uint32_t       aIterationCounter,
-                  uint16_t       aKeyLen,
-                  uint8_t *      aKey)
+void otPbkdf2CmacStart(otPbkdf2CmacContext *aContext,
+                       const uint8_t *      aPassword,
+                       uint16_t             aPasswordLen,
+                       const uint8_t *      aSalt,
+                       uint16_t             aSaltLen,
+                       uint32_t             aIterationCounter,
+                       uint32_t             aBlockIndex)
 {
-    const size_t kBlockSize = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t      prfInput[OT_PBKDF2_SALT_MAX_LEN + 4]; // Salt || INT(), for U1 calculation
-    long         prfOne[kBlockSize / sizeof(long)];
-    long         prfTwo[kBlockSize / sizeof(long)];
-    long         keyBlock[kBlockSize / sizeof(long)];
-    uint32_t     blockCounter = 0;
-    uint8_t *    key          = aKey;
-    uint16_t     keyLen       = aKeyLen;
-    uint16_t     useLen       = 0;
+    const uint8_t kZeroBlock[OT_PBKDF2_BLOCK_SIZE] = {0};
+    uint8_t       prfKey[OT_PBKDF2_BLOCK_SIZE];
+    uint8_t       prfInput[OT_PBKDF2_SALT_MAX_LEN + 4]; // Salt || INT(), for U1 calculation
+    uint8_t       carry;
 
-    memcpy(prfInput, aSalt, aSaltLen);
-    assert(aIterationCounter % 2 == 0);
-    aIterationCounter /= 2;
+    assert(aSaltLen <= OT_PBKDF2_SALT_MAX_LEN && aIterationCounter > 0);
+
+    // The PRF key is the password if it is 128 bits long, AES-CMAC(0^128, password) otherwise (RFC 4615).
+    if (aPasswordLen == OT_PBKDF2_BLOCK_SIZE)
+    {
+        memcpy(prfKey, aPassword, sizeof(prfKey));
+    }
+    else
+    {
+        mbedtls_aes_cmac_prf_128(kZeroBlock, sizeof(kZeroBlock), aPassword, aPasswordLen, prfKey);
+    }
+
+    mbedtls_aes_init(&aContext->mAes);
+    mbedtls_aes_setkey_enc(&aContext->mAes, prfKey, 128);
 
-    while (keyLen)
+    // The CMAC subkey K1 for a message of a single complete block (RFC 4493).
+    mbedtls_aes_crypt_ecb(&aContext->mAes, MBEDTLS_AES_ENCRYPT, kZeroBlock, aContext->mSubkey);
+    carry = aContext->mSubkey[0] >> 7;
+
+    for (uint8_t i = 0; i < OT_PBKDF2_BLOCK_SIZE - 1; i++)
     {
-        ++blockCounter;
-        prfInput[aSaltLen + 0] = static_cast<uint8_t>(blockCounter >> 24);
-        prfInput[aSaltLen + 1] = static_cast<uint8_t>(blockCounter >> 16);
-        prfInput[aSaltLen + 2] = static_cast<uint8_t>(blockCounter >> 8);
-        prfInput[aSaltLen + 3] = static_cast<uint8_t>(blockCounter);
+        aContext->mSubkey[i] = static_cast<uint8_t>((aContext->mSubkey[i] << 1) | (aContext->mSubkey[i + 1] >> 7));
+    }
+
+    aContext->mSubkey[OT_PBKDF2_BLOCK_SIZE - 1] <<= 1;
+
+    if (carry)
+    {
+        aContext->mSubkey[OT_PBKDF2_BLOCK_SIZE - 1] ^= 0x87;
+    }
+
+    // Calculate U_1
+    memcpy(prfInput, aSalt, aSaltLen);
+    prfInput[aSaltLen + 0] = static_cast<uint8_t>(aBlockIndex >> 24);
+    prfInput[aSaltLen + 1] = static_cast<uint8_t>(aBlockIndex >> 16);
+    prfInput[aSaltLen + 2] = static_cast<uint8_t>(aBlockIndex >> 8);
+    prfInput[aSaltLen + 3] = static_cast<uint8_t>(aBlockIndex);
 
-        // Calculate U_1
-        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, prfInput, aSaltLen + 4,
-                                 reinterpret_cast<uint8_t *>(keyBlock));
+    mbedtls_aes_cmac_prf_128(prfKey, sizeof(prfKey), prfInput, aSaltLen + 4U, aContext->mPrfOutput);
+    memcpy(aContext->mKeyBlock, aContext->mPrfOutput, sizeof(aContext->mKeyBlock));
+    aContext->mIterationsLeft = aIterationCounter - 1;
 
-        // Calculate U_2
-        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(keyBlock), kBlockSize,
-                                 reinterpret_cast<uint8_t *>(prfOne));
+    memset(prfKey, 0, sizeof(prfKey));
+}
+
+bool otPbkdf2CmacProcess(otPbkdf2CmacContext *aContext, uint32_t aMaxIterations)
+{
+    uint8_t block[OT_PBKDF2_BLOCK_SIZE];
 
-        for (uint32_t j = 0; j < kBlockSize / sizeof(long); ++j)
+    for (; aMaxIterations > 0 && aContext->mIterationsLeft > 0; aMaxIterations--, aContext->mIterationsLeft--)
+    {
+        // Calculate U_i = AES-CMAC(U_{i-1}), which is AES(U_{i-1} ^ K1) as U_{i-1} is a single complete block.
+        for (uint8_t i = 0; i < OT_PBKDF2_BLOCK_SIZE; i++)
         {
-            keyBlock[j] ^= prfOne[j];
+            block[i] = aContext->mPrfOutput[i] ^ aContext->mSubkey[i];
         }
 
-        for (uint32_t i = 1; i < aIterationCounter; ++i)
+        mbedtls_aes_crypt_ecb(&aContext->mAes, MBEDTLS_AES_ENCRYPT, block, aContext->mPrfOutput);
+
+        for (uint8_t i = 0; i < OT_PBKDF2_BLOCK_SIZE; i++)
         {
-            // Calculate U_{2 * i - 1}
-            mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(prfOne), kBlockSize,
-                                     reinterpret_cast<uint8_t *>(prfTwo));
-            // Calculate U_{2 * i}
-            mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(prfTwo), kBlockSize,
-                                     reinterpret_cast<uint8_t *>(prfOne));
-
-            for (uint32_t j = 0; j < kBlockSize / sizeof(long); ++j)
-            {
-                keyBlock[j] ^= prfOne[j] ^ prfTwo[j];
-            }
+            aContext->mKeyBlock[i] ^= aContext->mPrfOutput[i];
         }
+    }
+
+    return (aContext->mIterationsLeft == 0);
+}
+
+void otPbkdf2CmacFinish(otPbkdf2CmacContext *aContext, uint8_t *aKeyBlock)
+{
+    memcpy(aKeyBlock, aContext->mKeyBlock, sizeof(aContext->mKeyBlock));
+    mbedtls_aes_free(&aContext->mAes);
+    memset(aContext, 0, sizeof(*aContext));
+}
+
+void otPbkdf2Cmac(const uint8_t *aPassword,
+                  uint16_t       aPasswordLen,
+                  const uint8_t *aSalt,
+                  uint16_t       aSaltLen,
+                  uint32_t       aIterationCounter,
+                  uint16_t       aKeyLen,
+                  uint8_t *      aKey)
+{
+    otPbkdf2CmacContext context;
+    uint8_t             keyBlock[OT_PBKDF2_BLOCK_SIZE];
+    uint32_t            blockIndex = 0;
+    uint16_t            useLen;
+
+    while (aKeyLen)
+    {
+        otPbkdf2CmacStart(&context, aPassword, aPasswordLen, aSalt, aSaltLen, aIterationCounter, ++blockIndex);
+        otPbkdf2CmacProcess(&context, aIterationCounter);
+        otPbkdf2CmacFinish(&context, keyBlock);
 
-        useLen = (keyLen < kBlockSize) ? keyLen : kBlockSize;
-        memcpy(key, keyBlock, useLen);
-        key += useLen;
-        keyLen -= useLen;
+        useLen = (aKeyLen < sizeof(keyBlock)) ? aKeyLen : static_cast<uint16_t>(sizeof(keyBlock));
+        memcpy(aKey, keyBlock, useLen);
+        aKey += useLen;
+        aKeyLen -= useLen;
     }
 }
 
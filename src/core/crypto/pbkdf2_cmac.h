@@ -40,11 +40,71 @@
 #include "utils/wrap_stdbool.h"
 #include "utils/wrap_stdint.h"
 
+#include <mbedtls/aes.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #define OT_PBKDF2_SALT_MAX_LEN 30 // salt prefix (6) + extended panid (8) + network name (16)
+#define OT_PBKDF2_BLOCK_SIZE 16   // AES-CMAC-PRF-128 output size
+
+/**
+ * This structure represents the computation of a PBKDF2 block, which may be run in steps.
+ *
+ * The PRF key and the CMAC subkey are computed once at the start, so that each iteration takes a single AES block
+ * encryption.
+ *
+ */
+typedef struct otPbkdf2CmacContext
+{
+    mbedtls_aes_context mAes;                             // Keyed with the PRF key.
+    uint8_t             mSubkey[OT_PBKDF2_BLOCK_SIZE];    // The CMAC subkey K1.
+    uint8_t             mPrfOutput[OT_PBKDF2_BLOCK_SIZE]; // U_i
+    uint8_t             mKeyBlock[OT_PBKDF2_BLOCK_SIZE];  // U_1 ^ ... ^ U_i
+    uint32_t            mIterationsLeft;
+} otPbkdf2CmacContext;
+
+/**
+ * This method starts computing a block of PKCS#5 PBKDF2 using CMAC (AES-CMAC-PRF-128).
+ *
+ * @param[out]    aContext           A pointer to the context of the computation.
+ * @param[in]     aPassword          Password to use when generating key.
+ * @param[in]     aPasswordLen       Length of password.
+ * @param[in]     aSalt              Salt to use when generating key.
+ * @param[in]     aSaltLen           Length of salt.
+ * @param[in]     aIterationCounter  Iteration count (at least one).
+ * @param[in]     aBlockIndex        Index of the block to compute, starting at one.
+ *
+ */
+void otPbkdf2CmacStart(otPbkdf2CmacContext *aContext,
+                       const uint8_t *      aPassword,
+                       uint16_t             aPasswordLen,
+                       const uint8_t *      aSalt,
+                       uint16_t             aSaltLen,
+                       uint32_t             aIterationCounter,
+                       uint32_t             aBlockIndex);
+
+/**
+ * This method runs iterations of a PBKDF2 block computation.
+ *
+ * @param[inout]  aContext        A pointer to the context of the computation.
+ * @param[in]     aMaxIterations  The maximum number of iterations to run.
+ *
+ * @retval TRUE   The block is computed, get it with `otPbkdf2CmacFinish()`.
+ * @retval FALSE  There are iterations left.
+ *
+ */
+bool otPbkdf2CmacProcess(otPbkdf2CmacContext *aContext, uint32_t aMaxIterations);
+
+/**
+ * This method completes a PBKDF2 block computation.
+ *
+ * @param[inout]  aContext   A pointer to the context of the computation.
+ * @param[out]    aKeyBlock  A pointer to the block (`OT_PBKDF2_BLOCK_SIZE` bytes).
+ *
+ */
+void otPbkdf2CmacFinish(otPbkdf2CmacContext *aContext, uint8_t *aKeyBlock);
 
 /**
  * This method perform PKCS#5 PBKDF2 using CMAC (AES-CMAC-PRF-128).
@@ -1343,7 +1343,14 @@ void Mac::HandleTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otEr
 
         if (neighbor != NULL)
         {
+            uint8_t linkQuality = neighbor->GetLinkInfo().GetLinkQuality();
+
             neighbor->GetLinkInfo().AddRss(GetNoiseFloor(), ackFrame.GetRssi());
+
+            if (neighbor->GetLinkInfo().GetLinkQuality() != linkQuality)
+            {
+                GetNetif().GetMle().GetRouterTable().UpdateRoutes(*neighbor);
+            }
         }
     }
 
@@ -1916,6 +1923,8 @@ void Mac::HandleReceivedFrame(Frame *aFrame, otError aError)
 
     if (neighbor != NULL)
     {
+        uint8_t linkQuality = neighbor->GetLinkInfo().GetLinkQuality();
+
 #if OPENTHREAD_ENABLE_MAC_FILTER
 
         // make assigned rssi to take effect quickly
@@ -1928,6 +1937,12 @@ void Mac::HandleReceivedFrame(Frame *aFrame, otError aError)
 
         neighbor->GetLinkInfo().AddRss(GetNoiseFloor(), aFrame->mRssi);
 
+        // Link quality is an input to the link cost used for route selection.
+        if (neighbor->GetLinkInfo().GetLinkQuality() != linkQuality)
+        {
+            netif.GetMle().GetRouterTable().UpdateRoutes(*neighbor);
+        }
+
         if (aFrame->GetSecurityEnabled() == true)
         {
             switch (neighbor->GetState())
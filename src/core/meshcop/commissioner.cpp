@@ -46,7 +46,6 @@
 #include "common/instance.hpp"
 #include "common/logging.hpp"
 #include "common/owner-locator.hpp"
-#include "crypto/pbkdf2_cmac.h"
 #include "meshcop/joiner_router.hpp"
 #include "meshcop/meshcop.hpp"
 #include "meshcop/meshcop_tlvs.hpp"
@@ -62,6 +61,7 @@ namespace MeshCoP {
 Commissioner::Commissioner(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(OT_COMMISSIONER_STATE_DISABLED)
+    , mJoiners(mJoinerEntries, OT_ARRAY_LENGTH(mJoinerEntries), mJoinerBuckets, OT_ARRAY_LENGTH(mJoinerBuckets))
     , mJoinerPort(0)
     , mJoinerRloc(0)
     , mJoinerExpirationTimer(aInstance, HandleJoinerExpirationTimer, this)
@@ -74,8 +74,8 @@ Commissioner::Commissioner(Instance &aInstance)
     , mAnnounceBegin(aInstance)
     , mEnergyScan(aInstance)
     , mPanIdQuery(aInstance)
+    , mPskcGenerator(aInstance)
 {
-    memset(mJoiners, 0, sizeof(mJoiners));
 }
 
 void Commissioner::AddCoapResources(void)
@@ -142,7 +142,6 @@ otError Commissioner::SendCommissionerSet(void)
     otError                error;
     otCommissioningDataset dataset;
     SteeringDataTlv        steeringData;
-    Mac::ExtAddress        joinerId;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
@@ -152,29 +151,8 @@ otError Commissioner::SendCommissionerSet(void)
     dataset.mSessionId      = mSessionId;
     dataset.mIsSessionIdSet = true;
 
-    // compute bloom filter
-    steeringData.Init();
-    steeringData.Clear();
-
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
-    {
-        if (!mJoiners[i].mValid)
-        {
-            continue;
-        }
-
-        if (mJoiners[i].mAny)
-        {
-            steeringData.SetLength(1);
-            steeringData.Set();
-            break;
-        }
-
-        ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-        steeringData.ComputeBloomFilter(joinerId);
-    }
-
     // set bloom filter
+    mJoiners.GetSteeringData(steeringData);
     memcpy(dataset.mSteeringData.m8, steeringData.GetValue(), steeringData.GetLength());
     dataset.mSteeringData.mLength = steeringData.GetLength();
     dataset.mIsSteeringDataSet    = true;
@@ -187,49 +165,29 @@ exit:
 
 void Commissioner::ClearJoiners(void)
 {
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
-    {
-        mJoiners[i].mValid = false;
-    }
+    mJoiners.Clear();
+    mJoinerExpirationTimer.Stop();
 
     SendCommissionerSet();
 }
 
 otError Commissioner::AddJoiner(const Mac::ExtAddress *aEui64, const char *aPSKd, uint32_t aTimeout)
 {
-    otError error = OT_ERROR_NO_BUFS;
+    otError  error;
+    uint32_t expirationTime = TimerMilli::GetNow() + TimerMilli::SecToMsec(aTimeout);
+    bool     steeringDataChanged;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
     VerifyOrExit(strlen(aPSKd) <= Dtls::kPskMaxLength, error = OT_ERROR_INVALID_ARGS);
-    RemoveJoiner(aEui64, 0); // remove immediately
-
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
-    {
-        if (mJoiners[i].mValid)
-        {
-            continue;
-        }
 
-        if (aEui64 != NULL)
-        {
-            memcpy(&mJoiners[i].mEui64, aEui64, sizeof(mJoiners[i].mEui64));
-            mJoiners[i].mAny = false;
-        }
-        else
-        {
-            mJoiners[i].mAny = true;
-        }
+    SuccessOrExit(error = mJoiners.Add(aEui64, aPSKd, expirationTime, steeringDataChanged));
 
-        (void)strlcpy(mJoiners[i].mPsk, aPSKd, sizeof(mJoiners[i].mPsk));
-        mJoiners[i].mValid          = true;
-        mJoiners[i].mExpirationTime = TimerMilli::GetNow() + TimerMilli::SecToMsec(aTimeout);
-
-        UpdateJoinerExpirationTimer();
+    ScheduleJoinerExpiration(expirationTime);
 
+    if (steeringDataChanged)
+    {
         SendCommissionerSet();
-
-        ExitNow(error = OT_ERROR_NONE);
     }
 
 exit:
@@ -255,49 +213,13 @@ exit:
 
 otError Commissioner::RemoveJoiner(const Mac::ExtAddress *aEui64, uint32_t aDelay)
 {
-    otError error = OT_ERROR_NOT_FOUND;
+    otError             error = OT_ERROR_NONE;
+    JoinerTable::Entry *entry;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit((entry = mJoiners.Find(aEui64)) != NULL, error = OT_ERROR_NOT_FOUND);
 
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
-    {
-        if (!mJoiners[i].mValid)
-        {
-            continue;
-        }
-
-        if (aEui64 != NULL)
-        {
-            if (memcmp(&mJoiners[i].mEui64, aEui64, sizeof(mJoiners[i].mEui64)))
-            {
-                continue;
-            }
-        }
-        else if (!mJoiners[i].mAny)
-        {
-            continue;
-        }
-
-        if (aDelay > 0)
-        {
-            uint32_t now = TimerMilli::GetNow();
-
-            if ((static_cast<int32_t>(mJoiners[i].mExpirationTime - now) > 0) &&
-                (static_cast<uint32_t>(mJoiners[i].mExpirationTime - now) > TimerMilli::SecToMsec(aDelay)))
-            {
-                mJoiners[i].mExpirationTime = now + TimerMilli::SecToMsec(aDelay);
-                UpdateJoinerExpirationTimer();
-            }
-        }
-        else
-        {
-            mJoiners[i].mValid = false;
-            UpdateJoinerExpirationTimer();
-            SendCommissionerSet();
-        }
-
-        ExitNow(error = OT_ERROR_NONE);
-    }
+    RemoveJoiner(*entry, aDelay);
 
 exit:
     if (error == OT_ERROR_NONE)
@@ -319,6 +241,25 @@ exit:
     return error;
 }
 
+void Commissioner::RemoveJoiner(JoinerTable::Entry &aEntry, uint32_t aDelay)
+{
+    if (aDelay > 0)
+    {
+        uint32_t now = TimerMilli::GetNow();
+
+        if ((static_cast<int32_t>(aEntry.mExpirationTime - now) > 0) &&
+            (static_cast<uint32_t>(aEntry.mExpirationTime - now) > TimerMilli::SecToMsec(aDelay)))
+        {
+            aEntry.mExpirationTime = now + TimerMilli::SecToMsec(aDelay);
+            ScheduleJoinerExpiration(aEntry.mExpirationTime);
+        }
+    }
+    else if (mJoiners.Remove(aEntry))
+    {
+        SendCommissionerSet();
+    }
+}
+
 otError Commissioner::SetProvisioningUrl(const char *aProvisioningUrl)
 {
     return GetNetif().GetDtls().mProvisioningUrl.SetProvisioningUrl(aProvisioningUrl);
@@ -363,56 +304,42 @@ void Commissioner::HandleJoinerExpirationTimer(Timer &aTimer)
 
 void Commissioner::HandleJoinerExpirationTimer(void)
 {
-    uint32_t now = TimerMilli::GetNow();
+    uint32_t now                 = TimerMilli::GetNow();
+    uint32_t nextTimeout         = 0xffffffff;
+    bool     steeringDataChanged = false;
 
-    // Remove Joiners.
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    // Remove expired Joiners and find the timeout of the next one.
+    for (JoinerTable::Entry *entry = mJoiners.GetNext(NULL); entry != NULL; entry = mJoiners.GetNext(entry))
     {
-        if (!mJoiners[i].mValid)
-        {
-            continue;
-        }
-
-        if (static_cast<int32_t>(now - mJoiners[i].mExpirationTime) >= 0)
+        if (static_cast<int32_t>(now - entry->mExpirationTime) >= 0)
         {
             otLogDebgMeshCoP(GetInstance(), "removing joiner due to timeout or successfully joined");
-            RemoveJoiner(&mJoiners[i].mEui64, 0); // remove immediately
+            steeringDataChanged |= mJoiners.Remove(*entry);
         }
-    }
-
-    UpdateJoinerExpirationTimer();
-}
-
-void Commissioner::UpdateJoinerExpirationTimer(void)
-{
-    uint32_t now         = TimerMilli::GetNow();
-    uint32_t nextTimeout = 0xffffffff;
-
-    // Check if timer should be set for next Joiner.
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
-    {
+        else if (entry->mExpirationTime - now < nextTimeout)
         {
-            if (!mJoiners[i].mValid)
-            {
-                continue;
-            }
-
-            if (mJoiners[i].mExpirationTime - now < nextTimeout)
-            {
-                nextTimeout = mJoiners[i].mExpirationTime - now;
-            }
+            nextTimeout = entry->mExpirationTime - now;
         }
     }
 
     if (nextTimeout != 0xffffffff)
     {
-        // Update the timer to the timeout of the next Joiner.
         mJoinerExpirationTimer.Start(nextTimeout);
     }
-    else
+
+    if (steeringDataChanged)
     {
-        // No Joiners, stop the timer.
-        mJoinerExpirationTimer.Stop();
+        SendCommissionerSet();
+    }
+}
+
+void Commissioner::ScheduleJoinerExpiration(uint32_t aExpirationTime)
+{
+    // The timer is only ever moved earlier here, `HandleJoinerExpirationTimer()` finds the next expiration.
+    if (!mJoinerExpirationTimer.IsRunning() ||
+        static_cast<int32_t>(aExpirationTime - mJoinerExpirationTimer.GetFireTime()) < 0)
+    {
+        mJoinerExpirationTimer.Start(aExpirationTime - TimerMilli::GetNow());
     }
 }
 
@@ -818,30 +745,20 @@ void Commissioner::HandleRelayReceive(Coap::Header &aHeader, Message &aMessage,
 
     if (!netif.GetCoapSecure().IsConnectionActive())
     {
+        JoinerTable::Entry *entry;
+
         memcpy(mJoinerIid, joinerIid.GetIid(), sizeof(mJoinerIid));
-        mJoinerIid[0] ^= 0x2;
+        memcpy(joinerId.m8, mJoinerIid, sizeof(joinerId.m8));
+        joinerId.SetLocal(!joinerId.IsLocal());
 
-        for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+        if ((entry = mJoiners.FindByJoinerId(joinerId)) != NULL)
         {
-            if (!mJoiners[i].mValid)
-            {
-                continue;
-            }
-
-            ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-
-            if (mJoiners[i].mAny || !memcmp(&joinerId, mJoinerIid, sizeof(joinerId)))
-            {
-                error = netif.GetCoapSecure().SetPsk(reinterpret_cast<const uint8_t *>(mJoiners[i].mPsk),
-                                                     static_cast<uint8_t>(strlen(mJoiners[i].mPsk)));
-                SuccessOrExit(error);
-                otLogInfoMeshCoP(GetInstance(), "found joiner, starting new session");
-                enableJoiner = true;
-                break;
-            }
+            error = netif.GetCoapSecure().SetPsk(reinterpret_cast<const uint8_t *>(entry->mPsk),
+                                                 static_cast<uint8_t>(strlen(entry->mPsk)));
+            SuccessOrExit(error);
+            otLogInfoMeshCoP(GetInstance(), "found joiner, starting new session");
+            enableJoiner = true;
         }
-
-        mJoinerIid[0] ^= 0x2;
     }
     else
     {
@@ -940,13 +857,14 @@ exit:
 
 void Commissioner::SendJoinFinalizeResponse(const Coap::Header &aRequestHeader, StateTlv::State aState)
 {
-    ThreadNetif &     netif = GetNetif();
-    otError           error = OT_ERROR_NONE;
-    Coap::Header      responseHeader;
-    Ip6::MessageInfo  joinerMessageInfo;
-    MeshCoP::StateTlv stateTlv;
-    Message *         message;
-    Mac::ExtAddress   extAddr;
+    ThreadNetif &       netif = GetNetif();
+    otError             error = OT_ERROR_NONE;
+    Coap::Header        responseHeader;
+    Ip6::MessageInfo    joinerMessageInfo;
+    MeshCoP::StateTlv   stateTlv;
+    Message *           message;
+    Mac::ExtAddress     extAddr;
+    JoinerTable::Entry *entry;
 
     responseHeader.SetDefaultResponseHeader(aRequestHeader);
     responseHeader.SetPayloadMarker();
@@ -976,7 +894,13 @@ void Commissioner::SendJoinFinalizeResponse(const Coap::Header &aRequestHeader,
 
     memcpy(extAddr.m8, mJoinerIid, sizeof(extAddr.m8));
     extAddr.SetLocal(!extAddr.IsLocal());
-    RemoveJoiner(&extAddr, kRemoveJoinerDelay); // remove after kRemoveJoinerDelay (seconds)
+    entry = mJoiners.FindByJoinerId(extAddr);
+
+    // An entry for any Joiner stays in place for other Joiners.
+    if (entry != NULL && !entry->mAny)
+    {
+        RemoveJoiner(*entry, kRemoveJoinerDelay); // remove after kRemoveJoinerDelay (seconds)
+    }
 
     otLogInfoMeshCoP(GetInstance(), "sent joiner finalize response");
 
@@ -1065,30 +989,7 @@ otError Commissioner::GeneratePSKc(const char *   aPassPhrase,
                                    const uint8_t *aExtPanId,
                                    uint8_t *      aPSKc)
 {
-    otError     error      = OT_ERROR_NONE;
-    const char *saltPrefix = "Thread";
-    uint8_t     salt[OT_PBKDF2_SALT_MAX_LEN];
-    uint16_t    saltLen = 0;
-
-    VerifyOrExit((strlen(aPassPhrase) >= OT_COMMISSIONING_PASSPHRASE_MIN_SIZE) &&
-                     (strlen(aPassPhrase) <= OT_COMMISSIONING_PASSPHRASE_MAX_SIZE),
-                 error = OT_ERROR_INVALID_ARGS);
-
-    memset(salt, 0, sizeof(salt));
-    memcpy(salt, saltPrefix, strlen(saltPrefix));
-    saltLen += static_cast<uint16_t>(strlen(saltPrefix));
-
-    memcpy(salt + saltLen, aExtPanId, OT_EXT_PAN_ID_SIZE);
-    saltLen += OT_EXT_PAN_ID_SIZE;
-
-    memcpy(salt + saltLen, aNetworkName, strlen(aNetworkName));
-    saltLen += static_cast<uint16_t>(strlen(aNetworkName));
-
-    otPbkdf2Cmac(reinterpret_cast<const uint8_t *>(aPassPhrase), static_cast<uint16_t>(strlen(aPassPhrase)),
-                 reinterpret_cast<const uint8_t *>(salt), saltLen, 16384, OT_PSKC_MAX_SIZE, aPSKc);
-
-exit:
-    return error;
+    return PskcGenerator::Compute(aPassPhrase, aNetworkName, aExtPanId, aPSKc);
 }
 
 } // namespace MeshCoP
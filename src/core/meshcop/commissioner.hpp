@@ -46,7 +46,9 @@
 #include "meshcop/announce_begin_client.hpp"
 #include "meshcop/dtls.hpp"
 #include "meshcop/energy_scan_client.hpp"
+#include "meshcop/joiner_table.hpp"
 #include "meshcop/panid_query_client.hpp"
+#include "meshcop/pskc_generator.hpp"
 #include "net/udp6.hpp"
 #include "thread/mle.hpp"
 
@@ -213,6 +215,14 @@ public:
      */
     EnergyScanClient &GetEnergyScanClient(void) { return mEnergyScan; }
 
+    /**
+     * This method returns a reference to the PskcGenerator instance.
+     *
+     * @returns A reference to the PskcGenerator instance.
+     *
+     */
+    PskcGenerator &GetPskcGenerator(void) { return mPskcGenerator; }
+
     /**
      * This method returns a reference to the PanIdQueryClient instance.
      *
@@ -240,7 +250,8 @@ private:
     static void HandleJoinerExpirationTimer(Timer &aTimer);
     void        HandleJoinerExpirationTimer(void);
 
-    void UpdateJoinerExpirationTimer(void);
+    void ScheduleJoinerExpiration(uint32_t aExpirationTime);
+    void RemoveJoiner(JoinerTable::Entry &aEntry, uint32_t aDelay);
 
     static void HandleMgmtCommissionerSetResponse(void *               aContext,
                                                   otCoapHeader *       aHeader,
@@ -308,15 +319,9 @@ private:
 
     otCommissionerState mState;
 
-    struct Joiner
-    {
-        Mac::ExtAddress mEui64;
-        uint32_t        mExpirationTime;
-        char            mPsk[Dtls::kPskMaxLength + 1];
-        bool            mValid : 1;
-        bool            mAny : 1;
-    };
-    Joiner mJoiners[OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES];
+    JoinerTable::Entry mJoinerEntries[OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES];
+    uint16_t           mJoinerBuckets[OPENTHREAD_CONFIG_JOINER_HASH_BUCKETS];
+    JoinerTable        mJoiners;
 
     uint8_t    mJoinerIid[8];
     uint16_t   mJoinerPort;
@@ -334,6 +339,7 @@ private:
     AnnounceBeginClient mAnnounceBegin;
     EnergyScanClient    mEnergyScan;
     PanIdQueryClient    mPanIdQuery;
+    PskcGenerator       mPskcGenerator;
 };
 
 } // namespace MeshCoP
@@ -70,6 +70,7 @@ Dtls::Dtls(Instance &aInstance)
     , mClient(false)
     , mMessageSubType(Message::kSubTypeNone)
     , mMessageDefaultSubType(Message::kSubTypeNone)
+    , mHandshakeStartTime(0)
 {
     memset(mPsk, 0, sizeof(mPsk));
     memset(&mEntropy, 0, sizeof(mEntropy));
@@ -77,7 +78,15 @@ Dtls::Dtls(Instance &aInstance)
     memset(&mSsl, 0, sizeof(mSsl));
     memset(&mConf, 0, sizeof(mConf));
     memset(&mCookieCtx, 0, sizeof(mCookieCtx));
+    memset(&mHandshakeInfo, 0, sizeof(mHandshakeInfo));
     mProvisioningUrl.Init();
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    memset(&mClientSession, 0, sizeof(mClientSession));
+    memset(mServerSessions, 0, sizeof(mServerSessions));
+    mNextServerSession    = 0;
+    mClientSessionOffered = false;
+#endif
 }
 
 int Dtls::HandleMbedtlsEntropyPoll(void *aData, unsigned char *aOutput, size_t aInLen, size_t *aOutLen)
@@ -123,6 +132,9 @@ otError Dtls::Start(bool             aClient,
     mReceiveMessage   = NULL;
     mMessageSubType   = Message::kSubTypeNone;
 
+    mHandshakeStartTime = TimerMilli::GetNow();
+    memset(&mHandshakeInfo, 0, sizeof(mHandshakeInfo));
+
     mbedtls_ssl_init(&mSsl);
     mbedtls_ssl_config_init(&mConf);
     mbedtls_ctr_drbg_init(&mCtrDrbg);
@@ -157,6 +169,10 @@ otError Dtls::Start(bool             aClient,
         VerifyOrExit(rval == 0);
 
         mbedtls_ssl_conf_dtls_cookies(&mConf, mbedtls_ssl_cookie_write, mbedtls_ssl_cookie_check, &mCookieCtx);
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+        mbedtls_ssl_conf_session_cache(&mConf, this, HandleMbedtlsGetCache, HandleMbedtlsSetCache);
+#endif
     }
 
     rval = mbedtls_ssl_setup(&mSsl, &mConf);
@@ -168,6 +184,18 @@ otError Dtls::Start(bool             aClient,
     rval = mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPsk, mPskLength);
     VerifyOrExit(rval == 0);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    mClientSessionOffered = false;
+
+    if (mClient && IsSessionUsable(mClientSession))
+    {
+        // Offer the session ID of the last session, the server resumes the session if it still has it.
+        rval = mbedtls_ssl_set_session(&mSsl, &mClientSession.mSession);
+        VerifyOrExit(rval == 0);
+        mClientSessionOffered = true;
+    }
+#endif
+
     mStarted = true;
     Process();
 
@@ -279,6 +307,8 @@ int Dtls::HandleMbedtlsTransmit(const unsigned char *aBuf, size_t aLength)
 
     otLogInfoMeshCoP(GetInstance(), "Dtls::HandleMbedtlsTransmit");
 
+    RecordHandshakeFlight(true);
+
     error = mSendHandler(mContext, aBuf, static_cast<uint16_t>(aLength), mMessageSubType);
 
     // Restore default sub type.
@@ -324,6 +354,8 @@ int Dtls::HandleMbedtlsReceive(unsigned char *aBuf, size_t aLength)
     mReceiveOffset += static_cast<uint16_t>(rval);
     mReceiveLength -= static_cast<uint16_t>(rval);
 
+    RecordHandshakeFlight(false);
+
 exit:
     return rval;
 }
@@ -435,9 +467,14 @@ void Dtls::Process(void)
         {
             rval = mbedtls_ssl_handshake(&mSsl);
 
-            if ((mSsl.state == MBEDTLS_SSL_HANDSHAKE_OVER) && (mConnectedHandler != NULL))
+            if (mSsl.state == MBEDTLS_SSL_HANDSHAKE_OVER)
             {
-                mConnectedHandler(mContext, true);
+                HandleHandshakeComplete();
+
+                if (mConnectedHandler != NULL)
+                {
+                    mConnectedHandler(mContext, true);
+                }
             }
         }
         else
@@ -505,6 +542,115 @@ exit:
     }
 }
 
+void Dtls::RecordHandshakeFlight(bool aSent)
+{
+    uint8_t numFlights = mHandshakeInfo.mNumFlights;
+
+    VerifyOrExit(mSsl.state != MBEDTLS_SSL_HANDSHAKE_OVER);
+
+    // A record in the same direction as the previous one belongs to the same flight.
+    VerifyOrExit(numFlights == 0 || (((mHandshakeInfo.mFlightSentMask >> (numFlights - 1)) & 1) != 0) != aSent);
+    VerifyOrExit(numFlights < kMaxHandshakeFlights);
+
+    mHandshakeInfo.mFlightTime[numFlights] = TimerMilli::GetNow() - mHandshakeStartTime;
+
+    if (aSent)
+    {
+        mHandshakeInfo.mFlightSentMask |= (1 << numFlights);
+    }
+
+    mHandshakeInfo.mNumFlights++;
+
+exit:
+    return;
+}
+
+void Dtls::HandleHandshakeComplete(void)
+{
+    mHandshakeInfo.mDuration = TimerMilli::GetNow() - mHandshakeStartTime;
+    mHandshakeInfo.mComplete = true;
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    if (mClient)
+    {
+        // The server only returns the offered session ID when it resumes the session.
+        mHandshakeInfo.mResumed = mClientSessionOffered && (mSsl.session->id_len == mClientSession.mSession.id_len) &&
+                                  (memcmp(mSsl.session->id, mClientSession.mSession.id, mSsl.session->id_len) == 0);
+
+        if (!mHandshakeInfo.mResumed)
+        {
+            SaveSession(mClientSession, *mSsl.session);
+        }
+    }
+#endif
+
+    otLogInfoMeshCoP(GetInstance(), "DTLS handshake %s in %ums (%d flights)",
+                     mHandshakeInfo.mResumed ? "resumed" : "completed",
+                     static_cast<unsigned int>(mHandshakeInfo.mDuration), mHandshakeInfo.mNumFlights);
+}
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+bool Dtls::IsSessionUsable(const Session &aSession) const
+{
+    return aSession.mValid && (aSession.mSession.id_len != 0) && (aSession.mPskLength == mPskLength) &&
+           (memcmp(aSession.mPsk, mPsk, mPskLength) == 0) &&
+           (TimerMilli::GetNow() - aSession.mCreationTime <
+            TimerMilli::SecToMsec(OPENTHREAD_CONFIG_DTLS_SESSION_LIFETIME));
+}
+
+void Dtls::SaveSession(Session &aSession, const mbedtls_ssl_session &aSslSession)
+{
+    // With the EC-JPAKE cipher suite and without session tickets, the session holds no pointers.
+    memcpy(&aSession.mSession, &aSslSession, sizeof(aSession.mSession));
+    aSession.mCreationTime = TimerMilli::GetNow();
+    memcpy(aSession.mPsk, mPsk, mPskLength);
+    aSession.mPskLength = mPskLength;
+    aSession.mValid     = true;
+}
+
+int Dtls::HandleMbedtlsGetCache(void *aContext, mbedtls_ssl_session *aSession)
+{
+    return static_cast<Dtls *>(aContext)->HandleMbedtlsGetCache(*aSession);
+}
+
+int Dtls::HandleMbedtlsGetCache(mbedtls_ssl_session &aSession)
+{
+    int rval = 1;
+
+    // The session of the Client Hello has its ID, the other fields are taken from the session that is resumed.
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(mServerSessions); i++)
+    {
+        const mbedtls_ssl_session &session = mServerSessions[i].mSession;
+
+        if (IsSessionUsable(mServerSessions[i]) && (session.id_len == aSession.id_len) &&
+            (memcmp(session.id, aSession.id, session.id_len) == 0) && (session.ciphersuite == aSession.ciphersuite) &&
+            (session.compression == aSession.compression))
+        {
+            memcpy(aSession.master, session.master, sizeof(aSession.master));
+            aSession.verify_result  = session.verify_result;
+            mHandshakeInfo.mResumed = true;
+            ExitNow(rval = 0);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+int Dtls::HandleMbedtlsSetCache(void *aContext, const mbedtls_ssl_session *aSession)
+{
+    return static_cast<Dtls *>(aContext)->HandleMbedtlsSetCache(*aSession);
+}
+
+int Dtls::HandleMbedtlsSetCache(const mbedtls_ssl_session &aSession)
+{
+    SaveSession(mServerSessions[mNextServerSession], aSession);
+    mNextServerSession = (mNextServerSession + 1) % OT_ARRAY_LENGTH(mServerSessions);
+
+    return 0;
+}
+#endif // OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+
 otError Dtls::MapError(int rval)
 {
     otError error = OT_ERROR_NONE;
@@ -63,6 +63,24 @@ public:
     {
         kPskMaxLength             = 32,
         kApplicationDataMaxLength = 128,
+        kMaxHandshakeFlights      = 8,
+    };
+
+    /**
+     * This structure represents the timing of a handshake.
+     *
+     * A flight is a sequence of handshake records sent (or received) in a row, its time is the time at which its
+     * first record was sent (or received) in milliseconds since the DTLS service was started.
+     *
+     */
+    struct HandshakeInfo
+    {
+        uint32_t mFlightTime[kMaxHandshakeFlights]; ///< The time of each flight.
+        uint8_t  mFlightSentMask;                   ///< Bit N is set if flight N was sent, clear if it was received.
+        uint8_t  mNumFlights;                       ///< The number of flights (at most `kMaxHandshakeFlights`).
+        uint32_t mDuration;                         ///< The time at which the handshake completed.
+        bool     mComplete : 1;                     ///< TRUE if the handshake completed.
+        bool     mResumed : 1;                      ///< TRUE if a previous session was resumed.
     };
 
     /**
@@ -201,6 +219,14 @@ public:
      */
     void SetDefaultMessageSubType(uint8_t aMessageSubType) { mMessageDefaultSubType = aMessageSubType; }
 
+    /**
+     * This method returns the timing of the last (or current) handshake.
+     *
+     * @returns A reference to the handshake timing.
+     *
+     */
+    const HandshakeInfo &GetHandshakeInfo(void) const { return mHandshakeInfo; }
+
     /**
      * The provisioning URL is placed here so that both the Commissioner and Joiner can share the same object.
      *
@@ -236,6 +262,14 @@ private:
                                        size_t               aKeyLength,
                                        size_t               aIvLength);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    static int HandleMbedtlsGetCache(void *aContext, mbedtls_ssl_session *aSession);
+    int        HandleMbedtlsGetCache(mbedtls_ssl_session &aSession);
+
+    static int HandleMbedtlsSetCache(void *aContext, const mbedtls_ssl_session *aSession);
+    int        HandleMbedtlsSetCache(const mbedtls_ssl_session &aSession);
+#endif
+
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
@@ -243,6 +277,22 @@ private:
 
     void Close(void);
     void Process(void);
+    void RecordHandshakeFlight(bool aSent);
+    void HandleHandshakeComplete(void);
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    struct Session
+    {
+        mbedtls_ssl_session mSession;
+        uint32_t            mCreationTime;
+        uint8_t             mPsk[kPskMaxLength];
+        uint8_t             mPskLength;
+        bool                mValid;
+    };
+
+    bool IsSessionUsable(const Session &aSession) const;
+    void SaveSession(Session &aSession, const mbedtls_ssl_session &aSslSession);
+#endif
 
     uint8_t mPsk[kPskMaxLength];
     uint8_t mPskLength;
@@ -270,6 +320,16 @@ private:
 
     uint8_t mMessageSubType;
     uint8_t mMessageDefaultSubType;
+
+    uint32_t      mHandshakeStartTime;
+    HandshakeInfo mHandshakeInfo;
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    Session mClientSession;
+    Session mServerSessions[OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE];
+    uint8_t mNextServerSession;
+    bool    mClientSessionOffered;
+#endif
 };
 
 } // namespace MeshCoP
@@ -61,11 +61,15 @@ JoinerRouter::JoinerRouter(Instance &aInstance)
     , mSocket(aInstance.GetThreadNetif().GetIp6().GetUdp())
     , mRelayTransmit(OT_URI_PATH_RELAY_TX, &JoinerRouter::HandleRelayTransmit, this)
     , mTimer(aInstance, &JoinerRouter::HandleTimer, this)
-    , mNotifierCallback(&JoinerRouter::HandleStateChanged, this)
+    , mRelayTimer(aInstance, &JoinerRouter::HandleRelayTimer, this)
+    , mNotifierCallback(&JoinerRouter::HandleStateChanged, this, OT_CHANGED_THREAD_NETDATA)
     , mJoinerUdpPort(0)
+    , mRelayBatchWindow(kRelayBatchWindow)
     , mIsJoinerPortConfigured(false)
     , mExpectJoinEntRsp(false)
 {
+    memset(mJoiners, 0, sizeof(mJoiners));
+    memset(&mCounters, 0, sizeof(mCounters));
     mSocket.GetSockName().mPort = OPENTHREAD_CONFIG_JOINER_UDP_PORT;
     GetNetif().GetCoap().AddResource(mRelayTransmit);
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
@@ -99,6 +103,7 @@ void JoinerRouter::HandleStateChanged(uint32_t aFlags)
     else
     {
         mSocket.Close();
+        RemoveAllJoiners();
     }
 
 exit:
@@ -153,21 +158,91 @@ void JoinerRouter::HandleUdpReceive(void *aContext, otMessage *aMessage, const o
 }
 
 void JoinerRouter::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    otError        error;
+    Joiner *       joiner;
+    const uint8_t *iid  = aMessageInfo.GetPeerAddr().mFields.m8 + 8;
+    uint16_t       port = aMessageInfo.GetPeerPort();
+    uint16_t       borderAgentRloc;
+
+    otLogInfoMeshCoP(GetInstance(), "JoinerRouter::HandleUdpReceive");
+
+    SuccessOrExit(error = GetBorderAgentRloc(borderAgentRloc));
+
+    if ((joiner = FindJoiner(iid, port)) == NULL && (joiner = AddJoiner(iid, port)) == NULL)
+    {
+        otLogInfoMeshCoP(GetInstance(), "Joiner Router: relaying %d joiners, dropping datagram", kMaxJoiners);
+        mCounters.mJoinersRejected++;
+        ExitNow(error = OT_ERROR_BUSY);
+    }
+
+    joiner->mLastActivity = TimerMilli::GetNow();
+
+    SuccessOrExit(error = AppendToRelayBatch(*joiner, aMessage));
+
+exit:
+
+    if (error != OT_ERROR_NONE && error != OT_ERROR_BUSY)
+    {
+        mCounters.mRelayRxDrops++;
+    }
+
+    // A Joiner may have been added, evicted or given a batch even if the datagram could not be relayed.
+    ScheduleRelayTimer();
+}
+
+otError JoinerRouter::AppendToRelayBatch(Joiner &aJoiner, Message &aMessage)
+{
+    otError     error  = OT_ERROR_NONE;
+    uint16_t    length = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t    batchLength;
+    ExtendedTlv tlv;
+
+    // DTLS allows several records in a datagram, so the datagrams of a Joiner are relayed back to back in the Joiner
+    // DTLS Encapsulation TLV and the Commissioner receives them as a single datagram.
+    if (aJoiner.mRelayBatch != NULL)
+    {
+        aJoiner.mRelayBatch->Read(aJoiner.mBatchTlvOffset, sizeof(tlv), &tlv);
+
+        if (tlv.GetLength() + length > kRelayBatchMaxLength)
+        {
+            SendRelayBatch(aJoiner);
+        }
+    }
+
+    if (aJoiner.mRelayBatch == NULL)
+    {
+        SuccessOrExit(error = NewRelayBatch(aJoiner));
+        aJoiner.mRelayBatch->Read(aJoiner.mBatchTlvOffset, sizeof(tlv), &tlv);
+    }
+
+    batchLength = aJoiner.mRelayBatch->GetLength();
+    SuccessOrExit(error = aJoiner.mRelayBatch->SetLength(batchLength + length));
+    aMessage.CopyTo(aMessage.GetOffset(), batchLength, length, *aJoiner.mRelayBatch);
+
+    tlv.SetLength(tlv.GetLength() + length);
+    aJoiner.mRelayBatch->Write(aJoiner.mBatchTlvOffset, sizeof(tlv), &tlv);
+    aJoiner.mBatchDatagrams++;
+
+    if (mRelayBatchWindow == 0)
+    {
+        SendRelayBatch(aJoiner);
+    }
+
+exit:
+    return error;
+}
+
+otError JoinerRouter::NewRelayBatch(Joiner &aJoiner)
 {
     ThreadNetif &          netif = GetNetif();
     otError                error;
     Message *              message = NULL;
     Coap::Header           header;
-    Ip6::MessageInfo       messageInfo;
     JoinerUdpPortTlv       udpPort;
     JoinerIidTlv           iid;
     JoinerRouterLocatorTlv rloc;
     ExtendedTlv            tlv;
-    uint16_t               borderAgentRloc;
-
-    otLogInfoMeshCoP(GetInstance(), "JoinerRouter::HandleUdpReceive");
-
-    SuccessOrExit(error = GetBorderAgentRloc(borderAgentRloc));
 
     header.Init(OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST);
     header.SetToken(Coap::Header::kDefaultTokenLength);
@@ -177,36 +252,50 @@ void JoinerRouter::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &a
     VerifyOrExit((message = NewMeshCoPMessage(netif.GetCoap(), header)) != NULL, error = OT_ERROR_NO_BUFS);
 
     udpPort.Init();
-    udpPort.SetUdpPort(aMessageInfo.GetPeerPort());
+    udpPort.SetUdpPort(aJoiner.mPort);
     SuccessOrExit(error = message->Append(&udpPort, sizeof(udpPort)));
 
     iid.Init();
-    iid.SetIid(aMessageInfo.GetPeerAddr().mFields.m8 + 8);
+    iid.SetIid(aJoiner.mIid);
     SuccessOrExit(error = message->Append(&iid, sizeof(iid)));
 
     rloc.Init();
     rloc.SetJoinerRouterLocator(netif.GetMle().GetRloc16());
     SuccessOrExit(error = message->Append(&rloc, sizeof(rloc)));
 
+    aJoiner.mBatchTlvOffset = message->GetLength();
     tlv.SetType(Tlv::kJoinerDtlsEncapsulation);
-    tlv.SetLength(aMessage.GetLength() - aMessage.GetOffset());
+    tlv.SetLength(0);
     SuccessOrExit(error = message->Append(&tlv, sizeof(tlv)));
 
-    while (aMessage.GetOffset() < aMessage.GetLength())
+    aJoiner.mRelayBatch     = message;
+    aJoiner.mBatchTime      = TimerMilli::GetNow();
+    aJoiner.mBatchDatagrams = 0;
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
     {
-        uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
-        uint8_t  tmp[16];
+        message->Free();
+    }
 
-        if (length >= sizeof(tmp))
-        {
-            length = sizeof(tmp);
-        }
+    return error;
+}
 
-        aMessage.Read(aMessage.GetOffset(), length, tmp);
-        aMessage.MoveOffset(length);
+otError JoinerRouter::SendRelayBatch(Joiner &aJoiner)
+{
+    ThreadNetif &    netif   = GetNetif();
+    otError          error   = OT_ERROR_NONE;
+    Message *        message = aJoiner.mRelayBatch;
+    uint32_t         now     = TimerMilli::GetNow();
+    uint32_t         delay   = now - aJoiner.mBatchTime;
+    Ip6::MessageInfo messageInfo;
+    uint16_t         borderAgentRloc;
 
-        SuccessOrExit(error = message->Append(tmp, length));
-    }
+    VerifyOrExit(message != NULL);
+    aJoiner.mRelayBatch = NULL;
+
+    SuccessOrExit(error = GetBorderAgentRloc(borderAgentRloc));
 
     messageInfo.SetSockAddr(netif.GetMle().GetMeshLocal16());
     messageInfo.SetPeerAddr(netif.GetMle().GetMeshLocal16());
@@ -215,14 +304,191 @@ void JoinerRouter::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &a
 
     SuccessOrExit(error = netif.GetCoap().SendMessage(*message, messageInfo));
 
-    otLogInfoMeshCoP(GetInstance(), "Sent relay rx");
+    otLogInfoMeshCoP(GetInstance(), "Sent relay rx (%d datagrams)", aJoiner.mBatchDatagrams);
+
+    mCounters.mRelayRxMessages++;
+    mCounters.mRelayRxDatagrams += aJoiner.mBatchDatagrams;
+    mCounters.mTotalBatchDelay += delay;
+
+    if (delay > mCounters.mMaxBatchDelay)
+    {
+        mCounters.mMaxBatchDelay = delay;
+    }
+
+    aJoiner.mRelayRxTime = now;
+    aJoiner.mAwaitingTx  = true;
 
 exit:
 
-    if (error != OT_ERROR_NONE && message != NULL)
+    if (error != OT_ERROR_NONE)
     {
+        mCounters.mRelayRxDrops += aJoiner.mBatchDatagrams;
         message->Free();
     }
+
+    return error;
+}
+
+JoinerRouter::Joiner *JoinerRouter::FindJoiner(const uint8_t *aIid, uint16_t aPort)
+{
+    Joiner *rval = NULL;
+
+    for (Joiner *joiner = &mJoiners[0]; joiner < &mJoiners[kMaxJoiners]; joiner++)
+    {
+        if (joiner->mInUse && joiner->mPort == aPort && memcmp(joiner->mIid, aIid, sizeof(joiner->mIid)) == 0)
+        {
+            ExitNow(rval = joiner);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+JoinerRouter::Joiner *JoinerRouter::AddJoiner(const uint8_t *aIid, uint16_t aPort)
+{
+    Joiner *rval = NULL;
+
+    for (Joiner *joiner = &mJoiners[0]; joiner < &mJoiners[kMaxJoiners]; joiner++)
+    {
+        if (!joiner->mInUse)
+        {
+            rval = joiner;
+            break;
+        }
+
+        // A Joiner which already got its KEK only keeps its entry until another Joiner needs it.
+        if (joiner->mEntrusted && joiner->mRelayBatch == NULL && rval == NULL)
+        {
+            rval = joiner;
+        }
+    }
+
+    VerifyOrExit(rval != NULL);
+
+    if (rval->mInUse)
+    {
+        RemoveJoiner(*rval);
+    }
+
+    memset(rval, 0, sizeof(*rval));
+    memcpy(rval->mIid, aIid, sizeof(rval->mIid));
+    rval->mPort  = aPort;
+    rval->mInUse = true;
+
+    mCounters.mActiveJoiners++;
+
+    if (mCounters.mActiveJoiners > mCounters.mMaxActiveJoiners)
+    {
+        mCounters.mMaxActiveJoiners = mCounters.mActiveJoiners;
+    }
+
+exit:
+    return rval;
+}
+
+void JoinerRouter::RemoveJoiner(Joiner &aJoiner)
+{
+    if (aJoiner.mRelayBatch != NULL)
+    {
+        mCounters.mRelayRxDrops += aJoiner.mBatchDatagrams;
+        aJoiner.mRelayBatch->Free();
+        aJoiner.mRelayBatch = NULL;
+    }
+
+    aJoiner.mInUse = false;
+    mCounters.mActiveJoiners--;
+}
+
+void JoinerRouter::RemoveAllJoiners(void)
+{
+    for (Joiner *joiner = &mJoiners[0]; joiner < &mJoiners[kMaxJoiners]; joiner++)
+    {
+        if (joiner->mInUse)
+        {
+            RemoveJoiner(*joiner);
+        }
+    }
+
+    mRelayTimer.Stop();
+}
+
+void JoinerRouter::ScheduleRelayTimer(void)
+{
+    uint32_t now      = TimerMilli::GetNow();
+    bool     schedule = false;
+    uint32_t delay    = 0;
+
+    for (Joiner *joiner = &mJoiners[0]; joiner < &mJoiners[kMaxJoiners]; joiner++)
+    {
+        int32_t remaining;
+
+        if (!joiner->mInUse)
+        {
+            continue;
+        }
+
+        if (joiner->mRelayBatch != NULL)
+        {
+            remaining = static_cast<int32_t>(joiner->mBatchTime + mRelayBatchWindow - now);
+        }
+        else
+        {
+            remaining = static_cast<int32_t>(joiner->mLastActivity + kJoinerTimeout - now);
+        }
+
+        if (remaining < 0)
+        {
+            remaining = 0;
+        }
+
+        if (!schedule || static_cast<uint32_t>(remaining) < delay)
+        {
+            delay = static_cast<uint32_t>(remaining);
+        }
+
+        schedule = true;
+    }
+
+    if (schedule)
+    {
+        mRelayTimer.Start(delay);
+    }
+    else
+    {
+        mRelayTimer.Stop();
+    }
+}
+
+void JoinerRouter::HandleRelayTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<JoinerRouter>().HandleRelayTimer();
+}
+
+void JoinerRouter::HandleRelayTimer(void)
+{
+    uint32_t now = TimerMilli::GetNow();
+
+    for (Joiner *joiner = &mJoiners[0]; joiner < &mJoiners[kMaxJoiners]; joiner++)
+    {
+        if (!joiner->mInUse)
+        {
+            continue;
+        }
+
+        if (joiner->mRelayBatch != NULL && static_cast<int32_t>(now - joiner->mBatchTime - mRelayBatchWindow) >= 0)
+        {
+            SendRelayBatch(*joiner);
+        }
+
+        if (joiner->mRelayBatch == NULL && static_cast<int32_t>(now - joiner->mLastActivity - kJoinerTimeout) >= 0)
+        {
+            otLogInfoMeshCoP(GetInstance(), "Joiner Router: joiner timed out");
+            RemoveJoiner(*joiner);
+        }
+    }
+
+    ScheduleRelayTimer();
 }
 
 void JoinerRouter::HandleRelayTransmit(void *               aContext,
@@ -245,6 +511,7 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
     uint16_t           length;
     Message *          message = NULL;
     Ip6::MessageInfo   messageInfo;
+    Joiner *           joiner;
 
     VerifyOrExit(aHeader.GetType() == OT_COAP_TYPE_NON_CONFIRMABLE && aHeader.GetCode() == OT_COAP_CODE_POST,
                  error = OT_ERROR_DROP);
@@ -288,11 +555,41 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
     messageInfo.SetInterfaceId(GetNetif().GetInterfaceId());
 
     SuccessOrExit(error = mSocket.SendTo(*message, messageInfo));
+    mCounters.mRelayTxMessages++;
+
+    joiner = FindJoiner(joinerIid.GetIid(), joinerPort.GetUdpPort());
+
+    if (joiner != NULL)
+    {
+        uint32_t now = TimerMilli::GetNow();
+
+        joiner->mLastActivity = now;
+
+        if (joiner->mAwaitingTx)
+        {
+            uint32_t latency = now - joiner->mRelayRxTime;
+
+            mCounters.mRelayLatencySamples++;
+            mCounters.mTotalRelayLatency += latency;
+
+            if (latency > mCounters.mMaxRelayLatency)
+            {
+                mCounters.mMaxRelayLatency = latency;
+            }
+
+            joiner->mAwaitingTx = false;
+        }
+    }
 
     if (Tlv::GetTlv(aMessage, Tlv::kJoinerRouterKek, sizeof(kek), kek) == OT_ERROR_NONE)
     {
         otLogInfoMeshCoP(GetInstance(), "Received kek");
 
+        if (joiner != NULL)
+        {
+            joiner->mEntrusted = true;
+        }
+
         DelaySendingJoinerEntrust(messageInfo, kek);
     }
 
@@ -398,10 +695,31 @@ otError JoinerRouter::DelaySendingJoinerEntrust(const Ip6::MessageInfo &aMessage
     messageInfo = aMessageInfo;
     messageInfo.SetPeerPort(kCoapUdpPort);
 
+    // A KEK relayed again for the same Joiner replaces its entrust message that is still waiting.
+    for (Message *queued = mDelayedJoinEnts.GetHead(); queued != NULL; queued = queued->GetNext())
+    {
+        DelayedJoinEntHeader queuedJoinEnt;
+
+        queuedJoinEnt.ReadFrom(*queued);
+
+        if (queuedJoinEnt.GetMessageInfo()->GetPeerAddr() == messageInfo.GetPeerAddr())
+        {
+            mDelayedJoinEnts.Dequeue(*queued);
+            queued->Free();
+            mCounters.mEntrustQueueDepth--;
+            break;
+        }
+    }
+
     delayedMessage = DelayedJoinEntHeader(TimerMilli::GetNow() + kDelayJoinEnt, messageInfo, aKek.GetKek());
     SuccessOrExit(delayedMessage.AppendTo(*message));
     mDelayedJoinEnts.Enqueue(*message);
 
+    if (++mCounters.mEntrustQueueDepth > mCounters.mMaxEntrustQueueDepth)
+    {
+        mCounters.mMaxEntrustQueueDepth = mCounters.mEntrustQueueDepth;
+    }
+
     if (!mTimer.IsRunning())
     {
         mTimer.Start(kDelayJoinEnt);
@@ -451,6 +769,7 @@ void JoinerRouter::SendDelayedJoinerEntrust(void)
     else
     {
         mDelayedJoinEnts.Dequeue(*message);
+        mCounters.mEntrustQueueDepth--;
 
         // Remove the DelayedJoinEntHeader from the message.
         DelayedJoinEntHeader::RemoveFrom(*message);
@@ -82,10 +82,51 @@ public:
      */
     otError SetJoinerUdpPort(uint16_t aJoinerUdpPort);
 
+    /**
+     * This method returns the relay counters.
+     *
+     * @returns A reference to the relay counters.
+     *
+     */
+    const otJoinerRouterCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method sets the time a datagram from a Joiner is held to be relayed with the datagrams that follow it.
+     *
+     * The window is initialized from `OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_WINDOW`.
+     *
+     * @param[in]  aWindow  The window in milliseconds, or 0 to relay every datagram on its own.
+     *
+     */
+    void SetRelayBatchWindow(uint16_t aWindow) { mRelayBatchWindow = aWindow; }
+
 private:
     enum
     {
-        kDelayJoinEnt = 50, ///< milliseconds
+        kDelayJoinEnt        = 50, ///< milliseconds
+        kMaxJoiners          = OPENTHREAD_CONFIG_JOINER_ROUTER_MAX_JOINERS,
+        kJoinerTimeout       = OPENTHREAD_CONFIG_JOINER_ROUTER_JOINER_TIMEOUT * 1000, ///< milliseconds
+        kRelayBatchWindow    = OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_WINDOW,    ///< milliseconds
+        kRelayBatchMaxLength = OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_SIZE,
+    };
+
+    /**
+     * This structure represents a Joiner being relayed.
+     *
+     */
+    struct Joiner
+    {
+        Message *mRelayBatch;      ///< The Relay Receive notification being filled (NULL if none).
+        uint32_t mLastActivity;    ///< Time of the last datagram from or to the Joiner.
+        uint32_t mBatchTime;       ///< Time the first datagram in `mRelayBatch` was received.
+        uint32_t mRelayRxTime;     ///< Time the last Relay Receive notification was sent.
+        uint16_t mBatchTlvOffset;  ///< Offset of the Joiner DTLS Encapsulation TLV in `mRelayBatch`.
+        uint16_t mPort;            ///< The Joiner UDP port.
+        uint8_t  mIid[8];          ///< The Joiner IID.
+        uint8_t  mBatchDatagrams;  ///< The number of datagrams in `mRelayBatch`.
+        bool     mInUse : 1;       ///< TRUE if the entry is in use.
+        bool     mAwaitingTx : 1;  ///< TRUE if a Relay Transmit is expected since the last Relay Receive.
+        bool     mEntrusted : 1;   ///< TRUE if the KEK for the Joiner was received.
     };
 
     static void HandleStateChanged(Notifier::Callback &aCallback, uint32_t aFlags);
@@ -113,6 +154,19 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
+    static void HandleRelayTimer(Timer &aTimer);
+    void        HandleRelayTimer(void);
+
+    Joiner *FindJoiner(const uint8_t *aIid, uint16_t aPort);
+    Joiner *AddJoiner(const uint8_t *aIid, uint16_t aPort);
+    void    RemoveJoiner(Joiner &aJoiner);
+    void    RemoveAllJoiners(void);
+
+    otError AppendToRelayBatch(Joiner &aJoiner, Message &aMessage);
+    otError NewRelayBatch(Joiner &aJoiner);
+    otError SendRelayBatch(Joiner &aJoiner);
+    void    ScheduleRelayTimer(void);
+
     otError DelaySendingJoinerEntrust(const Ip6::MessageInfo &aMessageInfo, const JoinerRouterKekTlv &aKek);
     void    SendDelayedJoinerEntrust(void);
     otError SendJoinerEntrust(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
@@ -125,9 +179,15 @@ private:
     TimerMilli   mTimer;
     MessageQueue mDelayedJoinEnts;
 
+    TimerMilli mRelayTimer;
+    Joiner     mJoiners[kMaxJoiners];
+
+    otJoinerRouterCounters mCounters;
+
     Notifier::Callback mNotifierCallback;
 
     uint16_t mJoinerUdpPort;
+    uint16_t mRelayBatchWindow;
 
     bool mIsJoinerPortConfigured : 1;
     bool mExpectJoinEntRsp : 1;
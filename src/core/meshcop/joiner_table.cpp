@@ -0,0 +1,290 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the Commissioner's Joiner table.
+ */
+
+#include "joiner_table.hpp"
+
+#include "utils/wrap_string.h"
+
+#include "common/code_utils.hpp"
+#include "meshcop/meshcop.hpp"
+
+namespace ot {
+namespace MeshCoP {
+
+JoinerTable::JoinerTable(Entry *aEntries, uint16_t aNumEntries, uint16_t *aBuckets, uint16_t aNumBuckets)
+    : mEntries(aEntries)
+    , mBuckets(aBuckets)
+    , mNumEntries(aNumEntries)
+    , mNumBuckets(aNumBuckets)
+{
+    Clear();
+}
+
+void JoinerTable::Clear(void)
+{
+    for (uint16_t i = 0; i < mNumEntries; i++)
+    {
+        mEntries[i].mValid = false;
+        mEntries[i].mNext  = i + 1;
+    }
+
+    if (mNumEntries > 0)
+    {
+        mEntries[mNumEntries - 1].mNext = kInvalidIndex;
+    }
+
+    for (uint16_t i = 0; i < mNumBuckets; i++)
+    {
+        mBuckets[i] = kInvalidIndex;
+    }
+
+    memset(mBloomFilterCounts, 0, sizeof(mBloomFilterCounts));
+
+    mFreeHead = (mNumEntries > 0) ? 0 : static_cast<uint16_t>(kInvalidIndex);
+    mAnyIndex = kInvalidIndex;
+    mCount    = 0;
+}
+
+otError JoinerTable::Add(const Mac::ExtAddress *aEui64,
+                         const char *           aPsk,
+                         uint32_t               aExpirationTime,
+                         bool &                 aSteeringDataChanged)
+{
+    otError         error = OT_ERROR_NONE;
+    Mac::ExtAddress joinerId;
+    Entry *         entry;
+
+    aSteeringDataChanged = false;
+
+    if (aEui64 != NULL)
+    {
+        ComputeJoinerId(*aEui64, joinerId);
+        entry = FindInBucket(joinerId);
+    }
+    else
+    {
+        entry = (mAnyIndex != kInvalidIndex) ? &mEntries[mAnyIndex] : NULL;
+    }
+
+    if (entry == NULL)
+    {
+        VerifyOrExit(mFreeHead != kInvalidIndex, error = OT_ERROR_NO_BUFS);
+
+        entry     = &mEntries[mFreeHead];
+        mFreeHead = entry->mNext;
+
+        entry->mValid = true;
+        entry->mAny   = (aEui64 == NULL);
+        mCount++;
+
+        if (aEui64 != NULL)
+        {
+            uint16_t bucket = GetBucket(joinerId);
+
+            entry->mEui64    = *aEui64;
+            entry->mJoinerId = joinerId;
+            entry->mNext     = mBuckets[bucket];
+            mBuckets[bucket] = GetIndex(*entry);
+
+            aSteeringDataChanged = UpdateBloomFilter(joinerId, true);
+        }
+        else
+        {
+            entry->mNext         = kInvalidIndex;
+            mAnyIndex            = GetIndex(*entry);
+            aSteeringDataChanged = true;
+        }
+    }
+
+    (void)strlcpy(entry->mPsk, aPsk, sizeof(entry->mPsk));
+    entry->mExpirationTime = aExpirationTime;
+
+exit:
+    return error;
+}
+
+bool JoinerTable::Remove(Entry &aEntry)
+{
+    uint16_t index = GetIndex(aEntry);
+    bool     rval;
+
+    if (aEntry.mAny)
+    {
+        mAnyIndex = kInvalidIndex;
+        rval      = true;
+    }
+    else
+    {
+        uint16_t *next = &mBuckets[GetBucket(aEntry.mJoinerId)];
+
+        while (*next != index)
+        {
+            next = &mEntries[*next].mNext;
+        }
+
+        *next = aEntry.mNext;
+        rval  = UpdateBloomFilter(aEntry.mJoinerId, false);
+    }
+
+    aEntry.mValid = false;
+    aEntry.mNext  = mFreeHead;
+    mFreeHead     = index;
+    mCount--;
+
+    return rval;
+}
+
+JoinerTable::Entry *JoinerTable::Find(const Mac::ExtAddress *aEui64)
+{
+    Entry *entry = NULL;
+
+    if (aEui64 != NULL)
+    {
+        Mac::ExtAddress joinerId;
+
+        ComputeJoinerId(*aEui64, joinerId);
+        entry = FindInBucket(joinerId);
+    }
+    else if (mAnyIndex != kInvalidIndex)
+    {
+        entry = &mEntries[mAnyIndex];
+    }
+
+    return entry;
+}
+
+JoinerTable::Entry *JoinerTable::FindByJoinerId(const Mac::ExtAddress &aJoinerId)
+{
+    Entry *entry = FindInBucket(aJoinerId);
+
+    if (entry == NULL && mAnyIndex != kInvalidIndex)
+    {
+        entry = &mEntries[mAnyIndex];
+    }
+
+    return entry;
+}
+
+JoinerTable::Entry *JoinerTable::GetNext(Entry *aPrevEntry)
+{
+    Entry *entry = (aPrevEntry != NULL) ? aPrevEntry + 1 : mEntries;
+
+    for (; entry < mEntries + mNumEntries; entry++)
+    {
+        if (entry->mValid)
+        {
+            ExitNow();
+        }
+    }
+
+    entry = NULL;
+
+exit:
+    return entry;
+}
+
+void JoinerTable::GetSteeringData(SteeringDataTlv &aSteeringData) const
+{
+    aSteeringData.Init();
+
+    if (mAnyIndex != kInvalidIndex)
+    {
+        aSteeringData.SetLength(1);
+        aSteeringData.Set();
+        ExitNow();
+    }
+
+    for (uint8_t i = 0; i < kNumBloomFilterBits; i++)
+    {
+        if (mBloomFilterCounts[i] != 0)
+        {
+            aSteeringData.SetBit(i);
+        }
+    }
+
+exit:
+    return;
+}
+
+uint16_t JoinerTable::GetBucket(const Mac::ExtAddress &aJoinerId) const
+{
+    // The Joiner ID is taken from a SHA-256 hash, so any of its bytes will do (the first byte has the local bit set).
+    return static_cast<uint16_t>(((aJoinerId.m8[6] << 8) | aJoinerId.m8[7]) % mNumBuckets);
+}
+
+JoinerTable::Entry *JoinerTable::FindInBucket(const Mac::ExtAddress &aJoinerId)
+{
+    Entry *entry = NULL;
+
+    for (uint16_t index = mBuckets[GetBucket(aJoinerId)]; index != kInvalidIndex; index = mEntries[index].mNext)
+    {
+        if (mEntries[index].mJoinerId == aJoinerId)
+        {
+            ExitNow(entry = &mEntries[index]);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+bool JoinerTable::UpdateBloomFilter(const Mac::ExtAddress &aJoinerId, bool aAdd)
+{
+    SteeringDataTlv steeringData;
+    uint8_t         bits[2];
+    bool            rval = false;
+
+    steeringData.Init();
+    steeringData.ComputeBloomFilterBits(aJoinerId, bits[0], bits[1]);
+
+    // Each entry counts once per distinct bit, so that a count never exceeds the number of entries.
+    for (uint8_t i = 0; i < ((bits[0] == bits[1]) ? 1 : OT_ARRAY_LENGTH(bits)); i++)
+    {
+        uint16_t &count = mBloomFilterCounts[bits[i]];
+
+        if (aAdd)
+        {
+            rval |= (count++ == 0);
+        }
+        else
+        {
+            rval |= (--count == 0);
+        }
+    }
+
+    return rval;
+}
+
+} // namespace MeshCoP
+} // namespace ot
@@ -0,0 +1,198 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the Commissioner's Joiner table.
+ */
+
+#ifndef JOINER_TABLE_HPP_
+#define JOINER_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/types.h>
+
+#include "mac/mac_frame.hpp"
+#include "meshcop/dtls.hpp"
+#include "meshcop/meshcop_tlvs.hpp"
+
+namespace ot {
+namespace MeshCoP {
+
+/**
+ * This class implements the table of Joiners that a Commissioner accepts.
+ *
+ * The Joiner ID of each entry is computed once when the entry is added. The entries are kept in hash buckets keyed by
+ * the Joiner ID, so that looking up a Joiner from a relayed message takes constant time. The Steering Data Bloom
+ * Filter is maintained incrementally by counting the entries that set each of its bits.
+ *
+ * The storage for the entries and the hash buckets is provided by the owner of the table.
+ *
+ */
+class JoinerTable
+{
+public:
+    enum
+    {
+        kInvalidIndex = 0xffff, ///< Marks the end of a hash bucket or of the free list.
+    };
+
+    /**
+     * This structure represents a Joiner entry.
+     *
+     */
+    struct Entry
+    {
+        Mac::ExtAddress mEui64;                        ///< The Joiner's IEEE EUI-64 (unused for any Joiner).
+        Mac::ExtAddress mJoinerId;                     ///< The Joiner ID (unused for any Joiner).
+        uint32_t        mExpirationTime;               ///< The time at which the entry expires.
+        uint16_t        mNext;                         ///< The next entry in the hash bucket or the free list.
+        char            mPsk[Dtls::kPskMaxLength + 1]; ///< The Joiner's PSKd.
+        bool            mValid : 1;                    ///< TRUE if the entry is in use.
+        bool            mAny : 1;                      ///< TRUE if the entry accepts any Joiner.
+    };
+
+    /**
+     * This constructor initializes an empty Joiner table.
+     *
+     * @param[in]  aEntries     A pointer to the storage for the entries.
+     * @param[in]  aNumEntries  The number of entries in @p aEntries (less than `kInvalidIndex`).
+     * @param[in]  aBuckets     A pointer to the storage for the hash buckets.
+     * @param[in]  aNumBuckets  The number of hash buckets in @p aBuckets (at least one).
+     *
+     */
+    JoinerTable(Entry *aEntries, uint16_t aNumEntries, uint16_t *aBuckets, uint16_t aNumBuckets);
+
+    /**
+     * This method removes all entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method adds a Joiner entry, or updates the entry of the same Joiner.
+     *
+     * @param[in]   aEui64                A pointer to the Joiner's IEEE EUI-64 or NULL for any Joiner.
+     * @param[in]   aPsk                  A pointer to the PSKd (at most `Dtls::kPskMaxLength` characters).
+     * @param[in]   aExpirationTime       The time at which the entry expires.
+     * @param[out]  aSteeringDataChanged  Set to TRUE if the Steering Data changed, FALSE otherwise.
+     *
+     * @retval OT_ERROR_NONE     Successfully added or updated the entry.
+     * @retval OT_ERROR_NO_BUFS  The table is full.
+     *
+     */
+    otError Add(const Mac::ExtAddress *aEui64, const char *aPsk, uint32_t aExpirationTime, bool &aSteeringDataChanged);
+
+    /**
+     * This method removes an entry.
+     *
+     * @param[in]  aEntry  A reference to an entry of the table.
+     *
+     * @retval TRUE   If the Steering Data changed.
+     * @retval FALSE  If the Steering Data did not change.
+     *
+     */
+    bool Remove(Entry &aEntry);
+
+    /**
+     * This method finds the entry of a Joiner.
+     *
+     * @param[in]  aEui64  A pointer to the Joiner's IEEE EUI-64 or NULL for any Joiner.
+     *
+     * @returns A pointer to the entry or NULL if there is none.
+     *
+     */
+    Entry *Find(const Mac::ExtAddress *aEui64);
+
+    /**
+     * This method finds the entry accepting a Joiner, given its Joiner ID.
+     *
+     * The entry of the Joiner is preferred over an entry for any Joiner.
+     *
+     * @param[in]  aJoinerId  The Joiner ID.
+     *
+     * @returns A pointer to the entry or NULL if the Joiner is not accepted.
+     *
+     */
+    Entry *FindByJoinerId(const Mac::ExtAddress &aJoinerId);
+
+    /**
+     * This method iterates over the entries.
+     *
+     * The entry returned last may be removed before getting the next one.
+     *
+     * @param[in]  aPrevEntry  A pointer to the previous entry or NULL to get the first one.
+     *
+     * @returns A pointer to the next entry or NULL if there are no more.
+     *
+     */
+    Entry *GetNext(Entry *aPrevEntry);
+
+    /**
+     * This method returns the number of entries.
+     *
+     * @returns The number of entries.
+     *
+     */
+    uint16_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method gets the Steering Data for the entries.
+     *
+     * @param[out]  aSteeringData  A reference to the Steering Data TLV.
+     *
+     */
+    void GetSteeringData(SteeringDataTlv &aSteeringData) const;
+
+private:
+    enum
+    {
+        kNumBloomFilterBits = OT_STEERING_DATA_MAX_LENGTH * 8,
+    };
+
+    uint16_t GetBucket(const Mac::ExtAddress &aJoinerId) const;
+    uint16_t GetIndex(const Entry &aEntry) const { return static_cast<uint16_t>(&aEntry - mEntries); }
+    Entry *  FindInBucket(const Mac::ExtAddress &aJoinerId);
+    bool     UpdateBloomFilter(const Mac::ExtAddress &aJoinerId, bool aAdd);
+
+    Entry *   mEntries;
+    uint16_t *mBuckets;
+    uint16_t  mNumEntries;
+    uint16_t  mNumBuckets;
+    uint16_t  mFreeHead;
+    uint16_t  mAnyIndex;
+    uint16_t  mCount;
+    uint16_t  mBloomFilterCounts[kNumBloomFilterBits]; ///< Number of entries setting each bit (at most `mNumEntries`).
+};
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // JOINER_TABLE_HPP_
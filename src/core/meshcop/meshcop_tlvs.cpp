@@ -98,6 +98,16 @@ bool SteeringDataTlv::IsCleared(void) const
 }
 
 void SteeringDataTlv::ComputeBloomFilter(const otExtAddress &aJoinerId)
+{
+    uint8_t bit1;
+    uint8_t bit2;
+
+    ComputeBloomFilterBits(aJoinerId, bit1, bit2);
+    SetBit(bit1);
+    SetBit(bit2);
+}
+
+void SteeringDataTlv::ComputeBloomFilterBits(const otExtAddress &aJoinerId, uint8_t &aBit1, uint8_t &aBit2) const
 {
     Crc16 ccitt(Crc16::kCcitt);
     Crc16 ansi(Crc16::kAnsi);
@@ -109,8 +119,8 @@ void SteeringDataTlv::ComputeBloomFilter(const otExtAddress &aJoinerId)
         ansi.Update(byte);
     }
 
-    SetBit(ccitt.Get() % GetNumBits());
-    SetBit(ansi.Get() % GetNumBits());
+    aBit1 = static_cast<uint8_t>(ccitt.Get() % GetNumBits());
+    aBit2 = static_cast<uint8_t>(ansi.Get() % GetNumBits());
 }
 
 const ChannelMaskEntry *ChannelMaskEntry::GetNext(const Tlv *aChannelMaskTlv) const
@@ -694,6 +694,16 @@ public:
      */
     void ComputeBloomFilter(const otExtAddress &aJoinerId);
 
+    /**
+     * This method computes the two bits that the Bloom Filter sets for a Joiner ID.
+     *
+     * @param[in]   aJoinerId  The Joiner ID.
+     * @param[out]  aBit1      The first bit offset.
+     * @param[out]  aBit2      The second bit offset.
+     *
+     */
+    void ComputeBloomFilterBits(const otExtAddress &aJoinerId, uint8_t &aBit1, uint8_t &aBit2) const;
+
 private:
     uint8_t mSteeringData[OT_STEERING_DATA_MAX_LENGTH];
 } OT_TOOL_PACKED_END;
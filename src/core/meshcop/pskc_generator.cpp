@@ -0,0 +1,243 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the PSKc generation.
+ */
+
+#include "pskc_generator.hpp"
+
+#include "utils/wrap_string.h"
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/logging.hpp"
+#include "common/owner-locator.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER
+
+namespace ot {
+namespace MeshCoP {
+
+PskcGenerator::PskcGenerator(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mTasklet(aInstance, HandleTasklet, this)
+    , mCallback(NULL)
+    , mCallbackContext(NULL)
+    , mComputing(false)
+{
+    memset(mCache, 0, sizeof(mCache));
+}
+
+otError PskcGenerator::Compute(const char *   aPassPhrase,
+                               const char *   aNetworkName,
+                               const uint8_t *aExtPanId,
+                               uint8_t *      aPSKc)
+{
+    otError             error;
+    otPbkdf2CmacContext context;
+
+    SuccessOrExit(error = Start(context, aPassPhrase, aNetworkName, aExtPanId));
+    otPbkdf2CmacProcess(&context, kIterationCount);
+    otPbkdf2CmacFinish(&context, aPSKc);
+
+exit:
+    return error;
+}
+
+otError PskcGenerator::Generate(const char *   aPassPhrase,
+                                const char *   aNetworkName,
+                                const uint8_t *aExtPanId,
+                                uint8_t *      aPSKc)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t inputHash[Crypto::Sha256::kHashSize];
+
+    ComputeInputHash(aPassPhrase, aNetworkName, aExtPanId, inputHash);
+    VerifyOrExit(!GetFromCache(inputHash, aPSKc));
+
+    SuccessOrExit(error = Compute(aPassPhrase, aNetworkName, aExtPanId, aPSKc));
+    AddToCache(inputHash, aPSKc);
+
+exit:
+    return error;
+}
+
+otError PskcGenerator::GenerateAsync(const char *               aPassPhrase,
+                                     const char *               aNetworkName,
+                                     const uint8_t *            aExtPanId,
+                                     otCommissionerPSKcCallback aCallback,
+                                     void *                     aContext)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aCallback != NULL, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(!IsBusy(), error = OT_ERROR_BUSY);
+
+    ComputeInputHash(aPassPhrase, aNetworkName, aExtPanId, mInputHash);
+    mComputing = !GetFromCache(mInputHash, mPskc);
+
+    if (mComputing)
+    {
+        SuccessOrExit(error = Start(mPbkdf2, aPassPhrase, aNetworkName, aExtPanId));
+    }
+
+    mCallback        = aCallback;
+    mCallbackContext = aContext;
+    mTasklet.Post();
+
+exit:
+    return error;
+}
+
+void PskcGenerator::HandleTasklet(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<PskcGenerator>().HandleTasklet();
+}
+
+void PskcGenerator::HandleTasklet(void)
+{
+    otCommissionerPSKcCallback callback = mCallback;
+
+    VerifyOrExit(IsBusy());
+
+    if (mComputing)
+    {
+        if (!otPbkdf2CmacProcess(&mPbkdf2, OPENTHREAD_CONFIG_PSKC_ITERATIONS_PER_TASKLET))
+        {
+            mTasklet.Post();
+            ExitNow();
+        }
+
+        otPbkdf2CmacFinish(&mPbkdf2, mPskc);
+        AddToCache(mInputHash, mPskc);
+        mComputing = false;
+    }
+
+    otLogInfoMeshCoP(GetInstance(), "PSKc generated");
+
+    // The callback may start generating another PSKc.
+    mCallback = NULL;
+    callback(mPskc, mCallbackContext);
+
+exit:
+    return;
+}
+
+otError PskcGenerator::Start(otPbkdf2CmacContext &aContext,
+                             const char *         aPassPhrase,
+                             const char *         aNetworkName,
+                             const uint8_t *      aExtPanId)
+{
+    otError     error      = OT_ERROR_NONE;
+    const char *saltPrefix = "Thread";
+    uint8_t     salt[OT_PBKDF2_SALT_MAX_LEN];
+    uint16_t    saltLen = 0;
+
+    VerifyOrExit((strlen(aPassPhrase) >= OT_COMMISSIONING_PASSPHRASE_MIN_SIZE) &&
+                     (strlen(aPassPhrase) <= OT_COMMISSIONING_PASSPHRASE_MAX_SIZE),
+                 error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(strlen(aNetworkName) <= OT_NETWORK_NAME_MAX_SIZE, error = OT_ERROR_INVALID_ARGS);
+
+    memset(salt, 0, sizeof(salt));
+    memcpy(salt, saltPrefix, strlen(saltPrefix));
+    saltLen += static_cast<uint16_t>(strlen(saltPrefix));
+
+    memcpy(salt + saltLen, aExtPanId, OT_EXT_PAN_ID_SIZE);
+    saltLen += OT_EXT_PAN_ID_SIZE;
+
+    memcpy(salt + saltLen, aNetworkName, strlen(aNetworkName));
+    saltLen += static_cast<uint16_t>(strlen(aNetworkName));
+
+    otPbkdf2CmacStart(&aContext, reinterpret_cast<const uint8_t *>(aPassPhrase),
+                      static_cast<uint16_t>(strlen(aPassPhrase)), salt, saltLen, kIterationCount, 1);
+
+exit:
+    return error;
+}
+
+void PskcGenerator::ComputeInputHash(const char *   aPassPhrase,
+                                     const char *   aNetworkName,
+                                     const uint8_t *aExtPanId,
+                                     uint8_t *      aInputHash)
+{
+    Crypto::Sha256 sha256;
+
+    // The strings are hashed with their null terminators, so that their boundaries are unambiguous.
+    sha256.Start();
+    sha256.Update(reinterpret_cast<const uint8_t *>(aPassPhrase), static_cast<uint16_t>(strlen(aPassPhrase) + 1));
+    sha256.Update(reinterpret_cast<const uint8_t *>(aNetworkName), static_cast<uint16_t>(strlen(aNetworkName) + 1));
+    sha256.Update(aExtPanId, OT_EXT_PAN_ID_SIZE);
+    sha256.Finish(aInputHash);
+}
+
+bool PskcGenerator::GetFromCache(const uint8_t *aInputHash, uint8_t *aPSKc)
+{
+    bool rval = false;
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mCache); i++)
+    {
+        if (mCache[i].mValid && memcmp(mCache[i].mInputHash, aInputHash, sizeof(mCache[i].mInputHash)) == 0)
+        {
+            memcpy(aPSKc, mCache[i].mPskc, sizeof(mCache[i].mPskc));
+            AddToCache(aInputHash, aPSKc);
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+void PskcGenerator::AddToCache(const uint8_t *aInputHash, const uint8_t *aPSKc)
+{
+    size_t i;
+
+    // The entries are kept from the most to the least recently used, the entry of the inputs (if any) or the least
+    // recently used one makes room for the new first entry.
+    for (i = 0; i < OT_ARRAY_LENGTH(mCache) - 1; i++)
+    {
+        if (mCache[i].mValid && memcmp(mCache[i].mInputHash, aInputHash, sizeof(mCache[i].mInputHash)) == 0)
+        {
+            break;
+        }
+    }
+
+    memmove(&mCache[1], &mCache[0], i * sizeof(mCache[0]));
+
+    memcpy(mCache[0].mInputHash, aInputHash, sizeof(mCache[0].mInputHash));
+    memcpy(mCache[0].mPskc, aPSKc, sizeof(mCache[0].mPskc));
+    mCache[0].mValid = true;
+}
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER
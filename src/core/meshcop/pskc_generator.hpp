@@ -0,0 +1,170 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the PSKc generation.
+ */
+
+#ifndef PSKC_GENERATOR_HPP_
+#define PSKC_GENERATOR_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/commissioner.h>
+
+#include "common/locator.hpp"
+#include "common/tasklet.hpp"
+#include "crypto/pbkdf2_cmac.h"
+#include "crypto/sha256.hpp"
+
+#if OPENTHREAD_CONFIG_PSKC_CACHE_SIZE < 1
+#error OPENTHREAD_CONFIG_PSKC_CACHE_SIZE should be at least set to 1.
+#endif
+
+namespace ot {
+
+namespace MeshCoP {
+
+/**
+ * This class implements the PSKc generation, which runs 16384 PBKDF2 iterations.
+ *
+ * The PSKc values are cached along with a hash of the inputs they were generated from, and may be generated in steps
+ * from tasklets so that the generation does not block other processing.
+ *
+ */
+class PskcGenerator : public InstanceLocator
+{
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit PskcGenerator(Instance &aInstance);
+
+    /**
+     * This static method computes PSKc, without using the cache.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+     * @param[out] aPSKc         A pointer to where the generated PSKc will be placed.
+     *
+     * @retval OT_ERROR_NONE          Successfully generate PSKc.
+     * @retval OT_ERROR_INVALID_ARGS  If the length of passphrase is out of range.
+     *
+     */
+    static otError Compute(const char *aPassPhrase, const char *aNetworkName, const uint8_t *aExtPanId, uint8_t *aPSKc);
+
+    /**
+     * This method generates PSKc, or gets it from the cache.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+     * @param[out] aPSKc         A pointer to where the generated PSKc will be placed.
+     *
+     * @retval OT_ERROR_NONE          Successfully generate PSKc.
+     * @retval OT_ERROR_INVALID_ARGS  If the length of passphrase is out of range.
+     *
+     */
+    otError Generate(const char *aPassPhrase, const char *aNetworkName, const uint8_t *aExtPanId, uint8_t *aPSKc);
+
+    /**
+     * This method starts generating PSKc from tasklets, or gets it from the cache.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+     * @param[in]  aCallback     A pointer to a function called from a tasklet once the PSKc is generated.
+     * @param[in]  aContext      A pointer to application-specific context.
+     *
+     * @retval OT_ERROR_NONE          Successfully started generating PSKc.
+     * @retval OT_ERROR_INVALID_ARGS  If the length of passphrase is out of range.
+     * @retval OT_ERROR_BUSY          A PSKc is already being generated.
+     *
+     */
+    otError GenerateAsync(const char *               aPassPhrase,
+                          const char *               aNetworkName,
+                          const uint8_t *            aExtPanId,
+                          otCommissionerPSKcCallback aCallback,
+                          void *                     aContext);
+
+    /**
+     * This method indicates whether or not a PSKc is being generated from tasklets.
+     *
+     * @retval TRUE   If a PSKc is being generated.
+     * @retval FALSE  If no PSKc is being generated.
+     *
+     */
+    bool IsBusy(void) const { return mCallback != NULL; }
+
+private:
+    enum
+    {
+        kIterationCount = 16384,
+    };
+
+    struct CacheEntry
+    {
+        uint8_t mInputHash[Crypto::Sha256::kHashSize];
+        uint8_t mPskc[OT_PSKC_MAX_SIZE];
+        bool    mValid;
+    };
+
+    static otError Start(otPbkdf2CmacContext &aContext,
+                         const char *         aPassPhrase,
+                         const char *         aNetworkName,
+                         const uint8_t *      aExtPanId);
+    static void    ComputeInputHash(const char *   aPassPhrase,
+                                    const char *   aNetworkName,
+                                    const uint8_t *aExtPanId,
+                                    uint8_t *      aInputHash);
+    bool           GetFromCache(const uint8_t *aInputHash, uint8_t *aPSKc);
+    void           AddToCache(const uint8_t *aInputHash, const uint8_t *aPSKc);
+
+    static void HandleTasklet(Tasklet &aTasklet);
+    void        HandleTasklet(void);
+
+    otPbkdf2CmacContext        mPbkdf2;
+    Tasklet                    mTasklet;
+    otCommissionerPSKcCallback mCallback;
+    void *                     mCallbackContext;
+    bool                       mComputing;
+    uint8_t                    mInputHash[Crypto::Sha256::kHashSize];
+    uint8_t                    mPskc[OT_PSKC_MAX_SIZE];
+    CacheEntry                 mCache[OPENTHREAD_CONFIG_PSKC_CACHE_SIZE];
+};
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // PSKC_GENERATOR_HPP_
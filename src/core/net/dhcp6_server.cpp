@@ -280,29 +280,71 @@ void Dhcp6Server::ProcessSolicit(Message &aMessage, otIp6Address &aDst, uint8_t
 {
     IaNa             iana;
     ClientIdentifier clientIdentifier;
-    uint16_t         optionOffset;
-    uint16_t         offset = aMessage.GetOffset();
-    uint16_t         length = aMessage.GetLength() - aMessage.GetOffset();
+    Dhcp6Option      option;
+    uint16_t         offset            = aMessage.GetOffset();
+    uint16_t         end               = aMessage.GetLength();
+    uint16_t         clientOffset      = 0;
+    uint16_t         elapsedTimeOffset = 0;
+    uint16_t         ianaOffset        = 0;
+    bool             serverIdentifier  = false;
+    bool             rapidCommit       = false;
+
+    // Walk the options once, remembering the first occurrence of each option a Solicit is answered from.
+    while (offset + sizeof(option) <= end)
+    {
+        VerifyOrExit(aMessage.Read(offset, sizeof(option), &option) == sizeof(option));
+
+        // Discard the Solicit if an option runs past its end.
+        VerifyOrExit(option.GetLength() <= end - offset - sizeof(option));
+
+        switch (option.GetCode())
+        {
+        case kOptionClientIdentifier:
+            clientOffset = (clientOffset == 0) ? offset : clientOffset;
+            break;
+
+        case kOptionServerIdentifier:
+            serverIdentifier = true;
+            break;
+
+        case kOptionRapidCommit:
+            rapidCommit = true;
+            break;
+
+        case kOptionElapsedTime:
+            elapsedTimeOffset = (elapsedTimeOffset == 0) ? offset : elapsedTimeOffset;
+            break;
+
+        case kOptionIaNa:
+            ianaOffset = (ianaOffset == 0) ? offset : ianaOffset;
+            break;
+
+        default:
+            break;
+        }
+
+        offset += sizeof(option) + option.GetLength();
+    }
 
     // Client Identifier (discard if not present)
-    VerifyOrExit((optionOffset = FindOption(aMessage, offset, length, kOptionClientIdentifier)) > 0);
-    SuccessOrExit(ProcessClientIdentifier(aMessage, optionOffset, clientIdentifier));
+    VerifyOrExit(clientOffset > 0);
+    SuccessOrExit(ProcessClientIdentifier(aMessage, clientOffset, clientIdentifier));
 
     // Server Identifier (assuming Rapid Commit, discard if present)
-    VerifyOrExit(FindOption(aMessage, offset, length, kOptionServerIdentifier) == 0);
+    VerifyOrExit(!serverIdentifier);
 
     // Rapid Commit (assuming Rapid Commit, discard if not present)
-    VerifyOrExit(FindOption(aMessage, offset, length, kOptionRapidCommit) > 0);
+    VerifyOrExit(rapidCommit);
 
     // Elapsed Time if present
-    if ((optionOffset = FindOption(aMessage, offset, length, kOptionElapsedTime)) > 0)
+    if (elapsedTimeOffset > 0)
     {
-        SuccessOrExit(ProcessElapsedTime(aMessage, optionOffset));
+        SuccessOrExit(ProcessElapsedTime(aMessage, elapsedTimeOffset));
     }
 
     // IA_NA (discard if not present)
-    VerifyOrExit((optionOffset = FindOption(aMessage, offset, length, kOptionIaNa)) > 0);
-    SuccessOrExit(ProcessIaNa(aMessage, optionOffset, iana));
+    VerifyOrExit(ianaOffset > 0);
+    SuccessOrExit(ProcessIaNa(aMessage, ianaOffset, iana));
 
     SuccessOrExit(SendReply(aDst, aTransactionId, clientIdentifier, iana));
 
@@ -310,26 +352,34 @@ exit:
     return;
 }
 
-uint16_t Dhcp6Server::FindOption(Message &aMessage, uint16_t aOffset, uint16_t aLength, Code aCode)
+otError Dhcp6Server::FindOption(Message & aMessage,
+                                uint16_t  aOffset,
+                                uint16_t  aLength,
+                                Code      aCode,
+                                uint16_t &aOptionOffset)
 {
-    uint16_t end = aOffset + aLength;
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint16_t end   = aOffset + aLength;
 
-    while (aOffset <= end)
+    while (aOffset + sizeof(Dhcp6Option) <= end)
     {
         Dhcp6Option option;
-        VerifyOrExit(aMessage.Read(aOffset, sizeof(option), &option) == sizeof(option));
+        VerifyOrExit(aMessage.Read(aOffset, sizeof(option), &option) == sizeof(option), error = OT_ERROR_PARSE);
 
         if (option.GetCode() == aCode)
         {
-            return aOffset;
+            aOptionOffset = aOffset;
+            ExitNow(error = OT_ERROR_NONE);
         }
 
+        VerifyOrExit(option.GetLength() <= end - aOffset - sizeof(option), error = OT_ERROR_PARSE);
         aOffset += sizeof(option) + option.GetLength();
     }
 
 exit:
-    return 0;
+    return error;
 }
+
 otError Dhcp6Server::ProcessClientIdentifier(Message &aMessage, uint16_t aOffset, ClientIdentifier &aClient)
 {
     otError error = OT_ERROR_NONE;
@@ -371,7 +421,9 @@ otError Dhcp6Server::ProcessIaNa(Message &aMessage, uint16_t aOffset, IaNa &aIaN
 
     while (length > 0)
     {
-        VerifyOrExit((optionOffset = FindOption(aMessage, aOffset, length, kOptionIaAddress)) > 0);
+        error = FindOption(aMessage, aOffset, length, kOptionIaAddress, optionOffset);
+        VerifyOrExit(error != OT_ERROR_NOT_FOUND, error = OT_ERROR_NONE);
+        SuccessOrExit(error);
         SuccessOrExit(error = ProcessIaAddress(aMessage, optionOffset));
 
         length -= ((optionOffset - aOffset) + sizeof(IaAddress));
@@ -137,11 +137,11 @@ private:
 
     void ProcessSolicit(Message &aMessage, otIp6Address &aDst, uint8_t *aTransactionId);
 
-    uint16_t FindOption(Message &aMessage, uint16_t aOffset, uint16_t aLength, Code aCode);
-    otError  ProcessClientIdentifier(Message &aMessage, uint16_t aOffset, ClientIdentifier &aClient);
-    otError  ProcessIaNa(Message &aMessage, uint16_t aOffset, IaNa &aIaNa);
-    otError  ProcessIaAddress(Message &aMessage, uint16_t aOffset);
-    otError  ProcessElapsedTime(Message &aMessage, uint16_t aOffset);
+    otError FindOption(Message &aMessage, uint16_t aOffset, uint16_t aLength, Code aCode, uint16_t &aOptionOffset);
+    otError ProcessClientIdentifier(Message &aMessage, uint16_t aOffset, ClientIdentifier &aClient);
+    otError ProcessIaNa(Message &aMessage, uint16_t aOffset, IaNa &aIaNa);
+    otError ProcessIaAddress(Message &aMessage, uint16_t aOffset);
+    otError ProcessElapsedTime(Message &aMessage, uint16_t aOffset);
 
     otError SendReply(otIp6Address &aDst, uint8_t *aTransactionId, ClientIdentifier &aClientIdentifier, IaNa &aIaNa);
 
@@ -175,6 +175,64 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX
+ *
+ * Maximum number of fragmented messages for which direct transmission may be in progress at the same time. Frames from
+ * the in-progress messages are interleaved in a round-robin manner, so that a slow next hop does not block the direct
+ * transmission of other messages. Define as 1 to send all fragments of a message before starting the next one.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX
+#define OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_HIGH
+ *
+ * Maximum time (in milliseconds) a high priority message may wait in the send queue before its direct transmission
+ * starts. A message which misses its deadline is dropped. Define as 0 to never drop high priority messages.
+ *
+ * The deadlines of all priority levels are at most 65535, as messages only keep the lower 16 bits of their queued time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_HIGH
+#define OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_HIGH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_MEDIUM
+ *
+ * Maximum time (in milliseconds) a medium priority message may wait in the send queue before its direct transmission
+ * starts. Define as 0 to never drop medium priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_MEDIUM
+#define OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_MEDIUM 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_LOW
+ *
+ * Maximum time (in milliseconds) a low priority message may wait in the send queue before its direct transmission
+ * starts. Define as 0 to never drop low priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_LOW
+#define OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_LOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_VERY_LOW
+ *
+ * Maximum time (in milliseconds) a very low priority message may wait in the send queue before its direct
+ * transmission starts. Define as 0 to never drop very low priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_VERY_LOW
+#define OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_VERY_LOW 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ATTACH_DATA_POLL_PERIOD
  *
@@ -344,6 +402,16 @@
 #define OPENTHREAD_CONFIG_MAX_SERVER_ALOCS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+ *
+ * The number of flows for which the compressed 6LoWPAN header is cached. Define as 0 to disable the cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
@@ -384,6 +452,53 @@
 #define OPENTHREAD_CONFIG_JOINER_UDP_PORT 1000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_JOINER_ROUTER_MAX_JOINERS
+ *
+ * The maximum number of Joiners a Joiner Router relays at the same time. Datagrams from other Joiners are dropped
+ * until a Joiner is entrusted or times out, so this should exceed the number of Joiners expected to join at once.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_JOINER_ROUTER_MAX_JOINERS
+#define OPENTHREAD_CONFIG_JOINER_ROUTER_MAX_JOINERS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_JOINER_ROUTER_JOINER_TIMEOUT
+ *
+ * The time after which a Joiner Router stops relaying a Joiner it received no datagram from (in seconds).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_JOINER_ROUTER_JOINER_TIMEOUT
+#define OPENTHREAD_CONFIG_JOINER_ROUTER_JOINER_TIMEOUT 20
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_WINDOW
+ *
+ * The time a Joiner Router holds a datagram from a Joiner to relay it with the datagrams that follow it in a single
+ * Relay Receive notification (in milliseconds). Zero relays every datagram on its own.
+ *
+ * The Commissioner receives the datagrams of a Relay Receive notification as a single DTLS datagram, and discards the
+ * rest of a DTLS datagram after an invalid record. A corrupted or replayed datagram from a Joiner thus also loses the
+ * datagrams relayed after it in the same notification.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_WINDOW
+#define OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_WINDOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_SIZE
+ *
+ * The maximum number of bytes of Joiner datagrams a Joiner Router relays in a single Relay Receive notification. The
+ * Commissioner receives them as a single DTLS datagram, so this must not exceed its DTLS input buffer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_SIZE
+#define OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_SIZE 512
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS
  *
@@ -404,6 +519,36 @@
 #define OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_JOINER_HASH_BUCKETS
+ *
+ * The number of hash buckets the Commissioner uses to look up Joiner entries by Joiner ID.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_JOINER_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_JOINER_HASH_BUCKETS OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PSKC_CACHE_SIZE
+ *
+ * The number of PSKc values the Commissioner caches along with the inputs they were generated from (at least 1).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PSKC_CACHE_SIZE
+#define OPENTHREAD_CONFIG_PSKC_CACHE_SIZE 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PSKC_ITERATIONS_PER_TASKLET
+ *
+ * The number of PBKDF2 iterations run per tasklet when generating a PSKc asynchronously (out of 16384).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PSKC_ITERATIONS_PER_TASKLET
+#define OPENTHREAD_CONFIG_PSKC_ITERATIONS_PER_TASKLET 512
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
  *
@@ -424,6 +569,16 @@
 #define OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+ *
+ * Define to 1 to measure the total time spent in each internal `Notifier` callback.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME
+#define OPENTHREAD_CONFIG_ENABLE_NOTIFIER_DISPATCH_TIME 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT
  *
@@ -540,6 +695,42 @@
 #define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD 1000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD_MAX
+ *
+ * The maximum value ahead of the current frame counter for persistent storage.
+ *
+ * The value stored ahead grows with the observed transmit rate, from OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD up
+ * to this value. Setting both to the same value disables the adaptation.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD_MAX
+#define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD_MAX 16000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_INTERVAL
+ *
+ * The targeted minimum interval (in milliseconds) between two frame counter writes to persistent storage.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_INTERVAL
+#define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_INTERVAL 30000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_KEY_CACHE_WINDOW
+ *
+ * The number of key sequences before and after the current one whose derived MAC and MLE keys are cached.
+ *
+ * Frames secured with the previous or next key sequence are common around a key rotation, caching their keys avoids
+ * an HMAC-SHA256 computation per frame. Each cached key sequence takes 40 bytes of RAM. The value must be at least 1.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_CACHE_WINDOW
+#define OPENTHREAD_CONFIG_KEY_CACHE_WINDOW 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY
  *
@@ -804,6 +995,28 @@
 #define OPENTHREAD_CONFIG_LOG_SUFFIX ""
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY
+ *
+ * Define as 1 to record logs in binary form (the format string identifier and the raw arguments) instead of
+ * formatting them. The records are buffered and passed to `otPlatLogBinary()` from a tasklet, and are decoded on the
+ * host using `tools/binary-log`. Requires a GNU compatible toolchain.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY
+#define OPENTHREAD_CONFIG_LOG_BINARY 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+ *
+ * The size of the binary log ring buffer (in bytes). Records are dropped while the buffer is full.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE 1024
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES
  *
@@ -1013,6 +1226,27 @@
 #define OPENTHREAD_CONFIG_HEAP_SIZE (1536 * sizeof(void *))
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+ *
+ * The number of DTLS sessions kept by a DTLS server so that clients can resume them with an abbreviated handshake.
+ * A DTLS client keeps its last session. Zero disables session resumption.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_LIFETIME
+ *
+ * The time after which a DTLS session can no longer be resumed (in seconds).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_LIFETIME
+#define OPENTHREAD_CONFIG_DTLS_SESSION_LIFETIME 3600
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS
  *
@@ -1023,6 +1257,18 @@
 #define OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS 384
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAX_INSTANCE_SIZE
+ *
+ * The maximum size (in bytes) of the OpenThread instance, checked at compile time. Zero disables the check.
+ *
+ * See `otInstanceGetFootprint()` for the breakdown of the instance size.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAX_INSTANCE_SIZE
+#define OPENTHREAD_CONFIG_MAX_INSTANCE_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
  *
@@ -1430,6 +1676,21 @@
 #define OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE 15
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE
+ *
+ * Number of raw frames (`PROP_STREAM_RAW` sets) the NCP queues while another raw frame is being transmitted (at
+ * least 1).
+ *
+ * Each queued frame is reported by a `LAST_STATUS` carrying the spinel TID of its set command, so a host may keep up
+ * to `OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE + 1` raw frames in flight instead of waiting for every transmit to
+ * complete. Each entry takes `OT_RADIO_FRAME_MAX_SIZE` plus three bytes of RAM.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE
+#define OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE 3
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
  *
@@ -1492,6 +1753,32 @@
 #define OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+ *
+ * Define to 1 to exchange Network Data deltas in MLE Data Request and Data Response messages by default.
+ *
+ * Routers only keep the recent Network Data versions they encode deltas from when this is set, otherwise they answer
+ * every Data Request with the full Network Data.
+ *
+ * The Network Data Delta TLV is not part of the Thread Specification. A device receiving a multicast Data Response
+ * without a Network Data TLV falls back to requesting the full Network Data.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+#define OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_NETWORK_DATA_HISTORY_SIZE
+ *
+ * The number of recent Network Data versions a router keeps to encode Network Data deltas from (at least 2).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_NETWORK_DATA_HISTORY_SIZE
+#define OPENTHREAD_CONFIG_MLE_NETWORK_DATA_HISTORY_SIZE 2
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ENABLE_DEBUG_UART
  *
@@ -97,6 +97,21 @@ exit:
     return error;
 }
 
+void AddressResolver::GetCacheUsage(otMemoryUsage &aUsage) const
+{
+    aUsage.mEntrySize    = sizeof(Cache);
+    aUsage.mUsedEntries  = 0;
+    aUsage.mTotalEntries = kCacheEntries;
+
+    for (int i = 0; i < kCacheEntries; i++)
+    {
+        if (mCache[i].mState != Cache::kStateInvalid)
+        {
+            aUsage.mUsedEntries++;
+        }
+    }
+}
+
 void AddressResolver::Remove(uint8_t aRouterId)
 {
     for (int i = 0; i < kCacheEntries; i++)
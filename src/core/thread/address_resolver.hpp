@@ -88,6 +88,14 @@ public:
      */
     otError GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const;
 
+    /**
+     * This method gets the usage of the EID cache.
+     *
+     * @param[out]  aUsage  A reference to where the cache usage is placed.
+     *
+     */
+    void GetCacheUsage(otMemoryUsage &aUsage) const;
+
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -112,7 +112,7 @@ exit:
 
 AnnounceSender::AnnounceSender(Instance &aInstance)
     : AnnounceSenderBase(aInstance, &AnnounceSender::HandleTimer)
-    , mNotifierCallback(HandleStateChanged, this)
+    , mNotifierCallback(HandleStateChanged, this, OT_CHANGED_THREAD_ROLE)
 {
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 }
@@ -60,7 +60,7 @@ EnergyScanServer::EnergyScanServer(Instance &aInstance)
     , mActive(false)
     , mScanResultsLength(0)
     , mTimer(aInstance, &EnergyScanServer::HandleTimer, this)
-    , mNotifierCallback(&EnergyScanServer::HandleStateChanged, this)
+    , mNotifierCallback(&EnergyScanServer::HandleStateChanged, this, OT_CHANGED_THREAD_NETDATA)
     , mEnergyScan(OT_URI_PATH_ENERGY_SCAN, &EnergyScanServer::HandleRequest, this)
 {
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
@@ -74,6 +74,10 @@ KeyManager::KeyManager(Instance &aInstance)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
+    , mStoreFrameCounterAhead(kStoreFrameCounterAheadMin)
+    , mLastStoreTime(0)
+    , mLastStoreMacFrameCounter(0)
+    , mLastStoreMleFrameCounter(0)
     , mHoursSinceKeyRotation(0)
     , mKeyRotationTime(kDefaultKeyRotationTime)
     , mKeySwitchGuardTime(kDefaultKeySwitchGuardTime)
@@ -82,6 +86,8 @@ KeyManager::KeyManager(Instance &aInstance)
     , mKekFrameCounter(0)
     , mSecurityPolicyFlags(0xff)
 {
+    memset(&mKeyCacheCounters, 0, sizeof(mKeyCacheCounters));
+    InvalidateKeyCache();
     ComputeKey(mKeySequence, mKey);
 }
 
@@ -127,6 +133,7 @@ otError KeyManager::SetMasterKey(const otMasterKey &aKey)
 
     mMasterKey   = aKey;
     mKeySequence = 0;
+    InvalidateKeyCache();
     ComputeKey(mKeySequence, mKey);
 
     // reset parent frame counters
@@ -173,11 +180,16 @@ otError KeyManager::ComputeKey(uint32_t aKeySequence, uint8_t *aKey)
 
     hmac.Finish(aKey);
 
+    mKeyCacheCounters.mDerivations++;
+
     return OT_ERROR_NONE;
 }
 
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
 {
+    uint32_t   previousKeySequence = mKeySequence;
+    CachedKey *entry;
+
     if (aKeySequence == mKeySequence)
     {
         ExitNow();
@@ -191,7 +203,31 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
     }
 
     mKeySequence = aKeySequence;
-    ComputeKey(mKeySequence, mKey);
+    entry        = FindCachedKey(aKeySequence);
+
+    if (entry != NULL)
+    {
+        // Swap the cached key with the previous one, which then remains cached if still within the window.
+        mKeyCacheCounters.mHits++;
+        memcpy(mTemporaryKey, entry->mKey, sizeof(mTemporaryKey));
+        memcpy(entry->mKey, mKey, sizeof(entry->mKey));
+        memcpy(mKey, mTemporaryKey, sizeof(mKey));
+        entry->mKeySequence = previousKeySequence;
+        entry->mValid       = (GetKeySequenceDistance(previousKeySequence) <= kKeyCacheWindow);
+    }
+    else
+    {
+        entry = GetKeyCacheSlot(previousKeySequence);
+
+        if (entry != NULL)
+        {
+            memcpy(entry->mKey, mKey, sizeof(entry->mKey));
+            entry->mKeySequence = previousKeySequence;
+            entry->mValid       = true;
+        }
+
+        ComputeKey(mKeySequence, mKey);
+    }
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
@@ -210,34 +246,177 @@ exit:
 
 const uint8_t *KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey + kMacKeyOffset;
+    return GetTemporaryKey(aKeySequence) + kMacKeyOffset;
 }
 
 const uint8_t *KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey;
+    return GetTemporaryKey(aKeySequence);
 }
 
-void KeyManager::IncrementMacFrameCounter(void)
+const uint8_t *KeyManager::GetTemporaryKey(uint32_t aKeySequence)
 {
-    mMacFrameCounter++;
+    CachedKey *entry = FindCachedKey(aKeySequence);
+    uint8_t *  key;
+
+    if (entry != NULL)
+    {
+        mKeyCacheCounters.mHits++;
+        ExitNow(key = entry->mKey);
+    }
+
+    // Keys outside of the cache window are computed into the temporary key buffer.
+    entry = GetKeyCacheSlot(aKeySequence);
+    key   = (entry != NULL) ? entry->mKey : mTemporaryKey;
 
-    if (mMacFrameCounter >= mStoredMacFrameCounter)
+    ComputeKey(aKeySequence, key);
+
+    if (entry != NULL)
     {
-        GetNetif().GetMle().Store();
+        entry->mKeySequence = aKeySequence;
+        entry->mValid       = true;
     }
+
+exit:
+    return key;
+}
+
+KeyManager::CachedKey *KeyManager::FindCachedKey(uint32_t aKeySequence)
+{
+    CachedKey *entry = NULL;
+
+    for (uint8_t i = 0; i < kKeyCacheSize; i++)
+    {
+        if (mKeyCache[i].mValid && mKeyCache[i].mKeySequence == aKeySequence)
+        {
+            ExitNow(entry = &mKeyCache[i]);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+KeyManager::CachedKey *KeyManager::GetKeyCacheSlot(uint32_t aKeySequence)
+{
+    CachedKey *entry       = NULL;
+    uint32_t   maxDistance = 0;
+
+    VerifyOrExit(GetKeySequenceDistance(aKeySequence) <= kKeyCacheWindow);
+
+    // Use a free entry, or else the one farthest from the current key sequence.
+    for (uint8_t i = 0; i < kKeyCacheSize; i++)
+    {
+        uint32_t distance;
+
+        if (!mKeyCache[i].mValid)
+        {
+            ExitNow(entry = &mKeyCache[i]);
+        }
+
+        distance = GetKeySequenceDistance(mKeyCache[i].mKeySequence);
+
+        if (distance >= maxDistance)
+        {
+            maxDistance = distance;
+            entry       = &mKeyCache[i];
+        }
+    }
+
+exit:
+    return entry;
+}
+
+uint32_t KeyManager::GetKeySequenceDistance(uint32_t aKeySequence) const
+{
+    uint32_t ahead  = aKeySequence - mKeySequence;
+    uint32_t behind = mKeySequence - aKeySequence;
+
+    return (ahead < behind) ? ahead : behind;
+}
+
+void KeyManager::InvalidateKeyCache(void)
+{
+    for (uint8_t i = 0; i < kKeyCacheSize; i++)
+    {
+        mKeyCache[i].mValid = false;
+    }
+}
+
+void KeyManager::IncrementMacFrameCounter(void)
+{
+    mMacFrameCounter++;
+    CheckStoredFrameCounter(mMacFrameCounter, mStoredMacFrameCounter);
 }
 
 void KeyManager::IncrementMleFrameCounter(void)
 {
     mMleFrameCounter++;
+    CheckStoredFrameCounter(mMleFrameCounter, mStoredMleFrameCounter);
+}
+
+void KeyManager::CheckStoredFrameCounter(uint32_t aFrameCounter, uint32_t aStoredFrameCounter)
+{
+    Mle::MleRouter &mle = GetNetif().GetMle();
+
+    if (aFrameCounter >= aStoredFrameCounter)
+    {
+        // The deferred store did not run in time, a counter past the stored value must not be used before it is
+        // persisted.
+        mle.StoreFrameCounters();
+    }
+    else if (aStoredFrameCounter - aFrameCounter <= mStoreFrameCounterAhead / 2)
+    {
+        mle.StoreDeferred();
+    }
+}
+
+uint32_t KeyManager::GetFramesSince(uint32_t aFrameCounter, uint32_t aLastFrameCounter)
+{
+    // The frame counters restart from zero on a key sequence switch.
+    return (aFrameCounter >= aLastFrameCounter) ? aFrameCounter - aLastFrameCounter : aFrameCounter;
+}
+
+void KeyManager::UpdateStoreFrameCounterAhead(void)
+{
+    uint32_t now     = TimerMilli::GetNow();
+    uint32_t elapsed = now - mLastStoreTime;
+    uint32_t frames  = GetFramesSince(mMacFrameCounter, mLastStoreMacFrameCounter);
+    uint32_t ahead;
+
+    if (GetFramesSince(mMleFrameCounter, mLastStoreMleFrameCounter) > frames)
+    {
+        frames = GetFramesSince(mMleFrameCounter, mLastStoreMleFrameCounter);
+    }
+
+    if (frames > kStoreFrameCounterAheadMax)
+    {
+        frames = kStoreFrameCounterAheadMax;
+    }
+
+    // Expected number of frames within the store interval at the rate observed since the last store.
+    if (elapsed >= kStoreFrameCounterInterval)
+    {
+        ahead = frames / (elapsed / kStoreFrameCounterInterval);
+    }
+    else
+    {
+        ahead = frames * (kStoreFrameCounterInterval / (elapsed + 1));
+    }
 
-    if (mMleFrameCounter >= mStoredMleFrameCounter)
+    if (ahead < kStoreFrameCounterAheadMin)
     {
-        GetNetif().GetMle().Store();
+        ahead = kStoreFrameCounterAheadMin;
     }
+    else if (ahead > kStoreFrameCounterAheadMax)
+    {
+        ahead = kStoreFrameCounterAheadMax;
+    }
+
+    mStoreFrameCounterAhead   = ahead;
+    mLastStoreTime            = now;
+    mLastStoreMacFrameCounter = mMacFrameCounter;
+    mLastStoreMleFrameCounter = mMleFrameCounter;
 }
 
 void KeyManager::SetKek(const uint8_t *aKek)
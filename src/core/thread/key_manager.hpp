@@ -44,6 +44,10 @@
 #include "common/timer.hpp"
 #include "crypto/hmac_sha256.hpp"
 
+#if OPENTHREAD_CONFIG_KEY_CACHE_WINDOW < 1
+#error OPENTHREAD_CONFIG_KEY_CACHE_WINDOW should be at least set to 1.
+#endif
+
 namespace ot {
 
 /**
@@ -170,6 +174,14 @@ public:
      */
     const uint8_t *GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the counters of the derived key cache.
+     *
+     * @returns A reference to the key cache counters.
+     *
+     */
+    const otKeyCacheCounters &GetKeyCacheCounters(void) const { return mKeyCacheCounters; }
+
     /**
      * This method returns the current MAC Frame Counter value.
      *
@@ -184,7 +196,11 @@ public:
      * @param[in]  aMacFrameCounter  The MAC Frame Counter value.
      *
      */
-    void SetMacFrameCounter(uint32_t aMacFrameCounter) { mMacFrameCounter = aMacFrameCounter; }
+    void SetMacFrameCounter(uint32_t aMacFrameCounter)
+    {
+        mMacFrameCounter          = aMacFrameCounter;
+        mLastStoreMacFrameCounter = aMacFrameCounter;
+    }
 
     /**
      * This method sets the MAC Frame Counter value which is stored in non-volatile memory.
@@ -197,6 +213,9 @@ public:
     /**
      * This method increments the current MAC Frame Counter value.
      *
+     * A write of the frame counters to non-volatile memory is scheduled once the counter gets within half of the
+     * store-ahead window of the stored value, and done right away if the stored value is reached.
+     *
      */
     void IncrementMacFrameCounter(void);
 
@@ -214,7 +233,11 @@ public:
      * @param[in]  aMleFrameCounter  The MLE Frame Counter value.
      *
      */
-    void SetMleFrameCounter(uint32_t aMleFrameCounter) { mMleFrameCounter = aMleFrameCounter; }
+    void SetMleFrameCounter(uint32_t aMleFrameCounter)
+    {
+        mMleFrameCounter          = aMleFrameCounter;
+        mLastStoreMleFrameCounter = aMleFrameCounter;
+    }
 
     /**
      * This method sets the MLE Frame Counter value which is stored in non-volatile memory.
@@ -230,6 +253,24 @@ public:
      */
     void IncrementMleFrameCounter(void);
 
+    /**
+     * This method returns the value by which the stored frame counters are ahead of the current ones.
+     *
+     * @returns The frame counter store-ahead window.
+     *
+     */
+    uint32_t GetStoreFrameCounterAhead(void) const { return mStoreFrameCounterAhead; }
+
+    /**
+     * This method adapts the frame counter store-ahead window to the transmit rate observed since the last call.
+     *
+     * The window is sized to the number of frames expected within `OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_INTERVAL`,
+     * bounded by `OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD` and `OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD_MAX`.
+     * It is called each time the frame counters are stored.
+     *
+     */
+    void UpdateStoreFrameCounterAhead(void);
+
     /**
      * This method returns the KEK.
      *
@@ -335,11 +376,38 @@ private:
         kOneHourIntervalInMsec     = 3600u * 1000u,
     };
 
-    otError ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    enum
+    {
+        kKeyCacheWindow = OPENTHREAD_CONFIG_KEY_CACHE_WINDOW,
+        kKeyCacheSize   = 2 * kKeyCacheWindow,
+    };
+
+    struct CachedKey
+    {
+        uint32_t mKeySequence;
+        bool     mValid;
+        uint8_t  mKey[Crypto::HmacSha256::kHashSize];
+    };
+
+    otError        ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    const uint8_t *GetTemporaryKey(uint32_t aKeySequence);
+    CachedKey *    FindCachedKey(uint32_t aKeySequence);
+    CachedKey *    GetKeyCacheSlot(uint32_t aKeySequence);
+    uint32_t       GetKeySequenceDistance(uint32_t aKeySequence) const;
+    void           InvalidateKeyCache(void);
+
+    enum
+    {
+        kStoreFrameCounterAheadMin = OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD,
+        kStoreFrameCounterAheadMax = OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD_MAX,
+        kStoreFrameCounterInterval = OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_INTERVAL,
+    };
 
-    void        StartKeyRotationTimer(void);
-    static void HandleKeyRotationTimer(Timer &aTimer);
-    void        HandleKeyRotationTimer(void);
+    static uint32_t GetFramesSince(uint32_t aFrameCounter, uint32_t aLastFrameCounter);
+    void            CheckStoredFrameCounter(uint32_t aFrameCounter, uint32_t aStoredFrameCounter);
+    void            StartKeyRotationTimer(void);
+    static void     HandleKeyRotationTimer(Timer &aTimer);
+    void            HandleKeyRotationTimer(void);
 
     otMasterKey mMasterKey;
 
@@ -348,10 +416,17 @@ private:
 
     uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
 
+    CachedKey          mKeyCache[kKeyCacheSize];
+    otKeyCacheCounters mKeyCacheCounters;
+
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
     uint32_t mStoredMacFrameCounter;
     uint32_t mStoredMleFrameCounter;
+    uint32_t mStoreFrameCounterAhead;
+    uint32_t mLastStoreTime;
+    uint32_t mLastStoreMacFrameCounter;
+    uint32_t mLastStoreMleFrameCounter;
 
     uint32_t   mHoursSinceKeyRotation;
     uint32_t   mKeyRotationTime;
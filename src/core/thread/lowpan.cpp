@@ -37,6 +37,7 @@
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
+#include "common/owner-locator.hpp"
 #include "net/ip6.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_data_leader.hpp"
@@ -49,9 +50,86 @@ namespace Lowpan {
 
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    , mCompressCacheNext(0)
+    , mCompressCacheVersion(0)
+    , mNotifierCallback(&Lowpan::HandleStateChanged, this, OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ML_ADDR)
+#endif
 {
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    ClearCompressCache();
+    aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
+#endif
 }
 
+void Lowpan::ClearCompressCache(void)
+{
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    for (uint8_t i = 0; i < kCompressCacheSize; i++)
+    {
+        mCompressCache[i].mLength = 0;
+    }
+
+    mCompressCacheNext = 0;
+#endif
+}
+
+void Lowpan::GetCompressCacheUsage(otMemoryUsage &aUsage) const
+{
+    memset(&aUsage, 0, sizeof(aUsage));
+
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    aUsage.mEntrySize    = sizeof(CompressCacheEntry);
+    aUsage.mTotalEntries = kCompressCacheSize;
+
+    for (uint8_t i = 0; i < kCompressCacheSize; i++)
+    {
+        if (mCompressCache[i].mLength != 0)
+        {
+            aUsage.mUsedEntries++;
+        }
+    }
+#endif
+}
+
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+
+void Lowpan::HandleStateChanged(Notifier::Callback &aCallback, uint32_t aFlags)
+{
+    aCallback.GetOwner<Lowpan>().HandleStateChanged(aFlags);
+}
+
+void Lowpan::HandleStateChanged(uint32_t aFlags)
+{
+    if ((aFlags & (OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ML_ADDR)) != 0)
+    {
+        ClearCompressCache();
+    }
+}
+
+bool Lowpan::MatchCompressCacheEntry(const CompressCacheEntry &aEntry, const CompressCacheEntry &aKey)
+{
+    bool rval = false;
+
+    VerifyOrExit(aEntry.mLength != 0);
+    VerifyOrExit(aEntry.mSourcePort == aKey.mSourcePort && aEntry.mDestinationPort == aKey.mDestinationPort);
+    VerifyOrExit(memcmp(&aEntry.mIp6Header, &aKey.mIp6Header, sizeof(aKey.mIp6Header)) == 0);
+
+    VerifyOrExit(aEntry.mMacSource.GetType() == aKey.mMacSource.GetType() &&
+                 aEntry.mMacDest.GetType() == aKey.mMacDest.GetType());
+    VerifyOrExit(!aKey.mMacSource.IsShort() || aEntry.mMacSource.GetShort() == aKey.mMacSource.GetShort());
+    VerifyOrExit(!aKey.mMacSource.IsExtended() || aEntry.mMacSource.GetExtended() == aKey.mMacSource.GetExtended());
+    VerifyOrExit(!aKey.mMacDest.IsShort() || aEntry.mMacDest.GetShort() == aKey.mMacDest.GetShort());
+    VerifyOrExit(!aKey.mMacDest.IsExtended() || aEntry.mMacDest.GetExtended() == aKey.mMacDest.GetExtended());
+
+    rval = true;
+
+exit:
+    return rval;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+
 otError Lowpan::CopyContext(const Context &aContext, Ip6::Address &aAddress)
 {
     memcpy(&aAddress, aContext.mPrefix, aContext.mPrefixLength / CHAR_BIT);
@@ -239,6 +317,99 @@ int Lowpan::CompressMulticast(const Ip6::Address &aIpAddr, uint16_t &aHcCtl, uin
 }
 
 int Lowpan::Compress(Message &aMessage, const Mac::Address &aMacSource, const Mac::Address &aMacDest, uint8_t *aBuf)
+{
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    // The compressed header only depends on the IPv6 header (except the payload length), the UDP ports, the MAC
+    // addresses and the 6LoWPAN contexts. It is cached per flow, and only the UDP checksum is filled in per message.
+
+    uint8_t             networkDataVersion = GetNetif().GetNetworkDataLeader().GetVersion();
+    CompressCacheEntry  key;
+    CompressCacheEntry *entry = NULL;
+    Ip6::UdpHeader      udpHeader;
+    uint8_t             checksumLength = 0;
+    int                 length;
+
+    aMessage.Read(aMessage.GetOffset(), sizeof(key.mIp6Header), &key.mIp6Header);
+    key.mIp6Header.SetPayloadLength(0);
+    key.mMacSource       = aMacSource;
+    key.mMacDest         = aMacDest;
+    key.mSourcePort      = 0;
+    key.mDestinationPort = 0;
+
+    switch (key.mIp6Header.GetNextHeader())
+    {
+    case Ip6::kProtoHopOpts:
+    case Ip6::kProtoIp6:
+        // Extension headers and tunneled packets vary per message and are not cached.
+        ExitNow(length = CompressHeaders(aMessage, aMacSource, aMacDest, aBuf));
+
+    case Ip6::kProtoUdp:
+        aMessage.Read(aMessage.GetOffset() + sizeof(key.mIp6Header), sizeof(udpHeader), &udpHeader);
+        key.mSourcePort      = udpHeader.GetSourcePort();
+        key.mDestinationPort = udpHeader.GetDestinationPort();
+        checksumLength       = sizeof(uint16_t);
+        break;
+
+    default:
+        break;
+    }
+
+    if (networkDataVersion != mCompressCacheVersion)
+    {
+        ClearCompressCache();
+        mCompressCacheVersion = networkDataVersion;
+    }
+
+    for (uint8_t i = 0; i < kCompressCacheSize; i++)
+    {
+        if (MatchCompressCacheEntry(mCompressCache[i], key))
+        {
+            entry = &mCompressCache[i];
+            break;
+        }
+    }
+
+    if (entry != NULL)
+    {
+        length = entry->mLength;
+        memcpy(aBuf, entry->mHeader, entry->mLength);
+        aMessage.MoveOffset(sizeof(key.mIp6Header));
+
+        if (checksumLength != 0)
+        {
+            memcpy(aBuf + length, reinterpret_cast<uint8_t *>(&udpHeader) + Ip6::UdpHeader::GetChecksumOffset(),
+                   checksumLength);
+            length += checksumLength;
+            aMessage.MoveOffset(sizeof(udpHeader));
+        }
+
+        ExitNow();
+    }
+
+    length = CompressHeaders(aMessage, aMacSource, aMacDest, aBuf);
+
+    if ((length > checksumLength) && (length - checksumLength <= kCompressCacheHeaderSize))
+    {
+        entry  = &mCompressCache[mCompressCacheNext];
+        *entry = key;
+
+        entry->mLength = static_cast<uint8_t>(length - checksumLength);
+        memcpy(entry->mHeader, aBuf, entry->mLength);
+
+        mCompressCacheNext = (mCompressCacheNext + 1) % kCompressCacheSize;
+    }
+
+exit:
+    return length;
+#else
+    return CompressHeaders(aMessage, aMacSource, aMacDest, aBuf);
+#endif
+}
+
+int Lowpan::CompressHeaders(Message &           aMessage,
+                            const Mac::Address &aMacSource,
+                            const Mac::Address &aMacDest,
+                            uint8_t *           aBuf)
 {
     NetworkData::Leader &networkData = GetNetif().GetNetworkDataLeader();
     uint8_t *            cur         = aBuf;
@@ -882,7 +1053,10 @@ exit:
     return (error == OT_ERROR_NONE) ? static_cast<int>(cur - aBuf) : -1;
 }
 
-int Lowpan::DecompressExtensionHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength)
+int Lowpan::DecompressExtensionHeader(uint8_t *      aHeaders,
+                                      uint16_t &     aHeadersLength,
+                                      const uint8_t *aBuf,
+                                      uint16_t       aBufLength)
 {
     otError         error     = OT_ERROR_PARSE;
     const uint8_t * cur       = aBuf;
@@ -927,87 +1101,93 @@ int Lowpan::DecompressExtensionHeader(Message &aMessage, const uint8_t *aBuf, ui
     // length
     hdr[1] = BitVectorBytes(sizeof(hdr) + len) - 1;
 
-    SuccessOrExit(aMessage.Append(hdr, sizeof(hdr)));
-    aMessage.MoveOffset(sizeof(hdr));
-
-    // payload
-    SuccessOrExit(aMessage.Append(cur, len));
-    aMessage.MoveOffset(len);
-    cur += len;
-
     // The RFC6282 says: "The trailing Pad1 or PadN option MAY be elided by the compressor.
     // A decompressor MUST ensure that the containing header is padded out to a multiple of 8 octets
     // in length, using a Pad1 or PadN option if necessary."
-    padLength = 8 - ((len + sizeof(hdr)) & 0x07);
+    padLength = (8 - ((len + sizeof(hdr)) & 0x07)) & 0x07;
 
-    if (padLength != 8)
-    {
-        if (padLength == 1)
-        {
-            optionPad1.Init();
-            SuccessOrExit(aMessage.Append(&optionPad1, padLength));
-        }
-        else
-        {
-            optionPadN.Init(padLength);
-            SuccessOrExit(aMessage.Append(&optionPadN, padLength));
-        }
+    VerifyOrExit(aHeadersLength + sizeof(hdr) + len + padLength <= kMaxHeadersLength);
 
-        aMessage.MoveOffset(padLength);
+    memcpy(aHeaders + aHeadersLength, hdr, sizeof(hdr));
+    aHeadersLength += sizeof(hdr);
+
+    // payload
+    memcpy(aHeaders + aHeadersLength, cur, len);
+    aHeadersLength += len;
+    cur += len;
+
+    if (padLength == 1)
+    {
+        optionPad1.Init();
+        memcpy(aHeaders + aHeadersLength, &optionPad1, padLength);
+    }
+    else if (padLength > 1)
+    {
+        optionPadN.Init(padLength);
+        memcpy(aHeaders + aHeadersLength, &optionPadN, padLength);
     }
 
+    aHeadersLength += padLength;
+
     error = OT_ERROR_NONE;
 
 exit:
     return (error == OT_ERROR_NONE) ? static_cast<int>(cur - aBuf) : -1;
 }
 
-int Lowpan::DecompressUdpHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength, uint16_t aDatagramLength)
+int Lowpan::DecompressUdpHeader(uint8_t *      aHeaders,
+                                uint16_t &     aHeadersLength,
+                                const uint8_t *aBuf,
+                                uint16_t       aBufLength,
+                                uint16_t       aDatagramLength,
+                                uint16_t       aDatagramOffset)
 {
-    otError        error     = OT_ERROR_PARSE;
-    const uint8_t *cur       = aBuf;
-    uint16_t       remaining = aBufLength;
-    Ip6::UdpHeader udpHeader;
-    uint8_t        udpCtl;
+    otError         error     = OT_ERROR_PARSE;
+    const uint8_t * cur       = aBuf;
+    uint16_t        remaining = aBufLength;
+    Ip6::UdpHeader *udpHeader;
+    uint8_t         udpCtl;
 
     VerifyOrExit(remaining >= 1);
     udpCtl = cur[0];
     cur++;
     remaining--;
 
-    memset(&udpHeader, 0, sizeof(udpHeader));
+    VerifyOrExit(aHeadersLength + sizeof(Ip6::UdpHeader) <= kMaxHeadersLength);
+    udpHeader = reinterpret_cast<Ip6::UdpHeader *>(aHeaders + aHeadersLength);
+    memset(udpHeader, 0, sizeof(*udpHeader));
 
     // source and dest ports
     switch (udpCtl & kUdpPortMask)
     {
     case 0:
         VerifyOrExit(remaining >= 4);
-        udpHeader.SetSourcePort(static_cast<uint16_t>((cur[0] << 8) | cur[1]));
-        udpHeader.SetDestinationPort(static_cast<uint16_t>((cur[2] << 8) | cur[3]));
+        udpHeader->SetSourcePort(static_cast<uint16_t>((cur[0] << 8) | cur[1]));
+        udpHeader->SetDestinationPort(static_cast<uint16_t>((cur[2] << 8) | cur[3]));
         cur += 4;
         remaining -= 4;
         break;
 
     case 1:
         VerifyOrExit(remaining >= 3);
-        udpHeader.SetSourcePort(static_cast<uint16_t>((cur[0] << 8) | cur[1]));
-        udpHeader.SetDestinationPort(0xf000 | cur[2]);
+        udpHeader->SetSourcePort(static_cast<uint16_t>((cur[0] << 8) | cur[1]));
+        udpHeader->SetDestinationPort(0xf000 | cur[2]);
         cur += 3;
         remaining -= 3;
         break;
 
     case 2:
         VerifyOrExit(remaining >= 3);
-        udpHeader.SetSourcePort(0xf000 | cur[0]);
-        udpHeader.SetDestinationPort(static_cast<uint16_t>((cur[1] << 8) | cur[2]));
+        udpHeader->SetSourcePort(0xf000 | cur[0]);
+        udpHeader->SetDestinationPort(static_cast<uint16_t>((cur[1] << 8) | cur[2]));
         cur += 3;
         remaining -= 3;
         break;
 
     case 3:
         VerifyOrExit(remaining >= 1);
-        udpHeader.SetSourcePort(0xf0b0 | (cur[0] >> 4));
-        udpHeader.SetDestinationPort(0xf0b0 | (cur[0] & 0xf));
+        udpHeader->SetSourcePort(0xf0b0 | (cur[0] >> 4));
+        udpHeader->SetDestinationPort(0xf0b0 | (cur[0] & 0xf));
         cur += 1;
         remaining -= 1;
         break;
@@ -1021,22 +1201,21 @@ int Lowpan::DecompressUdpHeader(Message &aMessage, const uint8_t *aBuf, uint16_t
     else
     {
         VerifyOrExit(remaining >= 2);
-        udpHeader.SetChecksum(static_cast<uint16_t>((cur[0] << 8) | cur[1]));
+        udpHeader->SetChecksum(static_cast<uint16_t>((cur[0] << 8) | cur[1]));
         cur += 2;
     }
 
     // length
     if (aDatagramLength == 0)
     {
-        udpHeader.SetLength(sizeof(udpHeader) + static_cast<uint16_t>(aBufLength - (cur - aBuf)));
+        udpHeader->SetLength(sizeof(*udpHeader) + static_cast<uint16_t>(aBufLength - (cur - aBuf)));
     }
     else
     {
-        udpHeader.SetLength(aDatagramLength - aMessage.GetOffset());
+        udpHeader->SetLength(aDatagramLength - aDatagramOffset - aHeadersLength);
     }
 
-    SuccessOrExit(aMessage.Append(&udpHeader, sizeof(udpHeader)));
-    aMessage.MoveOffset(sizeof(udpHeader));
+    aHeadersLength += sizeof(*udpHeader);
 
     error = OT_ERROR_NONE;
 
@@ -1044,33 +1223,35 @@ exit:
     return (error == OT_ERROR_NONE) ? static_cast<int>(cur - aBuf) : -1;
 }
 
-int Lowpan::Decompress(Message &           aMessage,
-                       const Mac::Address &aMacSource,
-                       const Mac::Address &aMacDest,
-                       const uint8_t *     aBuf,
-                       uint16_t            aBufLength,
-                       uint16_t            aDatagramLength)
+int Lowpan::DecompressHeaders(uint8_t *           aHeaders,
+                              uint16_t &          aHeadersLength,
+                              const Mac::Address &aMacSource,
+                              const Mac::Address &aMacDest,
+                              const uint8_t *     aBuf,
+                              uint16_t            aBufLength,
+                              uint16_t            aDatagramLength,
+                              uint16_t            aDatagramOffset)
 {
     otError        error = OT_ERROR_PARSE;
-    Ip6::Header    ip6Header;
+    Ip6::Header *  ip6Header;
     const uint8_t *cur       = aBuf;
     uint16_t       remaining = aBufLength;
     bool           compressed;
     int            rval;
-    uint16_t       ip6PayloadLength;
     uint16_t       compressedLength = 0;
-    uint16_t       currentOffset    = aMessage.GetOffset();
+    uint16_t       ip6HeaderOffset  = aHeadersLength;
 
     VerifyOrExit(remaining >= 2);
     compressed = (((static_cast<uint16_t>(cur[0]) << 8) | cur[1]) & kHcNextHeader) != 0;
 
-    VerifyOrExit((rval = DecompressBaseHeader(ip6Header, aMacSource, aMacDest, cur, remaining)) >= 0);
+    VerifyOrExit(aHeadersLength + sizeof(Ip6::Header) <= kMaxHeadersLength);
+    ip6Header = reinterpret_cast<Ip6::Header *>(aHeaders + aHeadersLength);
+
+    VerifyOrExit((rval = DecompressBaseHeader(*ip6Header, aMacSource, aMacDest, cur, remaining)) >= 0);
 
     cur += rval;
     remaining -= rval;
-
-    SuccessOrExit(aMessage.Append(&ip6Header, sizeof(ip6Header)));
-    SuccessOrExit(aMessage.MoveOffset(sizeof(ip6Header)));
+    aHeadersLength += sizeof(Ip6::Header);
 
     while (compressed)
     {
@@ -1085,18 +1266,20 @@ int Lowpan::Decompress(Message &           aMessage,
                 cur++;
                 remaining--;
 
-                VerifyOrExit((rval = Decompress(aMessage, aMacSource, aMacDest, cur, remaining, aDatagramLength)) >= 0);
+                VerifyOrExit((rval = DecompressHeaders(aHeaders, aHeadersLength, aMacSource, aMacDest, cur, remaining,
+                                                       aDatagramLength, aDatagramOffset)) >= 0);
             }
             else
             {
                 compressed = (cur[0] & kExtHdrNextHeader) != 0;
-                VerifyOrExit((rval = DecompressExtensionHeader(aMessage, cur, remaining)) >= 0);
+                VerifyOrExit((rval = DecompressExtensionHeader(aHeaders, aHeadersLength, cur, remaining)) >= 0);
             }
         }
         else if ((cur[0] & kUdpDispatchMask) == kUdpDispatch)
         {
             compressed = false;
-            VerifyOrExit((rval = DecompressUdpHeader(aMessage, cur, remaining, aDatagramLength)) >= 0);
+            VerifyOrExit((rval = DecompressUdpHeader(aHeaders, aHeadersLength, cur, remaining, aDatagramLength,
+                                                     aDatagramOffset)) >= 0);
         }
         else
         {
@@ -1112,22 +1295,79 @@ int Lowpan::Decompress(Message &           aMessage,
 
     if (aDatagramLength)
     {
-        ip6PayloadLength = HostSwap16(aDatagramLength - currentOffset - sizeof(Ip6::Header));
+        ip6Header->SetPayloadLength(aDatagramLength - aDatagramOffset - ip6HeaderOffset - sizeof(Ip6::Header));
     }
     else
     {
-        ip6PayloadLength =
-            HostSwap16(aMessage.GetOffset() - currentOffset - sizeof(Ip6::Header) + aBufLength - compressedLength);
+        ip6Header->SetPayloadLength(aHeadersLength - ip6HeaderOffset - sizeof(Ip6::Header) + aBufLength -
+                                    compressedLength);
     }
 
-    aMessage.Write(currentOffset + Ip6::Header::GetPayloadLengthOffset(), sizeof(ip6PayloadLength), &ip6PayloadLength);
-
     error = OT_ERROR_NONE;
 
 exit:
     return (error == OT_ERROR_NONE) ? static_cast<int>(compressedLength) : -1;
 }
 
+int Lowpan::Decompress(Message &           aMessage,
+                       const Mac::Address &aMacSource,
+                       const Mac::Address &aMacDest,
+                       const uint8_t *     aBuf,
+                       uint16_t            aBufLength,
+                       uint16_t            aDatagramLength)
+{
+    uint8_t  headers[kMaxHeadersLength];
+    uint16_t headersLength = 0;
+    int      rval;
+
+    VerifyOrExit((rval = DecompressHeaders(headers, headersLength, aMacSource, aMacDest, aBuf, aBufLength,
+                                           aDatagramLength, aMessage.GetOffset())) >= 0);
+
+    VerifyOrExit(aMessage.Append(headers, headersLength) == OT_ERROR_NONE, rval = -1);
+    aMessage.MoveOffset(headersLength);
+
+exit:
+    return rval;
+}
+
+otError Lowpan::DecompressFrame(Message &           aMessage,
+                                const Mac::Address &aMacSource,
+                                const Mac::Address &aMacDest,
+                                const uint8_t *     aFrame,
+                                uint16_t            aFrameLength,
+                                uint16_t            aDatagramLength,
+                                uint16_t &          aPayloadLength)
+{
+    otError  error  = OT_ERROR_PARSE;
+    uint16_t offset = aMessage.GetOffset();
+    uint8_t  headers[kMaxHeadersLength];
+    uint16_t headersLength = 0;
+    uint16_t length;
+    int      rval;
+
+    VerifyOrExit((rval = DecompressHeaders(headers, headersLength, aMacSource, aMacDest, aFrame, aFrameLength,
+                                           aDatagramLength, offset)) >= 0);
+
+    aPayloadLength = aFrameLength - static_cast<uint16_t>(rval);
+    length         = offset + headersLength + aPayloadLength;
+
+    if (aDatagramLength != 0)
+    {
+        VerifyOrExit(aDatagramLength >= length);
+        length = aDatagramLength;
+    }
+
+    // The message is sized once, and the uncompressed headers and the payload are then written in place.
+
+    SuccessOrExit(error = aMessage.SetLength(length));
+    aMessage.Write(offset, headersLength, headers);
+    aMessage.Write(offset + headersLength, aPayloadLength, aFrame + rval);
+    aMessage.MoveOffset(headersLength);
+
+exit:
+    return error;
+}
+
 otError MeshHeader::Init(const uint8_t *aFrame, uint8_t aFrameLength)
 {
     otError error = OT_ERROR_NONE;
@@ -38,6 +38,7 @@
 
 #include "common/locator.hpp"
 #include "common/message.hpp"
+#include "common/notifier.hpp"
 #include "mac/mac_frame.hpp"
 #include "net/ip6.hpp"
 #include "net/ip6_address.hpp"
@@ -115,6 +116,22 @@ public:
      */
     int Compress(Message &aMessage, const Mac::Address &aMacSource, const Mac::Address &aMacDest, uint8_t *aBuf);
 
+    /**
+     * This method clears the cache of compressed headers.
+     *
+     * The cache is cleared automatically when the Network Data or the Mesh Local Prefix changes.
+     *
+     */
+    void ClearCompressCache(void);
+
+    /**
+     * This method gets the usage of the cache of compressed headers.
+     *
+     * @param[out]  aUsage  A reference to where the cache usage is placed.
+     *
+     */
+    void GetCompressCacheUsage(otMemoryUsage &aUsage) const;
+
     /**
      * This method decompresses a LOWPAN_IPHC header.
      *
@@ -135,6 +152,34 @@ public:
                    uint16_t            aBufLen,
                    uint16_t            aDatagramLen);
 
+    /**
+     * This method decompresses a LOWPAN_IPHC header and copies the payload following it into an empty message.
+     *
+     * The message length is set once, to @p aDatagramLength if non-zero (first fragment of a datagram), or otherwise
+     * to the length of the uncompressed headers and the payload. On success, the message offset is set to the end of
+     * the uncompressed headers.
+     *
+     * @param[inout]  aMessage         A reference to the message.
+     * @param[in]     aMacSource       The MAC source address.
+     * @param[in]     aMacDest         The MAC destination address.
+     * @param[in]     aFrame           A pointer to the LOWPAN_IPHC header.
+     * @param[in]     aFrameLength     The number of bytes in @p aFrame.
+     * @param[in]     aDatagramLength  The IPv6 datagram length, or zero if the frame contains the whole datagram.
+     * @param[out]    aPayloadLength   The number of payload bytes copied from @p aFrame.
+     *
+     * @retval OT_ERROR_NONE     Successfully decompressed the frame.
+     * @retval OT_ERROR_PARSE    The frame could not be parsed.
+     * @retval OT_ERROR_NO_BUFS  Insufficient message buffers available.
+     *
+     */
+    otError DecompressFrame(Message &           aMessage,
+                            const Mac::Address &aMacSource,
+                            const Mac::Address &aMacDest,
+                            const uint8_t *     aFrame,
+                            uint16_t            aFrameLength,
+                            uint16_t            aDatagramLength,
+                            uint16_t &          aPayloadLength);
+
     /**
      * This method decompresses a LOWPAN_IPHC header.
      *
@@ -202,6 +247,36 @@ private:
         kUdpPortMask     = 3 << 0,
     };
 
+    enum
+    {
+        kCompressCacheSize       = OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE,
+        kCompressCacheHeaderSize = 48, ///< Max compressed IPv6 and UDP header (without UDP checksum) length.
+        kMaxHeadersLength        = 256, ///< Max length of the uncompressed headers of a frame.
+    };
+
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    /**
+     * This structure represents a cached compressed header of a flow.
+     *
+     */
+    struct CompressCacheEntry
+    {
+        Ip6::Header  mIp6Header;       ///< The IPv6 header of the flow (with zero payload length).
+        Mac::Address mMacSource;       ///< The MAC source address.
+        Mac::Address mMacDest;         ///< The MAC destination address.
+        uint16_t     mSourcePort;      ///< The UDP source port (zero if not UDP).
+        uint16_t     mDestinationPort; ///< The UDP destination port (zero if not UDP).
+        uint8_t      mLength;          ///< The length of the compressed header (zero if the entry is unused).
+        uint8_t      mHeader[kCompressCacheHeaderSize]; ///< The compressed header.
+    };
+
+    static bool MatchCompressCacheEntry(const CompressCacheEntry &aEntry, const CompressCacheEntry &aKey);
+
+    static void HandleStateChanged(Notifier::Callback &aCallback, uint32_t aFlags);
+    void        HandleStateChanged(uint32_t aFlags);
+#endif
+
+    int CompressHeaders(Message &aMessage, const Mac::Address &aMacSource, const Mac::Address &aMacDest, uint8_t *aBuf);
     int CompressExtensionHeader(Message &aMessage, uint8_t *aBuf, uint8_t &aNextHeader);
     int CompressSourceIid(const Mac::Address &aMacAddr,
                           const Ip6::Address &aIpAddr,
@@ -216,12 +291,35 @@ private:
     int CompressMulticast(const Ip6::Address &aIpAddr, uint16_t &aHcCtl, uint8_t *aBuf);
     int CompressUdp(Message &aMessage, uint8_t *aBuf);
 
-    int     DecompressExtensionHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength);
-    int     DecompressUdpHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength, uint16_t aDatagramLength);
+    int     DecompressHeaders(uint8_t *           aHeaders,
+                              uint16_t &          aHeadersLength,
+                              const Mac::Address &aMacSource,
+                              const Mac::Address &aMacDest,
+                              const uint8_t *     aBuf,
+                              uint16_t            aBufLength,
+                              uint16_t            aDatagramLength,
+                              uint16_t            aDatagramOffset);
+    int     DecompressExtensionHeader(uint8_t *      aHeaders,
+                                      uint16_t &     aHeadersLength,
+                                      const uint8_t *aBuf,
+                                      uint16_t       aBufLength);
+    int     DecompressUdpHeader(uint8_t *      aHeaders,
+                                uint16_t &     aHeadersLength,
+                                const uint8_t *aBuf,
+                                uint16_t       aBufLength,
+                                uint16_t       aDatagramLength,
+                                uint16_t       aDatagramOffset);
     otError DispatchToNextHeader(uint8_t aDispatch, Ip6::IpProto &aNextHeader);
 
     static otError CopyContext(const Context &aContext, Ip6::Address &aAddress);
     static otError ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+
+#if OPENTHREAD_CONFIG_6LOWPAN_COMPRESS_CACHE_SIZE
+    CompressCacheEntry mCompressCache[kCompressCacheSize];
+    uint8_t            mCompressCacheNext;
+    uint8_t            mCompressCacheVersion;
+    Notifier::Callback mNotifierCallback;
+#endif
 };
 
 /**
@@ -93,6 +93,13 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     mIpCounters.mRxSuccess = 0;
     mIpCounters.mTxFailure = 0;
     mIpCounters.mRxFailure = 0;
+
+    memset(mSendQueueDeficits, 0, sizeof(mSendQueueDeficits));
+    mSendQueueDeadlines[Message::kPriorityHigh]    = OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_HIGH;
+    mSendQueueDeadlines[Message::kPriorityMedium]  = OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_MEDIUM;
+    mSendQueueDeadlines[Message::kPriorityLow]     = OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_LOW;
+    mSendQueueDeadlines[Message::kPriorityVeryLow] = OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_VERY_LOW;
+    memset(&mSendQueueCounters, 0, sizeof(mSendQueueCounters));
 }
 
 otError MeshForwarder::Start(void)
@@ -189,6 +196,7 @@ void MeshForwarder::ScheduleTransmissionTask(void)
         if (mSendMessage->GetOffset() == 0)
         {
             mSendMessage->SetTxSuccess(true);
+            UpdateQueueDelay(*mSendMessage);
         }
 
         mSendMessageMaxMacTxAttempts = Mac::kDirectFrameMacTxAttempts;
@@ -238,11 +246,60 @@ exit:
 }
 
 Message *MeshForwarder::GetDirectTransmission(void)
+{
+    Message *curMessage   = NULL;
+    uint8_t  numFragTxing = 0;
+
+    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = curMessage->GetNext())
+    {
+        if (curMessage->GetDirectTransmission() && curMessage->GetOffset() > 0)
+        {
+            numFragTxing++;
+        }
+    }
+
+    // Priority levels are served using deficit round-robin: in every round, each level may send up to its quantum of
+    // frames, with higher priority levels served first. Lower priority levels are therefore never starved.
+
+    for (;;)
+    {
+        bool isDeferred = false;
+
+        for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            if (mSendQueueDeficits[priority] == 0)
+            {
+                isDeferred |= (mSendQueue.GetHeadForPriority(priority) != NULL);
+                continue;
+            }
+
+            if ((curMessage = GetDirectTransmission(priority, numFragTxing)) != NULL)
+            {
+                mSendQueueDeficits[priority]--;
+                ExitNow();
+            }
+        }
+
+        VerifyOrExit(isDeferred);
+
+        for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            mSendQueueDeficits[priority] = kSendQueueQuantum << (Message::kNumPriorities - 1 - priority);
+        }
+    }
+
+exit:
+    return curMessage;
+}
+
+Message *MeshForwarder::GetDirectTransmission(uint8_t aPriority, uint8_t aNumFragmentedTx)
 {
     Message *curMessage, *nextMessage;
     otError  error = OT_ERROR_NONE;
+    uint32_t now   = TimerMilli::GetNow();
 
-    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+    for (curMessage = mSendQueue.GetHeadForPriority(aPriority);
+         (curMessage != NULL) && (curMessage->GetPriority() == aPriority); curMessage = nextMessage)
     {
         nextMessage = curMessage->GetNext();
 
@@ -251,6 +308,22 @@ Message *MeshForwarder::GetDirectTransmission(void)
             continue;
         }
 
+        if (IsStale(*curMessage, now))
+        {
+            mSendQueueCounters.mStaleDrops[aPriority]++;
+            mIpCounters.mTxFailure++;
+            curMessage->ClearDirectTransmission();
+
+            if (!curMessage->IsChildPending())
+            {
+                mSendQueue.Dequeue(*curMessage);
+                LogIp6Message(kMessageDrop, *curMessage, NULL, OT_ERROR_RESPONSE_TIMEOUT);
+                curMessage->Free();
+            }
+
+            continue;
+        }
+
         switch (curMessage->GetType())
         {
         case Message::kTypeIp6:
@@ -283,6 +356,19 @@ Message *MeshForwarder::GetDirectTransmission(void)
         switch (error)
         {
         case OT_ERROR_NONE:
+            // Do not start a new message which needs fragmentation while the maximum number of fragmented messages
+            // are already in progress. Messages that fit in a single frame are not held back.
+            if ((curMessage->GetOffset() == 0) && (aNumFragmentedTx >= kMaxConcurrentFragmentedTx) &&
+                RequiresFragmentation(*curMessage))
+            {
+                continue;
+            }
+
+            if (aNumFragmentedTx > ((curMessage->GetOffset() > 0) ? 1 : 0))
+            {
+                mSendQueueCounters.mInterleavedFrames++;
+            }
+
             ExitNow();
 
 #if OPENTHREAD_FTD
@@ -307,10 +393,71 @@ Message *MeshForwarder::GetDirectTransmission(void)
         }
     }
 
+    curMessage = NULL;
+
 exit:
     return curMessage;
 }
 
+bool MeshForwarder::RequiresFragmentation(Message &aMessage)
+{
+    bool       rval       = false;
+    uint16_t   nextOffset = mMessageNextOffset;
+    uint8_t    psdu[Mac::Frame::kMTU];
+    Mac::Frame frame;
+    otError    error;
+
+    // Only IPv6 messages are fragmented (mesh forwarded frames are sent as received), and MLE Discover Requests
+    // always fit in a single frame.
+    VerifyOrExit(aMessage.GetType() == Message::kTypeIp6 &&
+                 aMessage.GetSubType() != Message::kSubTypeMleDiscoverRequest);
+
+    // Build the first frame as it would be sent with the route just updated. An MLE message which does not fit is
+    // sent with link security, which also needs fragmentation (see `HandleFrameRequest()`).
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+
+    error = SendFragment(aMessage, frame);
+    rval  = (error == OT_ERROR_NOT_CAPABLE) || (mMessageNextOffset < aMessage.GetLength());
+
+    mMessageNextOffset = nextOffset;
+
+exit:
+    return rval;
+}
+
+bool MeshForwarder::IsStale(const Message &aMessage, uint32_t aNow) const
+{
+    uint16_t deadline = mSendQueueDeadlines[aMessage.GetPriority()];
+
+    // A message is only dropped before its first frame is sent.
+
+    return (deadline != 0) && (aMessage.GetOffset() == 0) &&
+           (static_cast<uint16_t>(aNow - aMessage.GetTimestamp()) > deadline);
+}
+
+void MeshForwarder::UpdateQueueDelay(const Message &aMessage)
+{
+    static const uint16_t kBucketBounds[OT_SEND_QUEUE_DELAY_BUCKETS - 1] = {5, 10, 50, 100, 500, 1000, 5000};
+
+    uint16_t delay  = static_cast<uint16_t>(TimerMilli::GetNow() - aMessage.GetTimestamp());
+    uint8_t  bucket = 0;
+
+    while ((bucket < OT_SEND_QUEUE_DELAY_BUCKETS - 1) && (delay > kBucketBounds[bucket]))
+    {
+        bucket++;
+    }
+
+    mSendQueueCounters.mDirectMessages++;
+    mSendQueueCounters.mTotalDelay += delay;
+    mSendQueueCounters.mDelayHistogram[aMessage.GetPriority()][bucket]++;
+
+    if (delay > mSendQueueCounters.mMaxDelay)
+    {
+        mSendQueueCounters.mMaxDelay = delay;
+    }
+}
+
 otError MeshForwarder::PrepareDataPoll(void)
 {
     otError      error  = OT_ERROR_NONE;
@@ -904,6 +1051,7 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, otError aError)
     ThreadNetif &netif = GetNetif();
     Mac::Address macDest;
     Neighbor *   neighbor;
+    bool         isFirstFrame = false;
 
     mSendBusy = false;
 
@@ -911,6 +1059,7 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, otError aError)
 
     if (mSendMessage != NULL)
     {
+        isFirstFrame = (mSendMessage->GetOffset() == 0);
         mSendMessage->SetOffset(mMessageNextOffset);
     }
 
@@ -977,6 +1126,24 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, otError aError)
         if (mMessageNextOffset < mSendMessage->GetLength())
         {
             mSendMessage->SetOffset(mMessageNextOffset);
+
+            if (isFirstFrame)
+            {
+                mSendQueueCounters.mFragmentedMessages++;
+            }
+
+#if OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX > 1
+
+            // Move the partially sent message to the tail of its priority level, so that frames of other
+            // direct messages (possibly to different next hops) are interleaved with its remaining fragments.
+
+            if (!mSendMessage->IsChildPending())
+            {
+                mSendQueue.Dequeue(*mSendMessage);
+                mSendQueue.Enqueue(*mSendMessage);
+            }
+
+#endif
         }
         else
         {
@@ -1192,7 +1359,7 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
     otError                error = OT_ERROR_NONE;
     Lowpan::FragmentHeader fragmentHeader;
     Message *              message = NULL;
-    int                    headerLength;
+    uint16_t               payloadLength;
 
     // Check the fragment header
     VerifyOrExit(fragmentHeader.Init(aFrame, aFrameLength) == OT_ERROR_NONE, error = OT_ERROR_DROP);
@@ -1206,24 +1373,13 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
         message->SetLinkSecurityEnabled(aLinkInfo.mLinkSecurity);
         message->SetPanId(aLinkInfo.mPanId);
         message->AddRss(aLinkInfo.mRss);
-        headerLength = netif.GetLowpan().Decompress(*message, aMacSource, aMacDest, aFrame, aFrameLength,
-                                                    fragmentHeader.GetDatagramSize());
-        VerifyOrExit(headerLength > 0, error = OT_ERROR_PARSE);
-
-        aFrame += headerLength;
-        aFrameLength -= static_cast<uint8_t>(headerLength);
-
-        VerifyOrExit(fragmentHeader.GetDatagramSize() >= message->GetOffset() + aFrameLength, error = OT_ERROR_PARSE);
-
-        SuccessOrExit(error = message->SetLength(fragmentHeader.GetDatagramSize()));
+        SuccessOrExit(error = netif.GetLowpan().DecompressFrame(*message, aMacSource, aMacDest, aFrame, aFrameLength,
+                                                                fragmentHeader.GetDatagramSize(), payloadLength));
+        message->MoveOffset(payloadLength);
 
         message->SetDatagramTag(fragmentHeader.GetDatagramTag());
         message->SetTimeout(kReassemblyTimeout);
 
-        // copy Fragment
-        message->Write(message->GetOffset(), aFrameLength, aFrame);
-        message->MoveOffset(aFrameLength);
-
         // Security Check
         VerifyOrExit(netif.GetIp6Filter().Accept(*message), error = OT_ERROR_DROP);
 
@@ -1363,7 +1519,7 @@ void MeshForwarder::HandleLowpanHC(uint8_t *               aFrame,
     ThreadNetif &netif   = GetNetif();
     otError      error   = OT_ERROR_NONE;
     Message *    message = NULL;
-    int          headerLength;
+    uint16_t     payloadLength;
 
 #if OPENTHREAD_FTD
     UpdateRoutes(aFrame, aFrameLength, aMacSource, aMacDest);
@@ -1375,14 +1531,8 @@ void MeshForwarder::HandleLowpanHC(uint8_t *               aFrame,
     message->SetPanId(aLinkInfo.mPanId);
     message->AddRss(aLinkInfo.mRss);
 
-    headerLength = netif.GetLowpan().Decompress(*message, aMacSource, aMacDest, aFrame, aFrameLength, 0);
-    VerifyOrExit(headerLength > 0, error = OT_ERROR_PARSE);
-
-    aFrame += headerLength;
-    aFrameLength -= static_cast<uint8_t>(headerLength);
-
-    SuccessOrExit(error = message->SetLength(message->GetLength() + aFrameLength));
-    message->Write(message->GetOffset(), aFrameLength, aFrame);
+    SuccessOrExit(error = netif.GetLowpan().DecompressFrame(*message, aMacSource, aMacDest, aFrame, aFrameLength, 0,
+                                                            payloadLength));
 
     // Security Check
     VerifyOrExit(netif.GetIp6Filter().Accept(*message), error = OT_ERROR_DROP);
@@ -1438,6 +1588,7 @@ void MeshForwarder::LogIp6Message(MessageAction       aAction,
     char         stringBuffer[Ip6::Address::kIp6AddressStringSize];
     char         rssString[RssAverager::kStringSize];
 
+    VerifyOrExit(otLoggingIsEnabled(&GetInstance(), OT_LOG_LEVEL_INFO, OT_LOG_REGION_MAC));
     VerifyOrExit(aMessage.GetType() == Message::kTypeIp6);
 
     VerifyOrExit(sizeof(ip6Header) == aMessage.Read(0, sizeof(ip6Header), &ip6Header));
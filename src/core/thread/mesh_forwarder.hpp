@@ -49,6 +49,11 @@
 #include "thread/src_match_controller.hpp"
 #include "thread/topology.hpp"
 
+#if OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_HIGH > 0xffff || OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_MEDIUM > 0xffff || \
+    OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_LOW > 0xffff || OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_VERY_LOW > 0xffff
+#error "OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_* should be at most set to 65535."
+#endif
+
 namespace ot {
 
 enum
@@ -213,6 +218,26 @@ public:
      */
     const otIpCounters &GetCounters(void) const { return mIpCounters; }
 
+    /**
+     * This method returns a reference to the send queue scheduling counters.
+     *
+     * @returns A reference to the send queue scheduling counters.
+     *
+     */
+    const otSendQueueCounters &GetSendQueueCounters(void) const { return mSendQueueCounters; }
+
+    /**
+     * This method sets the deadline of a send queue priority level.
+     *
+     * A message which has not started direct transmission within @p aDeadline milliseconds after it was queued is
+     * dropped.  The deadlines are initialized from `OPENTHREAD_CONFIG_SEND_QUEUE_DEADLINE_*`.
+     *
+     * @param[in]  aPriority  The priority level.
+     * @param[in]  aDeadline  The deadline in milliseconds, or 0 to never drop messages of @p aPriority.
+     *
+     */
+    void SetSendQueueDeadline(uint8_t aPriority, uint16_t aDeadline) { mSendQueueDeadlines[aPriority] = aDeadline; }
+
 #if OPENTHREAD_FTD
     /**
      * This method returns a reference to the resolving queue.
@@ -234,7 +259,9 @@ public:
 private:
     enum
     {
-        kStateUpdatePeriod = 1000, ///< State update period in milliseconds.
+        kStateUpdatePeriod         = 1000, ///< State update period in milliseconds.
+        kMaxConcurrentFragmentedTx = OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX,
+        kSendQueueQuantum          = 1, ///< Frames per round for the lowest priority level (doubled per level).
     };
 
     enum
@@ -276,6 +303,10 @@ private:
     otError  GetMacDestinationAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     otError  GetMacSourceAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     Message *GetDirectTransmission(void);
+    Message *GetDirectTransmission(uint8_t aPriority, uint8_t aNumFragmentedTx);
+    bool     RequiresFragmentation(Message &aMessage);
+    bool     IsStale(const Message &aMessage, uint32_t aNow) const;
+    void     UpdateQueueDelay(const Message &aMessage);
     otError  GetIndirectTransmission(void);
     Message *GetIndirectTransmission(Child &aChild);
     otError  PrepareDiscoverRequest(void);
@@ -370,7 +401,11 @@ private:
     uint16_t mRestorePanId;
     bool     mScanning;
 
-    otIpCounters mIpCounters;
+    uint8_t  mSendQueueDeficits[Message::kNumPriorities];
+    uint16_t mSendQueueDeadlines[Message::kNumPriorities];
+
+    otIpCounters        mIpCounters;
+    otSendQueueCounters mSendQueueCounters;
 
 #if OPENTHREAD_FTD
     MessageQueue          mResolvingQueue;
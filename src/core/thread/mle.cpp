@@ -54,6 +54,7 @@
 #include "thread/address_resolver.hpp"
 #include "thread/key_manager.hpp"
 #include "thread/mle_router.hpp"
+#include "thread/network_data_delta.hpp"
 #include "thread/thread_netif.hpp"
 
 using ot::Encoding::BigEndian::HostSwap16;
@@ -64,6 +65,7 @@ namespace Mle {
 Mle::Mle(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRetrieveNewNetworkData(false)
+    , mNetworkDataDeltaEnabled(OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE)
     , mRole(OT_DEVICE_ROLE_DISABLED)
     , mDeviceMode(ModeTlv::kModeRxOnWhenIdle | ModeTlv::kModeSecureDataRequest)
     , mAttachState(kAttachStateIdle)
@@ -86,6 +88,8 @@ Mle::Mle(Instance &aInstance)
     , mSocket(aInstance.GetThreadNetif().GetIp6().GetUdp())
     , mTimeout(kMleEndDeviceTimeout)
     , mSendChildUpdateRequest(aInstance, &Mle::HandleSendChildUpdateRequest, this)
+    , mStoreTasklet(aInstance, &Mle::HandleStoreTasklet, this)
+    , mStorePending(false)
     , mDiscoverHandler(NULL)
     , mDiscoverContext(NULL)
     , mIsDiscoverInProgress(false)
@@ -104,7 +108,11 @@ Mle::Mle(Instance &aInstance)
     , mAlternateChannel(0)
     , mAlternatePanId(Mac::kPanIdBroadcast)
     , mAlternateTimestamp(0)
-    , mNotifierCallback(&Mle::HandleStateChanged, this)
+    , mNotifierCallback(&Mle::HandleStateChanged,
+                        this,
+                        OT_CHANGED_IP6_ADDRESS_ADDED | OT_CHANGED_IP6_ADDRESS_REMOVED |
+                            OT_CHANGED_IP6_MULTICAST_SUBSRCRIBED | OT_CHANGED_IP6_MULTICAST_UNSUBSRCRIBED |
+                            OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_KEY_SEQUENCE_COUNTER)
 {
     uint8_t meshLocalPrefix[8];
 
@@ -118,6 +126,7 @@ Mle::Mle(Instance &aInstance)
     memset(&mLinkLocalAllThreadNodes, 0, sizeof(mLinkLocalAllThreadNodes));
     memset(&mRealmLocalAllThreadNodes, 0, sizeof(mRealmLocalAllThreadNodes));
     memset(&mLeaderAloc, 0, sizeof(mLeaderAloc));
+    memset(&mStoreCounters, 0, sizeof(mStoreCounters));
     memset(&mParentCandidate, 0, sizeof(mParentCandidate));
 
     // link-local 64
@@ -388,9 +397,10 @@ exit:
 
 otError Mle::Store(void)
 {
-    ThreadNetif &         netif    = GetNetif();
-    Settings &            settings = GetInstance().GetSettings();
-    otError               error    = OT_ERROR_NONE;
+    ThreadNetif &         netif      = GetNetif();
+    Settings &            settings   = GetInstance().GetSettings();
+    KeyManager &          keyManager = netif.GetKeyManager();
+    otError               error      = OT_ERROR_NONE;
     Settings::NetworkInfo networkInfo;
 
     memset(&networkInfo, 0, sizeof(networkInfo));
@@ -423,16 +433,20 @@ otError Mle::Store(void)
     }
 
     // update MAC and MLE Frame Counters even when we are not attached MLE messages are sent before a device attached
-    networkInfo.mKeySequence = netif.GetKeyManager().GetCurrentKeySequence();
-    networkInfo.mMleFrameCounter =
-        netif.GetKeyManager().GetMleFrameCounter() + OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD;
-    networkInfo.mMacFrameCounter =
-        netif.GetKeyManager().GetMacFrameCounter() + OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD;
+    keyManager.UpdateStoreFrameCounterAhead();
+    networkInfo.mKeySequence     = keyManager.GetCurrentKeySequence();
+    networkInfo.mMleFrameCounter = keyManager.GetMleFrameCounter() + keyManager.GetStoreFrameCounterAhead();
+    networkInfo.mMacFrameCounter = keyManager.GetMacFrameCounter() + keyManager.GetStoreFrameCounterAhead();
 
     SuccessOrExit(error = settings.SaveNetworkInfo(networkInfo));
 
-    netif.GetKeyManager().SetStoredMleFrameCounter(networkInfo.mMleFrameCounter);
-    netif.GetKeyManager().SetStoredMacFrameCounter(networkInfo.mMacFrameCounter);
+    // A failed write leaves the request pending, the next `StoreDeferred()` posts the tasklet again.
+    mStorePending = false;
+    mStoreCounters.mStores++;
+    mStoreCounters.mFrameCounterAhead = keyManager.GetStoreFrameCounterAhead();
+
+    keyManager.SetStoredMleFrameCounter(networkInfo.mMleFrameCounter);
+    keyManager.SetStoredMacFrameCounter(networkInfo.mMacFrameCounter);
 
     otLogDebgMle(GetInstance(), "Store Network Information");
 
@@ -440,6 +454,35 @@ exit:
     return error;
 }
 
+void Mle::StoreDeferred(void)
+{
+    if (mStoreTasklet.Post() == OT_ERROR_ALREADY)
+    {
+        mStoreCounters.mCoalescedStores++;
+    }
+
+    mStorePending = true;
+}
+
+void Mle::StoreFrameCounters(void)
+{
+    mStoreCounters.mSyncStores++;
+    Store();
+}
+
+void Mle::HandleStoreTasklet(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<Mle>().HandleStoreTasklet();
+}
+
+void Mle::HandleStoreTasklet(void)
+{
+    if (mStorePending)
+    {
+        Store();
+    }
+}
+
 otError Mle::Discover(uint32_t        aScanChannels,
                       uint16_t        aPanId,
                       bool            aJoiner,
@@ -1873,6 +1916,18 @@ otError Mle::SendDataRequest(const Ip6::Address &aDestination,
     VerifyOrExit((message = NewMleMessage()) != NULL, error = OT_ERROR_NO_BUFS);
     SuccessOrExit(error = AppendHeader(*message, Header::kCommandDataRequest));
     SuccessOrExit(error = AppendTlvRequest(*message, aTlvs, aTlvsLength));
+
+    // Ask for a delta from the full Network Data held, unless it is known to be stale.
+    if (mNetworkDataDeltaEnabled && IsFullNetworkData() && !mRetrieveNewNetworkData &&
+        memchr(aTlvs, Tlv::kNetworkData, aTlvsLength) != NULL)
+    {
+        NetworkDataDeltaTlv delta;
+
+        delta.InitRequest();
+        delta.SetBaseVersion(GetNetif().GetNetworkDataLeader().GetVersion());
+        SuccessOrExit(error = message->Append(&delta, sizeof(Tlv) + delta.GetLength()));
+    }
+
     SuccessOrExit(error = AppendActiveTimestamp(*message));
     SuccessOrExit(error = AppendPendingTimestamp(*message));
 
@@ -2721,6 +2776,22 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
                                                         !IsFullNetworkData(), aMessage, networkDataOffset);
         SuccessOrExit(error);
     }
+    else if (Tlv::GetOffset(aMessage, Tlv::kNetworkDataDelta, networkDataOffset) == OT_ERROR_NONE)
+    {
+        error = ApplyNetworkDataDelta(leaderData, aMessage, networkDataOffset);
+
+        if (error != OT_ERROR_NONE)
+        {
+            // The Network Data held does not match its version, request the full Network Data.
+            if (error == OT_ERROR_SECURITY)
+            {
+                mRetrieveNewNetworkData = true;
+            }
+
+            error = OT_ERROR_NONE;
+            ExitNow(dataRequest = true);
+        }
+    }
     else
     {
         ExitNow(dataRequest = true);
@@ -2774,6 +2845,27 @@ exit:
     return error;
 }
 
+otError Mle::ApplyNetworkDataDelta(const LeaderDataTlv &aLeaderData, const Message &aMessage, uint16_t aOffset)
+{
+    NetworkData::Leader &leader = GetNetif().GetNetworkDataLeader();
+    otError              error  = OT_ERROR_NONE;
+    NetworkDataDeltaTlv  delta;
+    uint8_t              data[NetworkData::NetworkData::kMaxSize];
+    uint8_t              length = sizeof(data);
+
+    VerifyOrExit(aMessage.Read(aOffset, sizeof(delta), &delta) == sizeof(delta) && delta.IsValid(),
+                 error = OT_ERROR_PARSE);
+    VerifyOrExit(IsFullNetworkData() && delta.GetBaseVersion() == leader.GetVersion(), error = OT_ERROR_NOT_FOUND);
+
+    SuccessOrExit(error = leader.GetNetworkData(false, data, length));
+    SuccessOrExit(error = NetworkData::Delta::Apply(aMessage, aOffset, data, length));
+
+    leader.SetNetworkData(aLeaderData.GetDataVersion(), aLeaderData.GetStableDataVersion(), false, data, length);
+
+exit:
+    return error;
+}
+
 bool Mle::IsBetterParent(uint16_t aRloc16, uint8_t aLinkQuality, uint8_t aLinkMargin, ConnectivityTlv &aConnectivityTlv)
 {
     bool rval = false;
@@ -526,6 +526,30 @@ public:
      */
     otError Store(void);
 
+    /**
+     * This method schedules a write of the network information into non-volatile memory.
+     *
+     * The write is done from a tasklet, and requests made while one is pending are merged into it. A call to `Store()`
+     * in the meantime satisfies the pending request.
+     *
+     */
+    void StoreDeferred(void);
+
+    /**
+     * This method stores the network information into non-volatile memory because a frame counter reached its
+     * stored value.
+     *
+     */
+    void StoreFrameCounters(void);
+
+    /**
+     * This method returns the counters of network information writes to non-volatile memory.
+     *
+     * @returns A reference to the network information store counters.
+     *
+     */
+    const otNetworkInfoStoreCounters &GetStoreCounters(void) const { return mStoreCounters; }
+
     /**
      * This function pointer is called on receiving an MLE Discovery Response message.
      *
@@ -670,6 +694,24 @@ public:
      */
     bool IsFullNetworkData(void) const { return (mDeviceMode & ModeTlv::kModeFullNetworkData) != 0; }
 
+    /**
+     * This method indicates whether or not Network Data deltas are requested and sent in multicast Data Responses.
+     *
+     * @returns TRUE if Network Data deltas are enabled, FALSE otherwise.
+     *
+     */
+    bool IsNetworkDataDeltaEnabled(void) const { return mNetworkDataDeltaEnabled; }
+
+    /**
+     * This method enables or disables requesting Network Data deltas and sending them in multicast Data Responses.
+     *
+     * Data Requests holding a Network Data Delta TLV are answered with a delta whenever possible either way.
+     *
+     * @param[in]  aEnabled  TRUE to enable Network Data deltas, FALSE otherwise.
+     *
+     */
+    void SetNetworkDataDeltaEnabled(bool aEnabled) { mNetworkDataDeltaEnabled = aEnabled; }
+
     /**
      * This method indicates whether or not the device is a Minimal End Device.
      *
@@ -1500,6 +1542,7 @@ protected:
 
     LeaderDataTlv mLeaderData;                    ///< Last received Leader Data TLV.
     bool          mRetrieveNewNetworkData;        ///< Indicating new Network Data is needed if set.
+    bool          mNetworkDataDeltaEnabled;       ///< Indicating Network Data deltas are enabled if set.
     otDeviceRole  mRole;                          ///< Current Thread role.
     Router        mParent;                        ///< Parent information.
     uint8_t       mDeviceMode;                    ///< Device mode setting.
@@ -1556,6 +1599,8 @@ private:
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     static void HandleSendChildUpdateRequest(Tasklet &aTasklet);
     void        HandleSendChildUpdateRequest(void);
+    static void HandleStoreTasklet(Tasklet &aTasklet);
+    void        HandleStoreTasklet(void);
 
     otError HandleAdvertisement(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError HandleChildIdResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
@@ -1566,6 +1611,7 @@ private:
     otError HandleAnnounce(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError HandleDiscoveryResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    otError ApplyNetworkDataDelta(const LeaderDataTlv &aLeaderData, const Message &aMessage, uint16_t aOffset);
     void    ProcessAnnounce(void);
 
     otError  SendParentRequest(ParentRequestType aType);
@@ -1628,6 +1674,10 @@ private:
 
     Tasklet mSendChildUpdateRequest;
 
+    Tasklet                    mStoreTasklet;
+    bool                       mStorePending;
+    otNetworkInfoStoreCounters mStoreCounters;
+
     DiscoverHandler mDiscoverHandler;
     void *          mDiscoverContext;
     bool            mIsDiscoverInProgress;
@@ -219,6 +219,9 @@ otError MleRouter::HandleDetachStart(void)
     mRouterTable.ClearNeighbors();
     StopLeader();
     mStateUpdateTimer.Stop();
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    mNetworkDataHistory.Clear();
+#endif
 
     return OT_ERROR_NONE;
 }
@@ -953,6 +956,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     router->ResetLinkFailures();
     router->SetState(Neighbor::kStateValid);
     router->SetKeySequence(aKeySequence);
+    mRouterTable.UpdateRoutes();
 
     if (aRequest)
     {
@@ -1273,8 +1277,13 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
                         continue;
                     }
 
+                    // The leader may be missing from the router table of a child (e.g. right after it downgraded).
                     leader = mRouterTable.GetLeader();
-                    assert(leader != NULL);
+
+                    if (leader == NULL)
+                    {
+                        break;
+                    }
 
                     if (route.GetRouteCost(routeCount) > 0)
                     {
@@ -1289,6 +1298,8 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
 
                     break;
                 }
+
+                mRouterTable.UpdateRoutes();
             }
         }
         else if (IsFullThreadDevice() && (router->GetState() != Neighbor::kStateValid) &&
@@ -1479,6 +1490,8 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
         }
     } while (update);
 
+    mRouterTable.UpdateRoutes();
+
 #if (OPENTHREAD_CONFIG_LOG_MLE && (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO))
 
     for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter.Advance())
@@ -1524,7 +1537,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
 
     // 3. Its current routing path cost to the Leader is infinite.
     leader = mRouterTable.GetLeader();
-    assert(leader != NULL);
+    VerifyOrExit(leader != NULL, error = OT_ERROR_DROP);
 
     VerifyOrExit(mRole == OT_DEVICE_ROLE_LEADER || GetLinkCost(GetLeaderId()) < kMaxRouteCost ||
                      (mRole == OT_DEVICE_ROLE_CHILD && leader->GetCost() + 1 < kMaxRouteCost) ||
@@ -2363,6 +2376,7 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
     TlvRequestTlv       tlvRequest;
     ActiveTimestampTlv  activeTimestamp;
     PendingTimestampTlv pendingTimestamp;
+    NetworkDataDeltaTlv deltaRequest;
     uint8_t             tlvs[4];
     uint8_t             numTlvs;
 
@@ -2388,6 +2402,14 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
 
+    // Network Data Delta
+    deltaRequest.SetLength(0);
+
+    if (Tlv::GetTlv(aMessage, Tlv::kNetworkDataDelta, sizeof(deltaRequest), deltaRequest) == OT_ERROR_NONE)
+    {
+        VerifyOrExit(deltaRequest.IsValidRequest(), error = OT_ERROR_PARSE);
+    }
+
     memset(tlvs, Tlv::kInvalid, sizeof(tlvs));
     memcpy(tlvs, tlvRequest.GetTlvs(), tlvRequest.GetLength());
     numTlvs = tlvRequest.GetLength();
@@ -2402,7 +2424,7 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
         tlvs[numTlvs++] = Tlv::kPendingDataset;
     }
 
-    SendDataResponse(aMessageInfo.GetPeerAddr(), tlvs, numTlvs, 0);
+    SendDataResponse(aMessageInfo.GetPeerAddr(), tlvs, numTlvs, 0, deltaRequest.GetLength() ? &deltaRequest : NULL);
 
 exit:
     return error;
@@ -2413,6 +2435,13 @@ otError MleRouter::HandleNetworkDataUpdateRouter(void)
     static const uint8_t tlvs[] = {Tlv::kNetworkData};
     Ip6::Address         destination;
     uint16_t             delay;
+    NetworkDataDeltaTlv *deltaRequest = NULL;
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    NetworkDataDeltaTlv delta;
+    uint8_t             baseVersion;
+
+    UpdateNetworkDataHistory();
+#endif
 
     VerifyOrExit(mRole == OT_DEVICE_ROLE_ROUTER || mRole == OT_DEVICE_ROLE_LEADER);
 
@@ -2421,7 +2450,20 @@ otError MleRouter::HandleNetworkDataUpdateRouter(void)
     destination.mFields.m16[7] = HostSwap16(0x0001);
 
     delay = (mRole == OT_DEVICE_ROLE_LEADER) ? 0 : Random::GetUint16InRange(0, kUnsolicitedDataResponseJitter);
-    SendDataResponse(destination, tlvs, sizeof(tlvs), delay);
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    // Neighbors most likely hold the version received before the current one. A stable-only child cannot apply a
+    // delta, so the full Network Data is multicast while one that is rx-on-when-idle (and receives it) is attached.
+    if (mNetworkDataDeltaEnabled && !HasRxOnStableOnlyChild() &&
+        mNetworkDataHistory.GetPreviousVersion(baseVersion) == OT_ERROR_NONE)
+    {
+        delta.InitRequest();
+        delta.SetBaseVersion(baseVersion);
+        deltaRequest = &delta;
+    }
+#endif
+
+    SendDataResponse(destination, tlvs, sizeof(tlvs), delay, deltaRequest);
 
     SynchronizeChildNetworkData();
 
@@ -2429,6 +2471,46 @@ exit:
     return OT_ERROR_NONE;
 }
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+void MleRouter::UpdateNetworkDataHistory(void)
+{
+    NetworkData::Leader &leader = GetNetif().GetNetworkDataLeader();
+    uint8_t              data[NetworkData::NetworkData::kMaxSize];
+    uint8_t              length = sizeof(data);
+
+    // Versions saved before deltas were disabled would no longer match their version once they are enabled again.
+    if (!mNetworkDataDeltaEnabled)
+    {
+        mNetworkDataHistory.Clear();
+        ExitNow();
+    }
+
+    leader.GetNetworkData(false, data, length);
+    mNetworkDataHistory.Save(leader.GetVersion(), data, length);
+
+exit:
+    return;
+}
+
+bool MleRouter::HasRxOnStableOnlyChild(void)
+{
+    bool rval = false;
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter.Advance())
+    {
+        Child &child = *iter.GetChild();
+
+        if (child.IsRxOnWhenIdle() && !child.IsFullNetworkData())
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+
 void MleRouter::SynchronizeChildNetworkData(void)
 {
     ThreadNetif &netif = GetNetif();
@@ -2910,10 +2992,11 @@ exit:
     return OT_ERROR_NONE;
 }
 
-otError MleRouter::SendDataResponse(const Ip6::Address &aDestination,
-                                    const uint8_t *     aTlvs,
-                                    uint8_t             aTlvsLength,
-                                    uint16_t            aDelay)
+otError MleRouter::SendDataResponse(const Ip6::Address &       aDestination,
+                                    const uint8_t *            aTlvs,
+                                    uint8_t                    aTlvsLength,
+                                    uint16_t                   aDelay,
+                                    const NetworkDataDeltaTlv *aDeltaRequest)
 {
     otError   error   = OT_ERROR_NONE;
     Message * message = NULL;
@@ -2941,7 +3024,13 @@ otError MleRouter::SendDataResponse(const Ip6::Address &aDestination,
         case Tlv::kNetworkData:
             neighbor   = GetNeighbor(aDestination);
             stableOnly = neighbor != NULL ? !neighbor->IsFullNetworkData() : false;
-            SuccessOrExit(error = AppendNetworkData(*message, stableOnly));
+
+            if (aDeltaRequest == NULL || stableOnly ||
+                AppendNetworkDataDelta(*message, aDeltaRequest->GetBaseVersion()) != OT_ERROR_NONE)
+            {
+                SuccessOrExit(error = AppendNetworkData(*message, stableOnly));
+            }
+
             break;
 
         case Tlv::kActiveDataset:
@@ -2981,6 +3070,24 @@ exit:
     return error;
 }
 
+otError MleRouter::AppendNetworkDataDelta(Message &aMessage, uint8_t aBaseVersion)
+{
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    uint8_t data[NetworkData::NetworkData::kMaxSize];
+    uint8_t length = sizeof(data);
+
+    GetNetif().GetNetworkDataLeader().GetNetworkData(false, data, length);
+
+    return mNetworkDataHistory.AppendDelta(aMessage, aBaseVersion, data, length);
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aBaseVersion);
+
+    // Without a history of Network Data versions, Data Requests are answered with the full Network Data.
+    return OT_ERROR_NOT_FOUND;
+#endif
+}
+
 bool MleRouter::IsMinimalChild(uint16_t aRloc16)
 {
     ThreadNetif &netif = GetNetif();
@@ -3060,6 +3167,7 @@ otError MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
 
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.SetState(Neighbor::kStateInvalid);
+    mRouterTable.UpdateRoutes();
 
     return OT_ERROR_NONE;
 }
@@ -3237,12 +3345,8 @@ exit:
 
 uint16_t MleRouter::GetNextHop(uint16_t aDestination)
 {
-    uint8_t       destinationId = GetRouterId(aDestination);
-    uint8_t       routeCost;
-    uint8_t       linkCost;
-    uint16_t      rval = Mac::kShortAddrInvalid;
-    const Router *router;
-    const Router *nextHop;
+    uint8_t  destinationId = GetRouterId(aDestination);
+    uint16_t rval;
 
     if (mRole == OT_DEVICE_ROLE_CHILD)
     {
@@ -3255,23 +3359,7 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         ExitNow(rval = aDestination);
     }
 
-    router = mRouterTable.GetRouter(destinationId);
-    VerifyOrExit(router != NULL);
-
-    linkCost  = GetLinkCost(destinationId);
-    routeCost = GetRouteCost(aDestination);
-
-    if ((routeCost + GetLinkCost(router->GetNextHop())) < linkCost)
-    {
-        nextHop = mRouterTable.GetRouter(router->GetNextHop());
-        VerifyOrExit(nextHop != NULL && nextHop->GetState() != Neighbor::kStateInvalid);
-
-        rval = GetRloc16(router->GetNextHop());
-    }
-    else if (linkCost < kMaxRouteCost)
-    {
-        rval = GetRloc16(destinationId);
-    }
+    rval = mRouterTable.GetNextHop(destinationId);
 
 exit:
     return rval;
@@ -3279,22 +3367,7 @@ exit:
 
 uint8_t MleRouter::GetCost(uint16_t aRloc16)
 {
-    uint8_t routerId = GetRouterId(aRloc16);
-    uint8_t cost     = GetLinkCost(routerId);
-    Router *router   = mRouterTable.GetRouter(routerId);
-    uint8_t routeCost;
-
-    VerifyOrExit(router != NULL && mRouterTable.GetRouter(router->GetNextHop()) != NULL);
-
-    routeCost = GetRouteCost(aRloc16) + GetLinkCost(mRouterTable.GetRouter(routerId)->GetNextHop());
-
-    if (cost > routeCost)
-    {
-        cost = routeCost;
-    }
-
-exit:
-    return cost;
+    return mRouterTable.GetPathCost(GetRouterId(aRloc16));
 }
 
 uint8_t MleRouter::GetRouteCost(uint16_t aRloc16) const
@@ -3446,6 +3519,15 @@ exit:
     return error;
 }
 
+static void InitStoredChildInfo(const Child &aChild, Settings::ChildInfo &aChildInfo)
+{
+    memset(&aChildInfo, 0, sizeof(aChildInfo));
+    aChildInfo.mExtAddress = aChild.GetExtAddress();
+    aChildInfo.mTimeout    = aChild.GetTimeout();
+    aChildInfo.mRloc16     = aChild.GetRloc16();
+    aChildInfo.mMode       = aChild.GetDeviceMode();
+}
+
 otError MleRouter::StoreChild(uint16_t aChildRloc16)
 {
     otError             error = OT_ERROR_NONE;
@@ -3457,12 +3539,7 @@ otError MleRouter::StoreChild(uint16_t aChildRloc16)
 
     IgnoreReturnValue(RemoveStoredChild(aChildRloc16));
 
-    memset(&childInfo, 0, sizeof(childInfo));
-    childInfo.mExtAddress = child->GetExtAddress();
-    childInfo.mTimeout    = child->GetTimeout();
-    childInfo.mRloc16     = child->GetRloc16();
-    childInfo.mMode       = child->GetDeviceMode();
-
+    InitStoredChildInfo(*child, childInfo);
     error = GetInstance().GetSettings().AddChildInfo(childInfo);
 
 exit:
@@ -3471,16 +3548,32 @@ exit:
 
 otError MleRouter::RefreshStoredChildren(void)
 {
-    otError error = OT_ERROR_NONE;
+    Settings &settings = GetInstance().GetSettings();
+    otError   error    = OT_ERROR_NONE;
+    bool      inChange;
 
-    SuccessOrExit(error = GetInstance().GetSettings().DeleteChildInfo());
+    // All the entries are rewritten as one change, so that the platform can batch the writes. The list is empty
+    // once deleted, so the entries are added directly instead of going through `StoreChild()`. A change already
+    // begun by the caller is left for the caller to commit.
+    inChange = (settings.BeginChange() == OT_ERROR_NONE);
+
+    SuccessOrExit(error = settings.DeleteChildInfo());
 
     for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter.Advance())
     {
-        SuccessOrExit(error = StoreChild(iter.GetChild()->GetRloc16()));
+        Settings::ChildInfo childInfo;
+
+        InitStoredChildInfo(*iter.GetChild(), childInfo);
+        SuccessOrExit(error = settings.AddChildInfo(childInfo));
     }
 
 exit:
+
+    if (inChange)
+    {
+        IgnoreReturnValue(settings.CommitChange());
+    }
+
     return error;
 }
 
@@ -3609,6 +3702,7 @@ void MleRouter::ResolveRoutingLoops(uint16_t aSourceMac, uint16_t aDestRloc16)
 
     // invalidate next hop
     router->SetNextHop(kInvalidRouterId);
+    mRouterTable.UpdateRoutes();
     ResetAdvertiseInterval();
 
 exit:
@@ -3858,6 +3952,8 @@ void MleRouter::HandleAddressSolicitResponse(Coap::Header *          aHeader,
         leader->SetNextHop(GetRouterId(mParent.GetRloc16()));
     }
 
+    mRouterTable.UpdateRoutes();
+
     // send link request
     SendLinkRequest(NULL);
 
@@ -4260,26 +4356,7 @@ void MleRouter::FillRouteTlv(RouteTlv &aTlv)
         }
         else
         {
-            Router *nextHop;
-            uint8_t linkCost;
-            uint8_t routeCost;
-
-            linkCost = mRouterTable.GetLinkCost(router);
-            nextHop  = mRouterTable.GetRouter(router.GetNextHop());
-
-            if (nextHop == NULL)
-            {
-                routeCost = linkCost;
-            }
-            else
-            {
-                routeCost = router.GetCost() + mRouterTable.GetLinkCost(*nextHop);
-
-                if (linkCost < routeCost)
-                {
-                    routeCost = linkCost;
-                }
-            }
+            uint8_t routeCost = mRouterTable.GetPathCost(router.GetRouterId());
 
             if (routeCost >= kMaxRouteCost)
             {
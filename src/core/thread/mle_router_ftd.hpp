@@ -51,6 +51,7 @@
 #include "thread/child_table.hpp"
 #include "thread/mle.hpp"
 #include "thread/mle_tlvs.hpp"
+#include "thread/network_data_delta.hpp"
 #include "thread/router_table.hpp"
 #include "thread/thread_tlvs.hpp"
 #include "thread/topology.hpp"
@@ -728,16 +729,22 @@ private:
                                     const uint8_t *         aTlvs,
                                     uint8_t                 aTlvsLength,
                                     const ChallengeTlv *    challenge);
-    otError SendDataResponse(const Ip6::Address &aDestination,
-                             const uint8_t *     aTlvs,
-                             uint8_t             aTlvsLength,
-                             uint16_t            aDelay);
+    otError SendDataResponse(const Ip6::Address &       aDestination,
+                             const uint8_t *            aTlvs,
+                             uint8_t                    aTlvsLength,
+                             uint16_t                   aDelay,
+                             const NetworkDataDeltaTlv *aDeltaRequest);
     otError SendDiscoveryResponse(const Ip6::Address &aDestination, uint16_t aPanId);
+    otError AppendNetworkDataDelta(Message &aMessage, uint8_t aBaseVersion);
 
     otError SetStateRouter(uint16_t aRloc16);
     otError SetStateLeader(uint16_t aRloc16);
     void    StopLeader(void);
     void    SynchronizeChildNetworkData(void);
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    void    UpdateNetworkDataHistory(void);
+    bool    HasRxOnStableOnlyChild(void);
+#endif
     otError UpdateChildAddresses(const Message &aMessage, uint16_t aOffset, Child &aChild);
     void    UpdateRoutes(const RouteTlv &aTlv, uint8_t aRouterId);
 
@@ -788,6 +795,10 @@ private:
     ChildTable  mChildTable;
     RouterTable mRouterTable;
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    NetworkData::DeltaHistory mNetworkDataHistory;
+#endif
+
     otThreadChildTableCallback mChildTableChangedCallback;
 
     uint8_t  mChallengeTimeout;
@@ -82,33 +82,34 @@ public:
      */
     enum Type
     {
-        kSourceAddress       = 0,  ///< Source Address TLV
-        kMode                = 1,  ///< Mode TLV
-        kTimeout             = 2,  ///< Timeout TLV
-        kChallenge           = 3,  ///< Challenge TLV
-        kResponse            = 4,  ///< Response TLV
-        kLinkFrameCounter    = 5,  ///< Link-Layer Frame Counter TLV
-        kLinkQuality         = 6,  ///< Link Quality TLV
-        kNetworkParameter    = 7,  ///< Network Parameter TLV
-        kMleFrameCounter     = 8,  ///< MLE Frame Counter TLV
-        kRoute               = 9,  ///< Route64 TLV
-        kAddress16           = 10, ///< Address16 TLV
-        kLeaderData          = 11, ///< Leader Data TLV
-        kNetworkData         = 12, ///< Network Data TLV
-        kTlvRequest          = 13, ///< TLV Request TLV
-        kScanMask            = 14, ///< Scan Mask TLV
-        kConnectivity        = 15, ///< Connectivity TLV
-        kLinkMargin          = 16, ///< Link Margin TLV
-        kStatus              = 17, ///< Status TLV
-        kVersion             = 18, ///< Version TLV
-        kAddressRegistration = 19, ///< Address Registration TLV
-        kChannel             = 20, ///< Channel TLV
-        kPanId               = 21, ///< PAN ID TLV
-        kActiveTimestamp     = 22, ///< Active Timestamp TLV
-        kPendingTimestamp    = 23, ///< Pending Timestamp TLV
-        kActiveDataset       = 24, ///< Active Operational Dataset TLV
-        kPendingDataset      = 25, ///< Pending Operational Dataset TLV
-        kDiscovery           = 26, ///< Thread Discovery TLV
+        kSourceAddress       = 0,   ///< Source Address TLV
+        kMode                = 1,   ///< Mode TLV
+        kTimeout             = 2,   ///< Timeout TLV
+        kChallenge           = 3,   ///< Challenge TLV
+        kResponse            = 4,   ///< Response TLV
+        kLinkFrameCounter    = 5,   ///< Link-Layer Frame Counter TLV
+        kLinkQuality         = 6,   ///< Link Quality TLV
+        kNetworkParameter    = 7,   ///< Network Parameter TLV
+        kMleFrameCounter     = 8,   ///< MLE Frame Counter TLV
+        kRoute               = 9,   ///< Route64 TLV
+        kAddress16           = 10,  ///< Address16 TLV
+        kLeaderData          = 11,  ///< Leader Data TLV
+        kNetworkData         = 12,  ///< Network Data TLV
+        kTlvRequest          = 13,  ///< TLV Request TLV
+        kScanMask            = 14,  ///< Scan Mask TLV
+        kConnectivity        = 15,  ///< Connectivity TLV
+        kLinkMargin          = 16,  ///< Link Margin TLV
+        kStatus              = 17,  ///< Status TLV
+        kVersion             = 18,  ///< Version TLV
+        kAddressRegistration = 19,  ///< Address Registration TLV
+        kChannel             = 20,  ///< Channel TLV
+        kPanId               = 21,  ///< PAN ID TLV
+        kActiveTimestamp     = 22,  ///< Active Timestamp TLV
+        kPendingTimestamp    = 23,  ///< Pending Timestamp TLV
+        kActiveDataset       = 24,  ///< Active Operational Dataset TLV
+        kPendingDataset      = 25,  ///< Pending Operational Dataset TLV
+        kDiscovery           = 26,  ///< Thread Discovery TLV
+        kNetworkDataDelta    = 251, ///< Network Data Delta TLV (not part of the Thread Specification)
         kInvalid             = 255,
     };
 
@@ -884,6 +885,148 @@ private:
     uint8_t mNetworkData[255];
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements Network Data Delta TLV generation and parsing.
+ *
+ * In an MLE Data Request, the TLV only holds the Base Version: the version of the full Network Data held by the
+ * requester. In an MLE Data Response, it describes the current full Network Data as the Network Data of the Base
+ * Version with `Remove Length` bytes at `Offset` replaced by the bytes following the TLV header.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class NetworkDataDeltaTlv : public Tlv
+{
+public:
+    enum
+    {
+        kRequestLength = 1, ///< The length of the TLV in an MLE Data Request.
+    };
+
+    /**
+     * This method initializes the TLV for an MLE Data Response.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kNetworkDataDelta);
+        SetLength(sizeof(*this) - sizeof(Tlv));
+    }
+
+    /**
+     * This method initializes the TLV for an MLE Data Request.
+     *
+     */
+    void InitRequest(void)
+    {
+        SetType(kNetworkDataDelta);
+        SetLength(kRequestLength);
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be a well-formed MLE Data Request TLV.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValidRequest(void) const { return GetLength() >= kRequestLength; }
+
+    /**
+     * This method indicates whether or not the TLV appears to be a well-formed MLE Data Response TLV.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(Tlv); }
+
+    /**
+     * This method returns the Base Version value.
+     *
+     * @returns The Base Version value.
+     *
+     */
+    uint8_t GetBaseVersion(void) const { return mBaseVersion; }
+
+    /**
+     * This method sets the Base Version value.
+     *
+     * @param[in]  aVersion  The Base Version value.
+     *
+     */
+    void SetBaseVersion(uint8_t aVersion) { mBaseVersion = aVersion; }
+
+    /**
+     * This method returns the Checksum value, the CRC16-CCITT of the resulting Network Data.
+     *
+     * @returns The Checksum value.
+     *
+     */
+    uint16_t GetChecksum(void) const { return HostSwap16(mChecksum); }
+
+    /**
+     * This method sets the Checksum value.
+     *
+     * @param[in]  aChecksum  The Checksum value.
+     *
+     */
+    void SetChecksum(uint16_t aChecksum) { mChecksum = HostSwap16(aChecksum); }
+
+    /**
+     * This method returns the Offset value.
+     *
+     * @returns The Offset value.
+     *
+     */
+    uint8_t GetOffset(void) const { return mOffset; }
+
+    /**
+     * This method sets the Offset value.
+     *
+     * @param[in]  aOffset  The Offset value.
+     *
+     */
+    void SetOffset(uint8_t aOffset) { mOffset = aOffset; }
+
+    /**
+     * This method returns the Remove Length value.
+     *
+     * @returns The Remove Length value.
+     *
+     */
+    uint8_t GetRemoveLength(void) const { return mRemoveLength; }
+
+    /**
+     * This method sets the Remove Length value.
+     *
+     * @param[in]  aLength  The Remove Length value.
+     *
+     */
+    void SetRemoveLength(uint8_t aLength) { mRemoveLength = aLength; }
+
+    /**
+     * This method returns the number of bytes inserted at Offset, which follow the TLV header.
+     *
+     * @returns The number of inserted bytes.
+     *
+     */
+    uint8_t GetInsertLength(void) const { return GetLength() - (sizeof(*this) - sizeof(Tlv)); }
+
+    /**
+     * This method sets the number of bytes inserted at Offset.
+     *
+     * @param[in]  aLength  The number of inserted bytes.
+     *
+     */
+    void SetInsertLength(uint8_t aLength) { SetLength(sizeof(*this) - sizeof(Tlv) + aLength); }
+
+private:
+    uint8_t  mBaseVersion;
+    uint16_t mChecksum;
+    uint8_t  mOffset;
+    uint8_t  mRemoveLength;
+} OT_TOOL_PACKED_END;
+
 /**
  * This class implements Source Address TLV generation and parsing.
  *
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file implements the encoding of Thread Network Data as a delta from a previous version.
+ */
+
+#include "network_data_delta.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/crc16.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/network_data.hpp"
+
+namespace ot {
+namespace NetworkData {
+
+otError Delta::Append(Message &      aMessage,
+                      uint8_t        aBaseVersion,
+                      const uint8_t *aBase,
+                      uint8_t        aBaseLength,
+                      const uint8_t *aData,
+                      uint8_t        aDataLength)
+{
+    otError                  error  = OT_ERROR_NONE;
+    uint8_t                  prefix = 0;
+    uint8_t                  suffix = 0;
+    uint8_t                  insertLength;
+    Mle::NetworkDataDeltaTlv tlv;
+
+    while (prefix < aBaseLength && prefix < aDataLength && aBase[prefix] == aData[prefix])
+    {
+        prefix++;
+    }
+
+    while (suffix < aBaseLength - prefix && suffix < aDataLength - prefix &&
+           aBase[aBaseLength - 1 - suffix] == aData[aDataLength - 1 - suffix])
+    {
+        suffix++;
+    }
+
+    insertLength = aDataLength - prefix - suffix;
+    VerifyOrExit(sizeof(tlv) + insertLength < sizeof(Mle::Tlv) + aDataLength, error = OT_ERROR_NOT_FOUND);
+
+    tlv.Init();
+    tlv.SetBaseVersion(aBaseVersion);
+    tlv.SetChecksum(ComputeChecksum(aData, aDataLength));
+    tlv.SetOffset(prefix);
+    tlv.SetRemoveLength(aBaseLength - prefix - suffix);
+    tlv.SetInsertLength(insertLength);
+
+    SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
+    error = aMessage.Append(aData + prefix, insertLength);
+
+exit:
+    return error;
+}
+
+otError Delta::Apply(const Message &aMessage, uint16_t aOffset, uint8_t *aData, uint8_t &aDataLength)
+{
+    otError                  error = OT_ERROR_NONE;
+    Mle::NetworkDataDeltaTlv tlv;
+    uint8_t                  tailLength;
+
+    VerifyOrExit(aMessage.Read(aOffset, sizeof(tlv), &tlv) == sizeof(tlv) && tlv.IsValid(), error = OT_ERROR_PARSE);
+    VerifyOrExit(tlv.GetOffset() + tlv.GetRemoveLength() <= aDataLength, error = OT_ERROR_PARSE);
+
+    tailLength = aDataLength - tlv.GetOffset() - tlv.GetRemoveLength();
+    VerifyOrExit(tlv.GetOffset() + tlv.GetInsertLength() + tailLength <= NetworkData::kMaxSize, error = OT_ERROR_PARSE);
+
+    memmove(aData + tlv.GetOffset() + tlv.GetInsertLength(), aData + tlv.GetOffset() + tlv.GetRemoveLength(),
+            tailLength);
+    VerifyOrExit(aMessage.Read(aOffset + sizeof(tlv), tlv.GetInsertLength(), aData + tlv.GetOffset()) ==
+                     tlv.GetInsertLength(),
+                 error = OT_ERROR_PARSE);
+
+    aDataLength = tlv.GetOffset() + tlv.GetInsertLength() + tailLength;
+    VerifyOrExit(ComputeChecksum(aData, aDataLength) == tlv.GetChecksum(), error = OT_ERROR_SECURITY);
+
+exit:
+    return error;
+}
+
+uint16_t Delta::ComputeChecksum(const uint8_t *aData, uint8_t aDataLength)
+{
+    Crc16 crc(Crc16::kCcitt);
+
+    crc.Init();
+
+    for (uint8_t i = 0; i < aDataLength; i++)
+    {
+        crc.Update(aData[i]);
+    }
+
+    return crc.Get();
+}
+
+DeltaHistory::DeltaHistory(void)
+{
+    Clear();
+}
+
+void DeltaHistory::Clear(void)
+{
+    mNext  = 0;
+    mCount = 0;
+}
+
+void DeltaHistory::Save(uint8_t aVersion, const uint8_t *aData, uint8_t aDataLength)
+{
+    Entry *entry;
+
+    if (mCount > 0 && GetEntry(0)->mVersion == aVersion)
+    {
+        entry = const_cast<Entry *>(GetEntry(0));
+    }
+    else
+    {
+        entry = &mEntries[mNext];
+        mNext = (mNext + 1) % kSize;
+
+        if (mCount < kSize)
+        {
+            mCount++;
+        }
+    }
+
+    entry->mVersion = aVersion;
+    entry->mLength  = aDataLength;
+    memcpy(entry->mTlvs, aData, aDataLength);
+}
+
+otError DeltaHistory::GetPreviousVersion(uint8_t &aVersion) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mCount >= 2, error = OT_ERROR_NOT_FOUND);
+    aVersion = GetEntry(1)->mVersion;
+
+exit:
+    return error;
+}
+
+otError DeltaHistory::AppendDelta(Message &      aMessage,
+                                  uint8_t        aBaseVersion,
+                                  const uint8_t *aData,
+                                  uint8_t        aDataLength) const
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (uint8_t age = 0; age < mCount; age++)
+    {
+        const Entry *entry = GetEntry(age);
+
+        if (entry->mVersion == aBaseVersion)
+        {
+            error = Delta::Append(aMessage, aBaseVersion, entry->mTlvs, entry->mLength, aData, aDataLength);
+            break;
+        }
+    }
+
+    return error;
+}
+
+} // namespace NetworkData
+} // namespace ot
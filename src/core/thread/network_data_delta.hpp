@@ -0,0 +1,201 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definitions for encoding Thread Network Data as a delta from a previous version.
+ */
+
+#ifndef NETWORK_DATA_DELTA_HPP_
+#define NETWORK_DATA_DELTA_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/types.h>
+
+#include "common/message.hpp"
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_HISTORY_SIZE < 2
+#error OPENTHREAD_CONFIG_MLE_NETWORK_DATA_HISTORY_SIZE should be at least set to 2.
+#endif
+
+namespace ot {
+
+/**
+ * @addtogroup core-netdata-delta
+ *
+ * @brief
+ *   This module includes definitions for encoding Thread Network Data as a delta from a previous version.
+ *
+ * @{
+ */
+
+namespace NetworkData {
+
+/**
+ * This class implements the encoding and decoding of Network Data Delta TLVs.
+ *
+ * A delta replaces a single range of the base Network Data: the bytes that differ between the common prefix and the
+ * common suffix of the base and the new Network Data.
+ *
+ */
+class Delta
+{
+public:
+    /**
+     * This static method appends a Network Data Delta TLV to a message.
+     *
+     * @param[in]  aMessage      A reference to the message.
+     * @param[in]  aBaseVersion  The version of the base Network Data.
+     * @param[in]  aBase         A pointer to the base Network Data.
+     * @param[in]  aBaseLength   The length of @p aBase in bytes.
+     * @param[in]  aData         A pointer to the new Network Data.
+     * @param[in]  aDataLength   The length of @p aData in bytes.
+     *
+     * @retval OT_ERROR_NONE       Successfully appended the Network Data Delta TLV.
+     * @retval OT_ERROR_NOT_FOUND  The delta would not be smaller than a Network Data TLV holding @p aData.
+     * @retval OT_ERROR_NO_BUFS    Insufficient buffers available to append the Network Data Delta TLV.
+     *
+     */
+    static otError Append(Message &      aMessage,
+                          uint8_t        aBaseVersion,
+                          const uint8_t *aBase,
+                          uint8_t        aBaseLength,
+                          const uint8_t *aData,
+                          uint8_t        aDataLength);
+
+    /**
+     * This static method applies a Network Data Delta TLV to the base Network Data.
+     *
+     * The caller verifies that the Base Version of the TLV matches the version of the base Network Data. On failure,
+     * @p aData is left in an undefined state.
+     *
+     * @param[in]     aMessage     A reference to the message.
+     * @param[in]     aOffset      The offset in @p aMessage of the Network Data Delta TLV.
+     * @param[inout]  aData        A pointer to the base Network Data, replaced by the new Network Data. The buffer
+     *                             must hold `NetworkData::kMaxSize` bytes.
+     * @param[inout]  aDataLength  The length of the base Network Data, replaced by the length of the new one.
+     *
+     * @retval OT_ERROR_NONE      Successfully applied the delta.
+     * @retval OT_ERROR_PARSE     The Network Data Delta TLV is not well-formed or does not fit the base Network Data.
+     * @retval OT_ERROR_SECURITY  The checksum of the resulting Network Data does not match.
+     *
+     */
+    static otError Apply(const Message &aMessage, uint16_t aOffset, uint8_t *aData, uint8_t &aDataLength);
+
+private:
+    static uint16_t ComputeChecksum(const uint8_t *aData, uint8_t aDataLength);
+};
+
+/**
+ * This class implements the history of recent Network Data versions a router encodes deltas from.
+ *
+ */
+class DeltaHistory
+{
+public:
+    /**
+     * This constructor initializes the history.
+     *
+     */
+    DeltaHistory(void);
+
+    /**
+     * This method removes all versions from the history.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method saves a Network Data version in the history, replacing the oldest one if the history is full.
+     *
+     * Saving the most recently saved version again only updates its content.
+     *
+     * @param[in]  aVersion     The version of the Network Data.
+     * @param[in]  aData        A pointer to the Network Data.
+     * @param[in]  aDataLength  The length of @p aData in bytes.
+     *
+     */
+    void Save(uint8_t aVersion, const uint8_t *aData, uint8_t aDataLength);
+
+    /**
+     * This method gets the version saved before the most recent one.
+     *
+     * @param[out]  aVersion  The previous version.
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the previous version.
+     * @retval OT_ERROR_NOT_FOUND  Less than two versions are saved.
+     *
+     */
+    otError GetPreviousVersion(uint8_t &aVersion) const;
+
+    /**
+     * This method appends a Network Data Delta TLV encoding Network Data from a saved version.
+     *
+     * @param[in]  aMessage      A reference to the message.
+     * @param[in]  aBaseVersion  The version to encode the delta from.
+     * @param[in]  aData         A pointer to the new Network Data.
+     * @param[in]  aDataLength   The length of @p aData in bytes.
+     *
+     * @retval OT_ERROR_NONE       Successfully appended the Network Data Delta TLV.
+     * @retval OT_ERROR_NOT_FOUND  @p aBaseVersion is not saved, or the delta would not be smaller than the Network
+     *                             Data.
+     * @retval OT_ERROR_NO_BUFS    Insufficient buffers available to append the Network Data Delta TLV.
+     *
+     */
+    otError AppendDelta(Message &aMessage, uint8_t aBaseVersion, const uint8_t *aData, uint8_t aDataLength) const;
+
+private:
+    enum
+    {
+        kSize        = OPENTHREAD_CONFIG_MLE_NETWORK_DATA_HISTORY_SIZE,
+        kMaxDataSize = 255, ///< Maximum size of Thread Network Data in bytes.
+    };
+
+    struct Entry
+    {
+        uint8_t mVersion;
+        uint8_t mLength;
+        uint8_t mTlvs[kMaxDataSize];
+    };
+
+    const Entry *GetEntry(uint8_t aAge) const { return &mEntries[(mNext + kSize - 1 - aAge) % kSize]; }
+
+    Entry   mEntries[kSize];
+    uint8_t mNext;
+    uint8_t mCount;
+};
+
+} // namespace NetworkData
+
+/**
+ * @}
+ */
+
+} // namespace ot
+
+#endif // NETWORK_DATA_DELTA_HPP_
@@ -420,11 +420,30 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
     length = aMessage.Read(aMessageOffset + sizeof(tlv), tlv.GetLength(), mTlvs);
     VerifyOrExit(length == tlv.GetLength(), error = OT_ERROR_PARSE);
 
-    mLength        = tlv.GetLength();
+    mLength = tlv.GetLength();
+    CompleteSetNetworkData(aVersion, aStableVersion, aStable);
+
+exit:
+    return error;
+}
+
+void LeaderBase::SetNetworkData(uint8_t        aVersion,
+                                uint8_t        aStableVersion,
+                                bool           aStableOnly,
+                                const uint8_t *aData,
+                                uint8_t        aDataLength)
+{
+    memcpy(mTlvs, aData, aDataLength);
+    mLength = aDataLength;
+    CompleteSetNetworkData(aVersion, aStableVersion, aStableOnly);
+}
+
+void LeaderBase::CompleteSetNetworkData(uint8_t aVersion, uint8_t aStableVersion, bool aStableOnly)
+{
     mVersion       = aVersion;
     mStableVersion = aStableVersion;
 
-    if (aStable)
+    if (aStableOnly)
     {
         RemoveTemporaryData(mTlvs, mLength);
     }
@@ -432,9 +451,6 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
     otDumpDebgNetData(GetInstance(), "set network data", mTlvs, mLength);
 
     GetNotifier().SetFlags(OT_CHANGED_THREAD_NETDATA);
-
-exit:
-    return error;
 }
 
 otError LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLength)
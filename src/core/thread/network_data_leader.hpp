@@ -166,6 +166,22 @@ public:
                            const Message &aMessage,
                            uint16_t       aMessageOffset);
 
+    /**
+     * This method is used by non-Leader devices to set Network Data rebuilt from a delta.
+     *
+     * @param[in]  aVersion        The Version value.
+     * @param[in]  aStableVersion  The Stable Version value.
+     * @param[in]  aStableOnly     TRUE if storing only the stable data, FALSE otherwise.
+     * @param[in]  aData           A pointer to the Network Data.
+     * @param[in]  aDataLength     The length of @p aData in bytes.
+     *
+     */
+    void SetNetworkData(uint8_t        aVersion,
+                        uint8_t        aStableVersion,
+                        bool           aStableOnly,
+                        const uint8_t *aData,
+                        uint8_t        aDataLength);
+
     /**
      * This method sends a Server Data Notification message to the Leader indicating an invalid RLOC16.
      *
@@ -236,6 +252,7 @@ protected:
     uint8_t mVersion;
 
 private:
+    void    CompleteSetNetworkData(uint8_t aVersion, uint8_t aStableVersion, bool aStableOnly);
     otError RemoveCommissioningData(void);
 
     otError ExternalRouteLookup(uint8_t             aDomainId,
@@ -726,6 +726,183 @@ exit:
     return rval;
 }
 
+bool Leader::IsRlocUpdated(uint16_t aRloc16,
+                           uint8_t *aTlvs,
+                           uint8_t  aTlvsLength,
+                           uint8_t *aTlvsBase,
+                           uint8_t  aTlvsBaseLength)
+{
+    bool            rval = true;
+    NetworkDataTlv *cur  = reinterpret_cast<NetworkDataTlv *>(aTlvs);
+    NetworkDataTlv *end  = reinterpret_cast<NetworkDataTlv *>(aTlvs + aTlvsLength);
+    NetworkDataTlv *subCur;
+    NetworkDataTlv *subEnd;
+    bool            found;
+
+    while (cur < end)
+    {
+        VerifyOrExit((cur + 1) <= end && cur->GetNext() <= end);
+
+        switch (cur->GetType())
+        {
+        case NetworkDataTlv::kTypePrefix:
+        {
+            PrefixTlv *prefix = static_cast<PrefixTlv *>(cur);
+            PrefixTlv *prefixBase;
+
+            VerifyOrExit(prefix->IsValid());
+
+            prefixBase = FindPrefix(prefix->GetPrefix(), prefix->GetPrefixLength(), aTlvsBase, aTlvsBaseLength);
+            subCur     = prefix->GetSubTlvs();
+            subEnd     = prefix->GetNext();
+
+            while (subCur < subEnd)
+            {
+                VerifyOrExit((subCur + 1) <= subEnd && subCur->GetNext() <= subEnd);
+
+                switch (subCur->GetType())
+                {
+                case NetworkDataTlv::kTypeBorderRouter:
+                {
+                    BorderRouterTlv *borderRouter     = static_cast<BorderRouterTlv *>(subCur);
+                    BorderRouterTlv *borderRouterBase = NULL;
+
+                    if (prefixBase != NULL)
+                    {
+                        borderRouterBase = FindBorderRouter(*prefixBase, borderRouter->IsStable());
+                    }
+
+                    for (uint8_t i = 0; i < borderRouter->GetNumEntries(); i++)
+                    {
+                        if (borderRouter->GetEntry(i)->GetRloc() != aRloc16)
+                        {
+                            continue;
+                        }
+
+                        VerifyOrExit(borderRouterBase != NULL);
+                        found = false;
+
+                        for (uint8_t j = 0; j < borderRouterBase->GetNumEntries() && !found; j++)
+                        {
+                            found = (memcmp(borderRouter->GetEntry(i), borderRouterBase->GetEntry(j),
+                                            sizeof(BorderRouterEntry)) == 0);
+                        }
+
+                        VerifyOrExit(found);
+                    }
+
+                    break;
+                }
+
+                case NetworkDataTlv::kTypeHasRoute:
+                {
+                    HasRouteTlv *hasRoute     = static_cast<HasRouteTlv *>(subCur);
+                    HasRouteTlv *hasRouteBase = NULL;
+
+                    if (prefixBase != NULL)
+                    {
+                        hasRouteBase = FindHasRoute(*prefixBase, hasRoute->IsStable());
+                    }
+
+                    for (uint8_t i = 0; i < hasRoute->GetNumEntries(); i++)
+                    {
+                        if (hasRoute->GetEntry(i)->GetRloc() != aRloc16)
+                        {
+                            continue;
+                        }
+
+                        VerifyOrExit(hasRouteBase != NULL);
+                        found = false;
+
+                        for (uint8_t j = 0; j < hasRouteBase->GetNumEntries() && !found; j++)
+                        {
+                            found = (memcmp(hasRoute->GetEntry(i), hasRouteBase->GetEntry(j),
+                                            sizeof(HasRouteEntry)) == 0);
+                        }
+
+                        VerifyOrExit(found);
+                    }
+
+                    break;
+                }
+
+                default:
+                    break;
+                }
+
+                subCur = subCur->GetNext();
+            }
+
+            break;
+        }
+
+#if OPENTHREAD_ENABLE_SERVICE
+
+        case NetworkDataTlv::kTypeService:
+        {
+            ServiceTlv *service = static_cast<ServiceTlv *>(cur);
+            ServiceTlv *serviceBase;
+
+            VerifyOrExit(service->IsValid());
+
+            serviceBase = FindService(service->GetEnterpriseNumber(), service->GetServiceData(),
+                                      service->GetServiceDataLength(), aTlvsBase, aTlvsBaseLength);
+            subCur      = service->GetSubTlvs();
+            subEnd      = service->GetNext();
+
+            while (subCur < subEnd)
+            {
+                VerifyOrExit((subCur + 1) <= subEnd && subCur->GetNext() <= subEnd);
+
+                if (subCur->GetType() == NetworkDataTlv::kTypeServer)
+                {
+                    ServerTlv *     server = static_cast<ServerTlv *>(subCur);
+                    NetworkDataTlv *baseCur;
+                    NetworkDataTlv *baseEnd;
+
+                    VerifyOrExit(server->IsValid());
+
+                    if (server->GetServer16() == aRloc16)
+                    {
+                        VerifyOrExit(serviceBase != NULL);
+                        found   = false;
+                        baseCur = serviceBase->GetSubTlvs();
+                        baseEnd = serviceBase->GetNext();
+
+                        while (baseCur < baseEnd && !found)
+                        {
+                            found = (baseCur->GetType() == NetworkDataTlv::kTypeServer &&
+                                     baseCur->IsStable() == server->IsStable() &&
+                                     baseCur->GetLength() == server->GetLength() &&
+                                     memcmp(baseCur->GetValue(), server->GetValue(), server->GetLength()) == 0);
+                            baseCur = baseCur->GetNext();
+                        }
+
+                        VerifyOrExit(found);
+                    }
+                }
+
+                subCur = subCur->GetNext();
+            }
+
+            break;
+        }
+
+#endif
+
+        default:
+            break;
+        }
+
+        cur = cur->GetNext();
+    }
+
+    rval = false;
+
+exit:
+    return rval;
+}
+
 otError Leader::RegisterNetworkData(uint16_t aRloc16, uint8_t *aTlvs, uint8_t aTlvsLength)
 {
     otError error         = OT_ERROR_NONE;
@@ -739,6 +916,11 @@ otError Leader::RegisterNetworkData(uint16_t aRloc16, uint8_t *aTlvs, uint8_t aT
 
     if (rlocIn)
     {
+        // Leave the Network Data and its version untouched when the registration matches what is already stored,
+        // so that a repeated Server Data Notification is not distributed to every device again.
+        VerifyOrExit(IsRlocUpdated(aRloc16, aTlvs, aTlvsLength, mTlvs, mLength) ||
+                     IsRlocUpdated(aRloc16, mTlvs, mLength, aTlvs, aTlvsLength));
+
         if (IsStableUpdated(aTlvs, aTlvsLength, mTlvs, mLength) || IsStableUpdated(mTlvs, mLength, aTlvs, aTlvsLength))
         {
             stableUpdated = true;
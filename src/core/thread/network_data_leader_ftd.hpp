@@ -129,6 +129,23 @@ public:
      */
     void RemoveBorderRouter(uint16_t aRloc16);
 
+    /**
+     * This method replaces the Network Data registered by a given RLOC16.
+     *
+     * A registration that matches what the RLOC16 already contributes leaves the Network Data and its version
+     * untouched.
+     *
+     * @param[in]  aRloc16       The RLOC16 of the registering device.
+     * @param[in]  aTlvs         A pointer to the registered Network Data TLVs.
+     * @param[in]  aTlvsLength   The length of the registered Network Data TLVs in bytes.
+     *
+     * @retval OT_ERROR_NONE     Successfully registered the Network Data.
+     * @retval OT_ERROR_PARSE    The registered Network Data is malformed.
+     * @retval OT_ERROR_NO_BUFS  Insufficient space to store the registered Network Data.
+     *
+     */
+    otError RegisterNetworkData(uint16_t aRloc16, uint8_t *aTlvs, uint8_t aTlvsLength);
+
     /**
      * This method sends a Server Data Notification message to the Leader indicating an invalid RLOC16.
      *
@@ -161,8 +178,6 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    otError RegisterNetworkData(uint16_t aRloc16, uint8_t *aTlvs, uint8_t aTlvsLength);
-
     otError AddHasRoute(PrefixTlv &aPrefix, HasRouteTlv &aHasRoute);
     otError AddBorderRouter(PrefixTlv &aPrefix, BorderRouterTlv &aBorderRouter);
     otError AddNetworkData(uint8_t *aTlvs, uint8_t aTlvsLength, uint8_t *aOldTlvs, uint8_t aOldTlvsLength);
@@ -190,6 +205,11 @@ private:
 
     otError RlocLookup(uint16_t aRloc16, bool &aIn, bool &aStable, uint8_t *aTlvs, uint8_t aTlvsLength);
     bool    IsStableUpdated(uint8_t *aTlvs, uint8_t aTlvsLength, uint8_t *aTlvsBase, uint8_t aTlvsBaseLength);
+    bool    IsRlocUpdated(uint16_t aRloc16,
+                          uint8_t *aTlvs,
+                          uint8_t  aTlvsLength,
+                          uint8_t *aTlvsBase,
+                          uint8_t  aTlvsBaseLength);
 
     static void HandleCommissioningSet(void *               aContext,
                                        otCoapHeader *       aHeader,
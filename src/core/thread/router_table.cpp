@@ -83,6 +83,12 @@ RouterTable::RouterTable(Instance &aInstance)
     , mRouterIdSequence(Random::GetUint8())
     , mActiveRouterCount(0)
 {
+    for (uint8_t i = 0; i <= Mle::kMaxRouterId; i++)
+    {
+        mNextHops[i]  = Mac::kShortAddrInvalid;
+        mPathCosts[i] = Mle::kMaxRouteCost;
+    }
+
     Clear();
 }
 
@@ -99,6 +105,8 @@ void RouterTable::ClearNeighbors(void)
     {
         mRouters[i].SetState(Neighbor::kStateInvalid);
     }
+
+    UpdateRoutes();
 }
 
 bool RouterTable::IsAllocated(uint8_t aRouterId) const
@@ -188,6 +196,8 @@ void RouterTable::UpdateAllocation(void)
         memset(&router, 0, sizeof(router));
         router.SetRloc16(0xffff);
     }
+
+    UpdateRoutes();
 }
 
 Router *RouterTable::Allocate(void)
@@ -285,6 +295,8 @@ otError RouterTable::Release(uint8_t aRouterId)
         }
     }
 
+    UpdateRoutes();
+
     mRouterIdSequence++;
     mRouterIdSequenceLastUpdated = TimerMilli::GetNow();
 
@@ -333,6 +345,8 @@ void RouterTable::RemoveNeighbor(Router &aRouter)
         // Clear all EID-to-RLOC entries assossiated with the router.
         netif.GetAddressResolver().Remove(aRouter.GetRouterId());
     }
+
+    UpdateRoutes();
 }
 
 Router *RouterTable::GetNeighbor(uint16_t aRloc16)
@@ -511,6 +525,119 @@ exit:
     return rval;
 }
 
+void RouterTable::UpdateRoutes(void)
+{
+    uint8_t indexMap[Mle::kMaxRouterId + 1];
+    uint8_t linkCosts[Mle::kMaxRouters];
+
+    memset(indexMap, Mle::kInvalidRouterId, sizeof(indexMap));
+
+    for (uint8_t i = 0; i < Mle::kMaxRouters; i++)
+    {
+        if (mRouters[i].GetRloc16() == 0xffff)
+        {
+            continue;
+        }
+
+        indexMap[mRouters[i].GetRouterId()] = i;
+        linkCosts[i]                        = GetLinkCost(mRouters[i]);
+    }
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        uint8_t index = indexMap[routerId];
+        uint8_t hopIndex;
+
+        if (index == Mle::kInvalidRouterId)
+        {
+            SetRoute(routerId, Mac::kShortAddrInvalid, Mle::kMaxRouteCost);
+            continue;
+        }
+
+        hopIndex = (mRouters[index].GetNextHop() <= Mle::kMaxRouterId) ? indexMap[mRouters[index].GetNextHop()]
+                                                                       : static_cast<uint8_t>(Mle::kInvalidRouterId);
+
+        if (hopIndex != Mle::kInvalidRouterId)
+        {
+            UpdateRoute(mRouters[index], linkCosts[index], &mRouters[hopIndex], linkCosts[hopIndex]);
+        }
+        else
+        {
+            UpdateRoute(mRouters[index], linkCosts[index], NULL, 0);
+        }
+    }
+}
+
+void RouterTable::UpdateRoutes(const Neighbor &aNeighbor)
+{
+    uint8_t neighborId = Mle::Mle::GetRouterId(aNeighbor.GetRloc16());
+    Router *neighbor   = GetRouter(neighborId);
+    uint8_t linkCost;
+
+    VerifyOrExit(neighbor != NULL && static_cast<const Neighbor *>(neighbor) == &aNeighbor);
+
+    linkCost = GetLinkCost(*neighbor);
+
+    for (uint8_t i = 0; i < Mle::kMaxRouters; i++)
+    {
+        Router &router = mRouters[i];
+
+        if (router.GetRloc16() == 0xffff)
+        {
+            continue;
+        }
+
+        if (&router == neighbor)
+        {
+            Router *hop = (router.GetNextHop() <= Mle::kMaxRouterId) ? GetRouter(router.GetNextHop()) : NULL;
+
+            UpdateRoute(router, linkCost, hop, (hop != NULL) ? GetLinkCost(*hop) : 0);
+        }
+        else if (router.GetNextHop() == neighborId)
+        {
+            UpdateRoute(router, GetLinkCost(router), neighbor, linkCost);
+        }
+    }
+
+exit:
+    return;
+}
+
+void RouterTable::UpdateRoute(const Router &aRouter, uint8_t aLinkCost, const Router *aHop, uint8_t aHopLinkCost)
+{
+    uint16_t nextHop = Mac::kShortAddrInvalid;
+    uint8_t  cost    = aLinkCost;
+
+    // Prefer the multi-hop route only if it is strictly cheaper than the direct link.
+    if (aHop != NULL && aRouter.GetCost() + aHopLinkCost < cost)
+    {
+        cost = aRouter.GetCost() + aHopLinkCost;
+
+        if (aHop->GetState() != Neighbor::kStateInvalid)
+        {
+            nextHop = aHop->GetRloc16();
+        }
+    }
+    else if (cost < Mle::kMaxRouteCost)
+    {
+        nextHop = aRouter.GetRloc16();
+    }
+
+    SetRoute(aRouter.GetRouterId(), nextHop, cost);
+}
+
+void RouterTable::SetRoute(uint8_t aRouterId, uint16_t aNextHop, uint8_t aCost)
+{
+    if (aNextHop == Mac::kShortAddrInvalid && mNextHops[aRouterId] != Mac::kShortAddrInvalid)
+    {
+        otLogInfoMle(GetInstance(), "Route to router id %d lost", aRouterId);
+        GetNetif().GetAddressResolver().Remove(aRouterId);
+    }
+
+    mNextHops[aRouterId]  = aNextHop;
+    mPathCosts[aRouterId] = aCost;
+}
+
 void RouterTable::ProcessTlv(const Mle::RouteTlv &aTlv)
 {
     bool allocationChanged = false;
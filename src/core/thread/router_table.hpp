@@ -184,6 +184,57 @@ public:
      */
     uint8_t GetLinkCost(Router &aRouter);
 
+    /**
+     * This method returns the next hop towards a given router.
+     *
+     * The value is taken from the precomputed routing table (see `UpdateRoutes()`).
+     *
+     * @param[in]  aRouterId  The router id of the destination.
+     *
+     * @returns The RLOC16 of the next hop, or `Mac::kShortAddrInvalid` if there is no route to @p aRouterId.
+     *
+     */
+    uint16_t GetNextHop(uint8_t aRouterId) const
+    {
+        return (aRouterId <= Mle::kMaxRouterId) ? mNextHops[aRouterId] : static_cast<uint16_t>(Mac::kShortAddrInvalid);
+    }
+
+    /**
+     * This method returns the cost of the best path (direct link or multi-hop route) to a given router.
+     *
+     * The value is taken from the precomputed routing table (see `UpdateRoutes()`).
+     *
+     * @param[in]  aRouterId  The router id of the destination.
+     *
+     * @returns The path cost, or `Mle::kMaxRouteCost` if there is no path to @p aRouterId.
+     *
+     */
+    uint8_t GetPathCost(uint8_t aRouterId) const
+    {
+        return (aRouterId <= Mle::kMaxRouterId) ? mPathCosts[aRouterId] : static_cast<uint8_t>(Mle::kMaxRouteCost);
+    }
+
+    /**
+     * This method recomputes the next hop and path cost towards every router id.
+     *
+     * This method must be called whenever the next hop, route cost, link state or link quality of a router entry
+     * changes.  If the route to a router is lost, the EID-to-RLOC cache entries associated with it are removed.
+     *
+     */
+    void UpdateRoutes(void);
+
+    /**
+     * This method recomputes the routes that depend on the link cost of a given neighbor.
+     *
+     * This method must be called when only the link quality of @p aNeighbor changed.  It updates the route to the
+     * neighbor itself and every route whose next hop is the neighbor, and leaves all other routes untouched.  Nothing
+     * is done if @p aNeighbor is not a router entry (e.g. a child).
+     *
+     * @param[in]  aNeighbor  A reference to the neighbor whose link quality changed.
+     *
+     */
+    void UpdateRoutes(const Neighbor &aNeighbor);
+
     /**
      * This method returns the neighbor for a given RLOC16.
      *
@@ -304,8 +355,12 @@ public:
 
 private:
     void UpdateAllocation(void);
+    void UpdateRoute(const Router &aRouter, uint8_t aLinkCost, const Router *aHop, uint8_t aHopLinkCost);
+    void SetRoute(uint8_t aRouterId, uint16_t aNextHop, uint8_t aCost);
 
     Router   mRouters[Mle::kMaxRouters];
+    uint16_t mNextHops[Mle::kMaxRouterId + 1];
+    uint8_t  mPathCosts[Mle::kMaxRouterId + 1];
     uint8_t  mAllocatedRouterIds[BitVectorBytes(Mle::kMaxRouterId)];
     uint8_t  mRouterIdReuseDelay[Mle::kMaxRouterId + 1];
     uint32_t mRouterIdSequenceLastUpdated;
@@ -333,6 +388,8 @@ public:
     explicit RouterTable(Instance &) {}
 
     uint8_t GetNeighborCount(void) const { return 0; }
+    void    UpdateRoutes(void) {}
+    void    UpdateRoutes(const Neighbor &) {}
 };
 
 #endif // OPENTHREAD_MTD
@@ -52,7 +52,7 @@ ChannelManager::ChannelManager(Instance &aInstance)
     , mSupportedChannelMask(0)
     , mFavoredChannelMask(0)
     , mActiveTimestamp(0)
-    , mNotifierCallback(&ChannelManager::HandleStateChanged, this)
+    , mNotifierCallback(&ChannelManager::HandleStateChanged, this, OT_CHANGED_THREAD_CHANNEL)
     , mDelay(kMinimumDelay)
     , mChannel(0)
     , mState(kStateIdle)
@@ -53,7 +53,9 @@ ChildSupervisor::ChildSupervisor(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mSupervisionInterval(kDefaultSupervisionInterval)
     , mTimer(aInstance, &ChildSupervisor::HandleTimer, this)
-    , mNotifierCallback(&ChildSupervisor::HandleStateChanged, this)
+    , mNotifierCallback(&ChildSupervisor::HandleStateChanged,
+                        this,
+                        OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED)
 {
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 }
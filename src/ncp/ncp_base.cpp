@@ -580,6 +580,9 @@ NcpBase::NcpBase(Instance *aInstance):
 #endif
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     mCurTransmitTID(0),
+    mRawTransmitInProgress(false),
+    mRawTxQueueHead(0),
+    mRawTxQueueLength(0),
     mCurScanChannel(kInvalidScanChannel),
     mSrcMatchEnabled(false),
 #endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
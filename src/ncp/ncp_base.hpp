@@ -56,6 +56,10 @@
 
 #include "spinel.h"
 
+#if OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE < 1
+#error OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE should be at least set to 1.
+#endif
+
 namespace ot {
 namespace Ncp {
 
@@ -203,6 +207,20 @@ protected:
         uint32_t mPropKeyOrStatus  : 24; ///< 3 bytes for either property key or spinel status.
     };
 
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    /**
+     * This struct represents a raw frame waiting for the radio transmit buffer.
+     *
+     */
+    struct RawTxEntry
+    {
+        uint8_t mTid;                             ///< Spinel transaction id of the `PROP_STREAM_RAW` set.
+        uint8_t mChannel;                         ///< Channel to transmit on.
+        uint8_t mLength;                          ///< Length of the PSDU.
+        uint8_t mPsdu[OT_RADIO_FRAME_MAX_SIZE];   ///< The PSDU.
+    };
+#endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+
     NcpFrameBuffer::FrameTag GetLastOutboundFrameTag(void);
 
     otError HandleCommand(uint8_t aHeader);
@@ -255,6 +273,10 @@ protected:
     static void LinkRawTransmitDone(otInstance *aInstance, otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
     void LinkRawTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
 
+    otError StartRawTransmit(uint8_t aTid);
+    void TransmitQueuedRawFrames(void);
+    void AbortQueuedRawFrames(void);
+
     static void LinkRawEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
     void LinkRawEnergyScanDone(int8_t aEnergyScanMaxRssi);
 
@@ -798,6 +820,7 @@ protected:
     {
         kTxBufferSize = OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE,  // Tx Buffer size (used by mTxFrameBuffer).
         kResponseQueueSize = OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE,
+        kRawTxQueueSize = OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE,
         kInvalidScanChannel = -1,                              // Invalid scan channel.
     };
 
@@ -851,6 +874,10 @@ protected:
 
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     uint8_t mCurTransmitTID;
+    bool    mRawTransmitInProgress;
+    uint8_t mRawTxQueueHead;
+    uint8_t mRawTxQueueLength;
+    RawTxEntry mRawTxQueue[kRawTxQueueSize];
     int8_t  mCurScanChannel;
     bool    mSrcMatchEnabled;
 #endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
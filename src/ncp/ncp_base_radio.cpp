@@ -59,6 +59,15 @@ void NcpBase::LinkRawReceiveDone(otInstance *, otRadioFrame *aFrame, otError aEr
 
 void NcpBase::LinkRawReceiveDone(otRadioFrame *aFrame, otError aError)
 {
+    enum
+    {
+        kMetadataSize = SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kUint16Size +
+                        SpinelFieldsBase::kStructHeaderSize + SpinelFieldsBase::kUint8Size +
+                        SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kUint32Size + SpinelFieldsBase::kUint16Size +
+                        SpinelFieldsBase::kStructHeaderSize + SpinelFieldsBase::kMaxUintPackedSize,
+    };
+
+    SpinelFields<kMetadataSize> metadata;
     uint16_t flags = 0;
     uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
 
@@ -78,21 +87,22 @@ void NcpBase::LinkRawReceiveDone(otRadioFrame *aFrame, otError aError)
     }
 
     // Append metadata (rssi, etc)
-    SuccessOrExit(mEncoder.WriteInt8(aFrame->mRssi));       // RSSI
-    SuccessOrExit(mEncoder.WriteInt8(-128));                // Noise Floor (Currently unused)
-    SuccessOrExit(mEncoder.WriteUint16(flags));             // Flags
-
-    SuccessOrExit(mEncoder.OpenStruct());                   // PHY-data
-    SuccessOrExit(mEncoder.WriteUint8(aFrame->mChannel));   // 802.15.4 channel (Receive channel)
-    SuccessOrExit(mEncoder.WriteUint8(aFrame->mLqi));       // 802.15.4 LQI
-    SuccessOrExit(mEncoder.WriteUint32(aFrame->mMsec));     // The timestamp milliseconds
-    SuccessOrExit(mEncoder.WriteUint16(aFrame->mUsec));     // The timestamp microseconds, offset to mMsec
-    SuccessOrExit(mEncoder.CloseStruct());
-
-    SuccessOrExit(mEncoder.OpenStruct());                   // Vendor-data
-    SuccessOrExit(mEncoder.WriteUintPacked(aError));        // Receive error
-    SuccessOrExit(mEncoder.CloseStruct());
-
+    metadata.WriteInt8(aFrame->mRssi);                      // RSSI
+    metadata.WriteInt8(-128);                               // Noise Floor (Currently unused)
+    metadata.WriteUint16(flags);                            // Flags
+
+    metadata.OpenStruct();                                  // PHY-data
+    metadata.WriteUint8(aFrame->mChannel);                  // 802.15.4 channel (Receive channel)
+    metadata.WriteUint8(aFrame->mLqi);                      // 802.15.4 LQI
+    metadata.WriteUint32(aFrame->mMsec);                    // The timestamp milliseconds
+    metadata.WriteUint16(aFrame->mUsec);                    // The timestamp microseconds, offset to mMsec
+    metadata.CloseStruct();
+
+    metadata.OpenStruct();                                  // Vendor-data
+    metadata.WriteUintPacked(aError);                       // Receive error
+    metadata.CloseStruct();
+
+    SuccessOrExit(mEncoder.WriteFields(metadata));
     SuccessOrExit(mEncoder.EndFrame());
 
 exit:
@@ -107,6 +117,8 @@ void NcpBase::LinkRawTransmitDone(otInstance *, otRadioFrame *aFrame,
 
 void NcpBase::LinkRawTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError)
 {
+    mRawTransmitInProgress = false;
+
     if (mCurTransmitTID)
     {
         uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | mCurTransmitTID;
@@ -141,7 +153,82 @@ void NcpBase::LinkRawTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame,
 
 exit:
     OT_UNUSED_VARIABLE(aFrame);
-    return;
+
+    // The transmit buffer is free again, pass the next queued frame to the radio.
+    TransmitQueuedRawFrames();
+}
+
+otError NcpBase::StartRawTransmit(uint8_t aTid)
+{
+    otRadioFrame *frame = otLinkRawGetTransmitBuffer(mInstance);
+    otError error;
+
+    // TODO: This should be later added in the STREAM_RAW argument to allow user to directly specify it.
+    frame->mMaxTxAttempts = OPENTHREAD_CONFIG_MAX_TX_ATTEMPTS_DIRECT;
+
+    // Cache the transaction ID for async response
+    mCurTransmitTID = aTid;
+
+    error = otLinkRawTransmit(mInstance, frame, &NcpBase::LinkRawTransmitDone);
+
+    if (error == OT_ERROR_NONE)
+    {
+        mRawTransmitInProgress = true;
+    }
+    else
+    {
+        mCurTransmitTID = 0;
+    }
+
+    return error;
+}
+
+void NcpBase::TransmitQueuedRawFrames(void)
+{
+    while (!mRawTransmitInProgress && mRawTxQueueLength > 0)
+    {
+        RawTxEntry &entry = mRawTxQueue[mRawTxQueueHead];
+        otRadioFrame *frame = otLinkRawGetTransmitBuffer(mInstance);
+        uint8_t tid = entry.mTid;
+        otError error = OT_ERROR_INVALID_STATE;
+
+        if (frame != NULL)
+        {
+            frame->mChannel = entry.mChannel;
+            frame->mLength = entry.mLength;
+            memcpy(frame->mPsdu, entry.mPsdu, entry.mLength);
+        }
+
+        mRawTxQueueHead = (mRawTxQueueHead + 1) % kRawTxQueueSize;
+        mRawTxQueueLength--;
+
+        if (frame != NULL)
+        {
+            error = StartRawTransmit(tid);
+        }
+
+        if (error != OT_ERROR_NONE && tid != 0)
+        {
+            WriteLastStatusFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid, ThreadErrorToSpinelStatus(error));
+        }
+    }
+}
+
+void NcpBase::AbortQueuedRawFrames(void)
+{
+    while (mRawTxQueueLength > 0)
+    {
+        uint8_t tid = mRawTxQueue[mRawTxQueueHead].mTid;
+
+        mRawTxQueueHead = (mRawTxQueueHead + 1) % kRawTxQueueSize;
+        mRawTxQueueLength--;
+
+        if (tid != 0)
+        {
+            WriteLastStatusFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid,
+                                 ThreadErrorToSpinelStatus(OT_ERROR_INVALID_STATE));
+        }
+    }
 }
 
 void NcpBase::LinkRawEnergyScanDone(otInstance *, int8_t aEnergyScanMaxRssi)
@@ -315,6 +402,10 @@ otError NcpBase::SetPropertyHandler_PHY_ENABLED(void)
         }
 
         error = otLinkRawSetEnable(mInstance, false);
+
+        // Frames still waiting for the radio will not be sent
+        mRawTransmitInProgress = false;
+        AbortQueuedRawFrames();
     }
     else
     {
@@ -347,32 +438,46 @@ exit:
 otError NcpBase::SetPropertyHandler_STREAM_RAW(uint8_t aHeader)
 {
     const uint8_t *frameBuffer = NULL;
-    otRadioFrame *frame;
     uint16_t frameLen = 0;
+    uint8_t channel = 0;
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(otLinkRawIsEnabled(mInstance), error = OT_ERROR_INVALID_STATE);
 
-    frame = otLinkRawGetTransmitBuffer(mInstance);
-
     SuccessOrExit(error = mDecoder.ReadDataWithLen(frameBuffer, frameLen));
-    SuccessOrExit(error = mDecoder.ReadUint8(frame->mChannel));
+    SuccessOrExit(error = mDecoder.ReadUint8(channel));
 
     VerifyOrExit(frameLen <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
 
-    // Cache the transaction ID for async response
-    mCurTransmitTID = SPINEL_HEADER_GET_TID(aHeader);
+    if (mRawTransmitInProgress || mRawTxQueueLength > 0)
+    {
+        // The radio is busy with an earlier frame, queue this one. It is
+        // reported with its own TID once it has been transmitted.
+        RawTxEntry *entry;
 
-    // Update frame buffer and length
-    frame->mLength = static_cast<uint8_t>(frameLen);
-    memcpy(frame->mPsdu, frameBuffer, frame->mLength);
+        VerifyOrExit(mRawTxQueueLength < kRawTxQueueSize, error = OT_ERROR_BUSY);
 
-    // TODO: This should be later added in the STREAM_RAW argument to allow user to directly specify it.
-    frame->mMaxTxAttempts = OPENTHREAD_CONFIG_MAX_TX_ATTEMPTS_DIRECT;
+        entry = &mRawTxQueue[(mRawTxQueueHead + mRawTxQueueLength) % kRawTxQueueSize];
+        entry->mTid = SPINEL_HEADER_GET_TID(aHeader);
+        entry->mChannel = channel;
+        entry->mLength = static_cast<uint8_t>(frameLen);
+        memcpy(entry->mPsdu, frameBuffer, frameLen);
 
-    // Pass frame to the radio layer. Note, this fails if we
-    // haven't enabled raw stream or are already transmitting.
-    error = otLinkRawTransmit(mInstance, frame, &NcpBase::LinkRawTransmitDone);
+        mRawTxQueueLength++;
+    }
+    else
+    {
+        otRadioFrame *frame = otLinkRawGetTransmitBuffer(mInstance);
+
+        // Update frame buffer and length
+        frame->mChannel = channel;
+        frame->mLength = static_cast<uint8_t>(frameLen);
+        memcpy(frame->mPsdu, frameBuffer, frame->mLength);
+
+        // Pass frame to the radio layer. Note, this fails if we
+        // haven't enabled raw stream.
+        error = StartRawTransmit(SPINEL_HEADER_GET_TID(aHeader));
+    }
 
 exit:
 
@@ -367,16 +367,46 @@ exit:
 otError NcpFrameBuffer::InFrameFeedData(const uint8_t *aDataBuffer, uint16_t aDataBufferLength)
 {
     otError error = OT_ERROR_NONE;
+    uint8_t *otherFrameStart;
+    uint16_t length;
 
     VerifyOrExit(mWriteDirection != kUnknown, error = OT_ERROR_INVALID_STATE);
 
     // Begin a new segment (if we are not in middle of segment already).
     SuccessOrExit(error = InFrameBeginSegment());
 
+    // Ensure the data leaves the `mWriteFrameStart` for other direction (other priority level) unreached, as
+    // `InFrameAppend()` does for each byte. The free space is checked once for the whole data buffer.
+    otherFrameStart = mWriteFrameStart[(mWriteDirection == kForward) ? kBackward : kForward];
+
+    if (GetDistance(mWriteSegmentTail, otherFrameStart, mWriteDirection) <= aDataBufferLength)
+    {
+        InFrameDiscard();
+        ExitNow(error = OT_ERROR_NO_BUFS);
+    }
+
     // Write the data buffer
-    while (aDataBufferLength--)
+    if (mWriteDirection == kForward)
+    {
+        // Copy up to the end of the buffer, and the rest (if any) from the start of the buffer.
+        length = static_cast<uint16_t>(mBufferEnd - mWriteSegmentTail);
+
+        if (length > aDataBufferLength)
+        {
+            length = aDataBufferLength;
+        }
+
+        memcpy(mWriteSegmentTail, aDataBuffer, length);
+        memcpy(mBuffer, aDataBuffer + length, aDataBufferLength - length);
+        mWriteSegmentTail = GetUpdatedBufPtr(mWriteSegmentTail, aDataBufferLength, kForward);
+    }
+    else
     {
-        SuccessOrExit(error = InFrameAppend(*aDataBuffer++));
+        while (aDataBufferLength--)
+        {
+            *mWriteSegmentTail = *aDataBuffer++;
+            mWriteSegmentTail = GetUpdatedBufPtr(mWriteSegmentTail, 1, kBackward);
+        }
     }
 
 exit:
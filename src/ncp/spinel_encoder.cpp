@@ -58,8 +58,13 @@ otError SpinelEncoder::BeginFrame(uint8_t aHeader, unsigned int aCommand)
         SuccessOrExit(error = BeginFrame(NcpFrameBuffer::kPriorityLow));
     }
 
-    SuccessOrExit(error = WriteUint8(aHeader));
-    SuccessOrExit(error = WriteUintPacked(aCommand));
+    {
+        SpinelFields<SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kMaxUintPackedSize> fields;
+
+        fields.WriteUint8(aHeader);
+        fields.WriteUintPacked(aCommand);
+        SuccessOrExit(error = WriteFields(fields));
+    }
 
 exit:
     return error;
@@ -113,43 +118,30 @@ exit:
 
 otError SpinelEncoder::WriteUint16(uint16_t aUint16)
 {
-    otError error = OT_ERROR_NONE;
+    SpinelFields<SpinelFieldsBase::kUint16Size> fields;
 
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint16 >> 0) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint16 >> 8) & 0xff));
+    fields.WriteUint16(aUint16);
 
-exit:
-    return error;
+    return WriteFields(fields);
 }
 
 otError SpinelEncoder::WriteUint32(uint32_t aUint32)
 {
-    otError error = OT_ERROR_NONE;
+    SpinelFields<SpinelFieldsBase::kUint32Size> fields;
 
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint32 >>  0) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint32 >>  8) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint32 >> 16) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint32 >> 24) & 0xff));
+    fields.WriteUint32(aUint32);
 
-exit:
-    return error;
+    return WriteFields(fields);
 }
 
 otError SpinelEncoder::WriteUint64(uint64_t aUint64)
 {
-    otError error = OT_ERROR_NONE;
+    SpinelFields<2 * SpinelFieldsBase::kUint32Size> fields;
 
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >>  0) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >>  8) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >> 16) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >> 24) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >> 32) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >> 40) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >> 48) & 0xff));
-    SuccessOrExit(error = mNcpBuffer.InFrameFeedByte((aUint64 >> 56) & 0xff));
+    fields.WriteUint32(static_cast<uint32_t>(aUint64 >>  0));
+    fields.WriteUint32(static_cast<uint32_t>(aUint64 >> 32));
 
-exit:
-    return error;
+    return WriteFields(fields);
 }
 
 otError SpinelEncoder::WriteUintPacked(unsigned int aUint)
@@ -40,12 +40,190 @@
 #include <openthread/types.h>
 
 #include "openthread-core-config.h"
+#include "common/debug.hpp"
 #include "ncp/spinel.h"
 #include "ncp/ncp_buffer.hpp"
 
 namespace ot {
 namespace Ncp {
 
+/**
+ * This class defines the encoded size of the field types of a `SpinelFields` group.
+ *
+ */
+class SpinelFieldsBase
+{
+public:
+    enum
+    {
+        kBoolSize           = 1,                    ///< Encoded size of a bool.
+        kUint8Size          = 1,                    ///< Encoded size of a `uint8_t` or `int8_t`.
+        kUint16Size         = 2,                    ///< Encoded size of a `uint16_t` or `int16_t`.
+        kUint32Size         = 4,                    ///< Encoded size of a `uint32_t` or `int32_t`.
+        kMaxUintPackedSize  = 5,                    ///< Encoded size of a packed `uint32_t` (at most).
+        kStructHeaderSize   = 2,                    ///< Encoded size of the length of a struct.
+    };
+};
+
+/**
+ * This class template encodes a group of spinel fields with a bounded encoded size in a local buffer.
+ *
+ * The fields are encoded by inline code with no format string and no per-field buffer state check, and the group is
+ * then added to a frame by a single `SpinelEncoder::WriteFields()` call. It is meant for the fixed layout parts of the
+ * frequent frames, e.g., the metadata following a `STREAM_RAW` frame.
+ *
+ * The bound of a group is given as the sum of the encoded sizes of its fields (see `SpinelFieldsBase`). Writing past
+ * the bound is a programming error.
+ *
+ * @tparam kMaxSize   The maximum encoded size of the group (in bytes).
+ *
+ */
+template <uint16_t kMaxSize> class SpinelFields : public SpinelFieldsBase
+{
+public:
+    /**
+     * This constructor initializes an empty `SpinelFields` object.
+     *
+     */
+    SpinelFields(void) :
+        mLength(0),
+        mStructOffset(0),
+        mIsStructOpen(false)
+    {
+    }
+
+    /**
+     * This method encodes a boolean value.
+     *
+     * @param[in]  aBool  The boolean value.
+     *
+     */
+    void WriteBool(bool aBool) { WriteUint8(aBool ? 0x01 : 0x00); }
+
+    /**
+     * This method encodes a `uint8_t` value.
+     *
+     * @param[in]  aUint8  The value.
+     *
+     */
+    void WriteUint8(uint8_t aUint8) { *Reserve(kUint8Size) = aUint8; }
+
+    /**
+     * This method encodes an `int8_t` value.
+     *
+     * @param[in]  aInt8  The value.
+     *
+     */
+    void WriteInt8(int8_t aInt8) { WriteUint8(static_cast<uint8_t>(aInt8)); }
+
+    /**
+     * This method encodes a `uint16_t` value (little-endian).
+     *
+     * @param[in]  aUint16  The value.
+     *
+     */
+    void WriteUint16(uint16_t aUint16)
+    {
+        uint8_t *bytes = Reserve(kUint16Size);
+
+        bytes[0] = (aUint16 >> 0) & 0xff;
+        bytes[1] = (aUint16 >> 8) & 0xff;
+    }
+
+    /**
+     * This method encodes a `uint32_t` value (little-endian).
+     *
+     * @param[in]  aUint32  The value.
+     *
+     */
+    void WriteUint32(uint32_t aUint32)
+    {
+        uint8_t *bytes = Reserve(kUint32Size);
+
+        bytes[0] = (aUint32 >>  0) & 0xff;
+        bytes[1] = (aUint32 >>  8) & 0xff;
+        bytes[2] = (aUint32 >> 16) & 0xff;
+        bytes[3] = (aUint32 >> 24) & 0xff;
+    }
+
+    /**
+     * This method encodes an unsigned integer in the spinel packed format.
+     *
+     * Any `uint32_t` value fits in the `kMaxUintPackedSize` bytes accounted for the field.
+     *
+     * @param[in]  aUint  The value.
+     *
+     */
+    void WriteUintPacked(uint32_t aUint)
+    {
+        do
+        {
+            uint8_t byte = aUint & 0x7f;
+
+            aUint >>= 7;
+            WriteUint8((aUint != 0) ? (byte | 0x80) : byte);
+        } while (aUint != 0);
+    }
+
+    /**
+     * This method opens a struct, the fields written until `CloseStruct()` form the struct. Structs do not nest.
+     *
+     */
+    void OpenStruct(void)
+    {
+        assert(!mIsStructOpen);
+        mStructOffset = mLength;
+        mIsStructOpen = true;
+        Reserve(kStructHeaderSize);
+    }
+
+    /**
+     * This method closes the struct opened with `OpenStruct()`.
+     *
+     */
+    void CloseStruct(void)
+    {
+        uint16_t length = mLength - mStructOffset - kStructHeaderSize;
+
+        assert(mIsStructOpen);
+        mIsStructOpen = false;
+        mBuffer[mStructOffset + 0] = (length >> 0) & 0xff;
+        mBuffer[mStructOffset + 1] = (length >> 8) & 0xff;
+    }
+
+    /**
+     * This method returns a pointer to the encoded fields.
+     *
+     * @returns A pointer to the encoded fields.
+     *
+     */
+    const uint8_t *GetBytes(void) const { return mBuffer; }
+
+    /**
+     * This method returns the length of the encoded fields.
+     *
+     * @returns The length of the encoded fields (in bytes).
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+private:
+    uint8_t *Reserve(uint16_t aLength)
+    {
+        uint8_t *bytes = &mBuffer[mLength];
+
+        assert(mLength + aLength <= kMaxSize);
+        mLength += aLength;
+
+        return bytes;
+    }
+
+    uint8_t mBuffer[kMaxSize];
+    uint16_t mLength;
+    uint16_t mStructOffset;
+    bool mIsStructOpen;
+};
+
 /**
  * This class defines a spinel encoder.
  *
@@ -561,6 +739,27 @@ public:
      */
     otError WriteMessage(otMessage *aMessage) { return mNcpBuffer.InFrameFeedMessage(aMessage); }
 
+    /**
+     * This method writes a group of fields encoded with a `SpinelFields` object to the current input frame.
+     *
+     * Before using this method `BeginFrame()` must be called to start and prepare a new input frame. Otherwise, this
+     * method does nothing and returns error status `OT_ERROR_INVALID_STATE`.
+     *
+     * If no buffer space is available, this method will discard and clear the current input frame and return the
+     * error status `OT_ERROR_NO_BUFS`.
+     *
+     * @param[in]  aFields              A reference to the encoded fields.
+     *
+     * @retval OT_ERROR_NONE            Successfully added the fields to the frame.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to add the fields.
+     * @retval OT_ERROR_INVALID_STATE   `BeginFrame()` has not been called earlier to start the frame.
+     *
+     */
+    template <uint16_t kMaxSize> otError WriteFields(const SpinelFields<kMaxSize> &aFields)
+    {
+        return WriteData(aFields.GetBytes(), aFields.GetLength());
+    }
+
     /**
      * This method encodes and writes a set of variables to the current input frame using a given spinel packing format
      * string.
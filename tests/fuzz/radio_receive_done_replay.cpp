@@ -0,0 +1,216 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a replay benchmark for the radio receive path.
+ *
+ *   It drives the same single-instance setup as the `radio-receive-done` fuzz target, replays a set of frames through
+ *   `otPlatRadioReceiveDone()` and reports the average time spent per received frame.
+ *
+ *   Usage: radio-receive-done-replay [iterations] [frame-file ...]
+ *
+ *   Without frame files, a built-in LOWPAN_IPHC frame and a FRAG1/FRAGN pair carrying UDP datagrams are replayed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/types.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+
+extern "C" void FuzzerPlatformInit(void);
+
+enum
+{
+    kDefaultIterations = 100000,
+    kMaxFrames         = 16,
+};
+
+struct ReplayFrame
+{
+    uint8_t mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t mLength;
+};
+
+// Data frame, no security, PAN ID compression, dst 0xffff on PAN 0xdead, extended src address.
+#define REPLAY_MAC_HEADER 0x41, 0xc8, 0x00, 0xad, 0xde, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+
+// LOWPAN_IPHC: TF elided, NH compressed, HLIM 255, SAM from MAC, DAM ff02::1, then UDP 19788 -> 19788.
+#define REPLAY_IPHC_UDP_HEADER 0x7f, 0x3b, 0x01, 0xf0, 0x4d, 0x4c, 0x4d, 0x4c, 0x00, 0x00
+
+static const uint8_t sIphcFrame[] = {
+    REPLAY_MAC_HEADER, REPLAY_IPHC_UDP_HEADER,
+    // UDP payload (32 bytes)
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    // FCS
+    0x00, 0x00};
+
+// FRAG1 of a 120-byte datagram: 48 bytes of headers and the first 32 bytes of UDP payload.
+static const uint8_t sFrag1Frame[] = {
+    REPLAY_MAC_HEADER, 0xc0, 0x78, 0x12, 0x34, REPLAY_IPHC_UDP_HEADER,
+    // UDP payload (32 bytes)
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    // FCS
+    0x00, 0x00};
+
+// FRAGN at offset 80 carrying the remaining 40 bytes of the datagram.
+static const uint8_t sFragNFrame[] = {
+    REPLAY_MAC_HEADER, 0xe0, 0x78, 0x12, 0x34, 0x0a,
+    // UDP payload (40 bytes)
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0x47,
+    // FCS
+    0x00, 0x00};
+
+static ReplayFrame sFrames[kMaxFrames];
+static uint8_t     sNumFrames = 0;
+
+static void AddFrame(const uint8_t *aPsdu, size_t aLength)
+{
+    VerifyOrExit(sNumFrames < kMaxFrames && aLength <= OT_RADIO_FRAME_MAX_SIZE);
+
+    memcpy(sFrames[sNumFrames].mPsdu, aPsdu, aLength);
+    sFrames[sNumFrames].mLength = static_cast<uint8_t>(aLength);
+    sNumFrames++;
+
+exit:
+    return;
+}
+
+static void AddFrameFile(const char *aPath)
+{
+    uint8_t buf[OT_RADIO_FRAME_MAX_SIZE + 1];
+    size_t  length;
+    FILE *  file = fopen(aPath, "rb");
+
+    VerifyOrExit(file != NULL, fprintf(stderr, "cannot open %s\n", aPath));
+
+    length = fread(buf, 1, sizeof(buf), file);
+    VerifyOrExit(length <= OT_RADIO_FRAME_MAX_SIZE, fprintf(stderr, "%s is not a radio frame\n", aPath));
+
+    AddFrame(buf, length);
+
+exit:
+
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+}
+
+static uint64_t GetNowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+int main(int argc, char *argv[])
+{
+    const otPanId panId = 0xdead;
+
+    otInstance *  instance   = NULL;
+    unsigned long iterations = kDefaultIterations;
+    otRadioFrame  frame;
+    uint8_t       psdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint64_t      start;
+    uint64_t      elapsed;
+    unsigned long numFrames;
+
+    if (argc > 1)
+    {
+        iterations = strtoul(argv[1], NULL, 0);
+    }
+
+    for (int i = 2; i < argc; i++)
+    {
+        AddFrameFile(argv[i]);
+    }
+
+    if (sNumFrames == 0)
+    {
+        AddFrame(sIphcFrame, sizeof(sIphcFrame));
+        AddFrame(sFrag1Frame, sizeof(sFrag1Frame));
+        AddFrame(sFragNFrame, sizeof(sFragNFrame));
+    }
+
+    FuzzerPlatformInit();
+
+    instance = otInstanceInitSingle();
+    otLinkSetPanId(instance, panId);
+    otIp6SetEnabled(instance, true);
+    otThreadSetEnabled(instance, true);
+    otThreadBecomeLeader(instance);
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu    = psdu;
+    frame.mChannel = 11;
+
+    start = GetNowNs();
+
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        for (uint8_t j = 0; j < sNumFrames; j++)
+        {
+            // The receive path may modify the PSDU in place, so every frame is replayed from a pristine copy.
+            memcpy(psdu, sFrames[j].mPsdu, sFrames[j].mLength);
+            frame.mLength = sFrames[j].mLength;
+
+            otPlatRadioReceiveDone(instance, &frame, OT_ERROR_NONE);
+        }
+
+        otTaskletsProcess(instance);
+    }
+
+    elapsed   = GetNowNs() - start;
+    numFrames = iterations * sNumFrames;
+
+    printf("frames: %lu\n", numFrames);
+    printf("ip6 rx: %lu\n", static_cast<unsigned long>(otThreadGetIp6Counters(instance)->mRxSuccess));
+    printf("ns/frame: %.1f\n", numFrames ? static_cast<double>(elapsed) / numFrames : 0.0);
+
+    otInstanceFinalize(instance);
+
+    return 0;
+}
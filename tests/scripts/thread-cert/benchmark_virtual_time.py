@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2018, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+""" Compare the simulated seconds per wall second of the Python and native virtual time coordinators.
+
+Usage: benchmark_virtual_time.py [<num-nodes> [<duration>]]
+
+Forms a network of <num-nodes> routers (32 by default) that all hear each other, then runs it for <duration>
+simulated seconds (60 by default) with each coordinator.
+"""
+
+import gc
+import os
+import sys
+import time
+
+import config
+import node
+import simulator
+
+LEADER = 1
+
+
+def run(simulator_, num_nodes, duration):
+    nodes = {}
+
+    for i in range(1, num_nodes + 1):
+        nodes[i] = node.Node(i, simulator=simulator_)
+        nodes[i].set_panid(config.PANID)
+        nodes[i].set_mode('rsdn')
+        nodes[i].set_router_selection_jitter(1)
+
+    nodes[LEADER].start()
+    simulator_.go(5)
+
+    for i in range(2, num_nodes + 1):
+        nodes[i].start()
+
+    start_time = simulator_.current_time
+    start_events = simulator_.event_count
+    wall_time = time.time()
+
+    simulator_.go(duration)
+
+    wall_time = time.time() - wall_time
+    simulated = (simulator_.current_time - start_time) / 1000000.0
+    events = simulator_.event_count - start_events
+    routers = len([i for i in nodes if nodes[i].get_state() in ('leader', 'router')])
+
+    for i in nodes:
+        nodes[i].stop()
+
+    return simulated, wall_time, events, routers
+
+
+def main():
+    num_nodes = int(sys.argv[1]) if len(sys.argv) > 1 else 32
+    duration = int(sys.argv[2]) if len(sys.argv) > 2 else 60
+    results = []
+
+    if not os.path.exists(config.VIRTUAL_TIME_COORDINATOR):
+        print('%s not found, build it or set VIRTUAL_TIME_COORDINATOR' % config.VIRTUAL_TIME_COORDINATOR)
+        return 1
+
+    for name in ('python', 'native'):
+        if name == 'python':
+            simulator_ = simulator.VirtualTime()
+        else:
+            simulator_ = simulator.NativeVirtualTime(config.VIRTUAL_TIME_COORDINATOR)
+
+        simulated, wall_time, events, routers = run(simulator_, num_nodes, duration)
+        results.append((name, simulated, wall_time, events, routers))
+
+        # Release the coordinator port before starting the next one.
+        del simulator_
+        gc.collect()
+
+    for name, simulated, wall_time, events, routers in results:
+        print('%-6s: %u nodes (%u routers), %.1f s simulated in %.2f s wall time, %.1f simulated s/s, %u events'
+              % (name, num_nodes, routers, simulated, wall_time, simulated / wall_time, events))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
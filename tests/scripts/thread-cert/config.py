@@ -73,6 +73,13 @@ ADDRESS_QUERY_INITIAL_RETRY_DELAY = 15
 
 VIRTUAL_TIME = bool(os.getenv('VIRTUAL_TIME', False))
 
+if 'top_builddir' in os.environ.keys():
+    VIRTUAL_TIME_COORDINATOR = '%s/tools/virtual-time/ot-virtual-time' % os.environ['top_builddir']
+else:
+    VIRTUAL_TIME_COORDINATOR = './ot-virtual-time'
+
+VIRTUAL_TIME_COORDINATOR = os.getenv('VIRTUAL_TIME_COORDINATOR', VIRTUAL_TIME_COORDINATOR)
+
 def create_default_network_data_prefix_sub_tlvs_factories():
     return {
         network_data.TlvType.HAS_ROUTE: network_data.HasRouteFactory(
@@ -341,5 +348,7 @@ def create_default_thread_sniffer(nodeid=SNIFFER_ID):
 
 def create_default_simulator():
     if VIRTUAL_TIME:
+        if VIRTUAL_TIME_COORDINATOR != 'python' and os.path.exists(VIRTUAL_TIME_COORDINATOR):
+            return simulator.NativeVirtualTime(VIRTUAL_TIME_COORDINATOR)
         return simulator.VirtualTime()
     return simulator.RealTime()
@@ -32,6 +32,7 @@ import cmd
 import os
 import socket
 import struct
+import subprocess
 import time
 import sys
 
@@ -81,17 +82,26 @@ class VirtualTime:
     def _add_message(self, nodeid, message):
         addr = ('127.0.0.1', self.port + nodeid)
 
-        # Ignore any exceptions
-        try:
-            msg = self._message_factory.create(io.BytesIO(message))
+        # Frames are parsed only when a test asks for them.
+        self.devices[addr]['msgs'].append(message)
+
+    def _parse_messages(self, frames):
+        messages = []
+
+        for frame in frames:
+            # Ignore any exceptions
+            try:
+                msg = self._message_factory.create(io.BytesIO(frame))
+
+                if msg is not None:
+                    messages.append(msg)
 
-            if msg is not None:
-                self.devices[addr]['msgs'].append(msg)
+            except Exception as e:
+                # Just print the exception to the console
+                print("EXCEPTION: %s" % e)
+                pass
 
-        except Exception as e:
-            # Just print the exception to the console
-            print("EXCEPTION: %s" % e)
-            pass
+        return message.MessagesSet(messages)
 
     def set_lowpan_context(self, cid, prefix):
         self._message_factory.set_lowpan_context(cid, prefix)
@@ -109,10 +119,10 @@ class VirtualTime:
         """
         addr = ('127.0.0.1', self.port + nodeid)
 
-        messages = self.devices[addr]['msgs']
+        frames = self.devices[addr]['msgs']
         self.devices[addr]['msgs'] = []
 
-        return message.MessagesSet(messages)
+        return self._parse_messages(frames)
 
     def receive_events(self):
 
@@ -229,7 +239,7 @@ class VirtualTime:
         start_time = self.current_time
         self.current_event = None
 
-        print "running for %d us" % duration
+        print("running for %d us" % duration)
 
         self.receive_events()
 
@@ -238,3 +248,58 @@ class VirtualTime:
             self.receive_events()
 
         self.sync_devices()
+
+class NativeVirtualTime(VirtualTime):
+    """ Virtual time driven by the native coordinator in tools/virtual-time.
+
+    The coordinator speaks the same event protocol with the nodes as VirtualTime, and keeps the sniffed frames until
+    get_messages_sent_by() asks for them.
+    """
+
+    def __init__(self, coordinator):
+        self.current_time = 0
+        self.event_count = 0
+
+        self._message_factory = config.create_default_thread_message_factory()
+        self._process = subprocess.Popen([coordinator], stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                                         universal_newlines=True)
+
+    def __del__(self):
+        if self._process.poll() is None:
+            self._process.stdin.write('exit\n')
+            self._process.stdin.flush()
+            self._process.wait()
+
+    def _command(self, command):
+        self._process.stdin.write(command + '\n')
+        self._process.stdin.flush()
+
+        return self._process.stdout.readline().strip()
+
+    def get_messages_sent_by(self, nodeid):
+        """ Get sniffed messages.
+
+        Note! This method flushes the message queue so calling this method again will return only the newly logged messages.
+
+        Args:
+            nodeid (int): node id
+
+        Returns:
+            MessagesSet: a set with received messages.
+        """
+        count = int(self._command('sniff %d' % nodeid))
+        frames = [bytes(bytearray.fromhex(self._process.stdout.readline().strip())) for _ in range(count)]
+
+        return self._parse_messages(frames)
+
+    def receive_events(self):
+        # The coordinator keeps receiving the events of the nodes on its own.
+        pass
+
+    def go(self, duration):
+
+        duration = int(duration) * 1000000
+
+        print("running for %d us" % duration)
+
+        self.current_time, self.event_count = [int(value) for value in self._command('go %d' % duration).split()]
@@ -0,0 +1,300 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "common/binary_log.hpp"
+#include "common/instance.hpp"
+#include "common/logging.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kBenchmarkPackets = 20000,
+};
+
+static const char kPacketFormat[] = "[INFO]-MAC-----: %s IPv6 %s msg, len:%d, chksum:%04x%s%s, sec:%s%s%s, prio:%s%s%s";
+static const char kSrcFormat[]    = "[INFO]-MAC-----: src: %s";
+static const char kDstFormat[]    = "[INFO]-MAC-----: dst: %s";
+static const char kMixedFormat[]  = "%-4s|%5.*s|%lu|%llx|%zu|%c|%%|%p";
+
+static otError AppendLog(BinaryLogBuffer &aBuffer, uint32_t aTimestamp, const char *aFormat, ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = aBuffer.Append(OT_LOG_LEVEL_INFO, OT_LOG_REGION_MAC, aTimestamp, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+static void FormatText(char *aBuffer, size_t aSize, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    vsnprintf(aBuffer, aSize, aFormat, args);
+    va_end(args);
+}
+
+static uint16_t ReadAll(BinaryLogBuffer &aBuffer, uint8_t *aOutput, uint16_t aSize)
+{
+    uint16_t length = 0;
+
+    while (!aBuffer.IsEmpty())
+    {
+        uint16_t       chunkLength;
+        const uint8_t *chunk = aBuffer.GetReadChunk(chunkLength);
+
+        VerifyOrQuit(length + chunkLength <= aSize, "BinaryLogBuffer returned more data than expected");
+        memcpy(aOutput + length, chunk, chunkLength);
+        length += chunkLength;
+        aBuffer.Consume(chunkLength);
+    }
+
+    return length;
+}
+
+static uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return static_cast<uint32_t>(aBuffer[0]) | (static_cast<uint32_t>(aBuffer[1]) << 8) |
+           (static_cast<uint32_t>(aBuffer[2]) << 16) | (static_cast<uint32_t>(aBuffer[3]) << 24);
+}
+
+void TestBinaryLogRecord(void)
+{
+    uint8_t         storage[256];
+    uint8_t         output[256];
+    BinaryLogBuffer buffer(storage, sizeof(storage));
+    uint16_t        length;
+    const uint8_t * cur;
+    int             value = 0;
+
+    printf("TestBinaryLogRecord");
+
+    SuccessOrQuit(AppendLog(buffer, 0x12345678, kMixedFormat, "ab", 3, "xyzw", 7ul, 0x1122334455667788ull,
+                            static_cast<size_t>(9), 'Q', &value),
+                  "Append failed");
+
+    length = ReadAll(buffer, output, sizeof(output));
+    VerifyOrQuit(length == BinaryLogBuffer::kHeaderSize + 3 + 4 + 5 + 8 + 8 + 8 + 4 + 8, "Record length is wrong");
+
+    VerifyOrQuit(output[0] == OT_LOG_LEVEL_INFO && output[1] == OT_LOG_REGION_MAC, "Level or region is wrong");
+    VerifyOrQuit(output[2] + (output[3] << 8) == length - BinaryLogBuffer::kHeaderSize, "Args length is wrong");
+    VerifyOrQuit(ReadUint32(&output[4]) == 0x12345678, "Timestamp is wrong");
+    VerifyOrQuit(ReadUint32(&output[8]) == BinaryLogBuffer::GetFormatId(kMixedFormat), "Format id is wrong");
+    VerifyOrQuit(otLogBinaryFormatAnchor + static_cast<int32_t>(ReadUint32(&output[8])) == kMixedFormat,
+                 "Format id does not map back to the format string");
+
+    cur = &output[BinaryLogBuffer::kHeaderSize];
+    VerifyOrQuit(cur[0] == 2 && memcmp(&cur[1], "ab", 2) == 0, "String arg is wrong");
+    cur += 3;
+    VerifyOrQuit(ReadUint32(cur) == 3, "Precision arg is wrong");
+    cur += 4;
+    VerifyOrQuit(cur[0] == 4 && memcmp(&cur[1], "xyzw", 4) == 0, "String arg is wrong");
+    cur += 5;
+    VerifyOrQuit(ReadUint32(cur) == 7 && ReadUint32(cur + 4) == 0, "Long arg is wrong");
+    cur += 8;
+    VerifyOrQuit(ReadUint32(cur) == 0x55667788 && ReadUint32(cur + 4) == 0x11223344, "Long long arg is wrong");
+    cur += 8;
+    VerifyOrQuit(ReadUint32(cur) == 9 && ReadUint32(cur + 4) == 0, "Size arg is wrong");
+    cur += 8;
+    VerifyOrQuit(ReadUint32(cur) == 'Q', "Char arg is wrong");
+    cur += 4;
+    VerifyOrQuit(ReadUint32(cur) == static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&value)), "Pointer is wrong");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogDump(void)
+{
+    uint8_t         storage[512];
+    uint8_t         output[512];
+    uint8_t         frame[200];
+    BinaryLogBuffer buffer(storage, sizeof(storage));
+    uint16_t        length;
+    uint16_t        dumpLength;
+    const uint8_t * cur;
+
+    printf("TestBinaryLogDump");
+
+    for (uint16_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i);
+    }
+
+    SuccessOrQuit(buffer.AppendDump(OT_LOG_LEVEL_DEBG, OT_LOG_REGION_MAC, 0, "RX", frame, 40), "AppendDump failed");
+    SuccessOrQuit(buffer.AppendDump(OT_LOG_LEVEL_DEBG, OT_LOG_REGION_MAC, 0, "TX", frame, sizeof(frame)),
+                  "AppendDump failed");
+
+    length = ReadAll(buffer, output, sizeof(output));
+
+    cur = &output[BinaryLogBuffer::kHeaderSize];
+    VerifyOrQuit(cur[0] == 2 && memcmp(&cur[1], "RX", 2) == 0, "Dump id is wrong");
+    VerifyOrQuit(ReadUint32(&cur[3]) == 40, "Dump length is wrong");
+    dumpLength = static_cast<uint16_t>(cur[7] + (cur[8] << 8));
+    VerifyOrQuit(dumpLength == 40 && memcmp(&cur[9], frame, dumpLength) == 0, "Dump content is wrong");
+    cur += 9 + dumpLength;
+
+    // The second dump does not fit in a record and is truncated, but keeps the original length.
+    VerifyOrQuit(cur - output + BinaryLogBuffer::kMaxRecordSize == length, "Truncated dump record size is wrong");
+    cur += BinaryLogBuffer::kHeaderSize;
+    VerifyOrQuit(ReadUint32(&cur[3]) == sizeof(frame), "Truncated dump length is wrong");
+    dumpLength = static_cast<uint16_t>(cur[7] + (cur[8] << 8));
+    VerifyOrQuit(dumpLength == BinaryLogBuffer::kMaxRecordSize - BinaryLogBuffer::kHeaderSize - 9,
+                 "Truncated dump content length is wrong");
+    VerifyOrQuit(memcmp(&cur[9], frame, dumpLength) == 0, "Truncated dump content is wrong");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogWrapAround(void)
+{
+    const uint16_t  kRecordLength = BinaryLogBuffer::kHeaderSize + sizeof(uint32_t);
+    uint8_t         storage[3 * kRecordLength];
+    uint8_t         output[kRecordLength];
+    BinaryLogBuffer buffer(storage, sizeof(storage));
+    uint32_t        next = 0;
+
+    printf("TestBinaryLogWrapAround");
+
+    // One byte of the ring buffer is always left unused, so only two records fit.
+    SuccessOrQuit(AppendLog(buffer, 0, "%d", next++), "Append failed");
+    SuccessOrQuit(AppendLog(buffer, 0, "%d", next++), "Append failed");
+    VerifyOrQuit(AppendLog(buffer, 0, "%d", next) == OT_ERROR_NO_BUFS, "Append did not fail on full buffer");
+    VerifyOrQuit(buffer.GetDroppedCount() == 1, "Dropped count is wrong");
+
+    for (uint32_t expected = 0; expected < 100; expected++)
+    {
+        uint16_t length = 0;
+
+        while (length < kRecordLength)
+        {
+            uint16_t       chunkLength;
+            const uint8_t *chunk = buffer.GetReadChunk(chunkLength);
+
+            VerifyOrQuit(chunkLength > 0, "Buffer is unexpectedly empty");
+
+            if (chunkLength > kRecordLength - length)
+            {
+                chunkLength = kRecordLength - length;
+            }
+
+            memcpy(output + length, chunk, chunkLength);
+            length += chunkLength;
+            buffer.Consume(chunkLength);
+        }
+
+        VerifyOrQuit(ReadUint32(&output[BinaryLogBuffer::kHeaderSize]) == expected, "Records are out of order");
+
+        SuccessOrQuit(AppendLog(buffer, 0, "%d", next++), "Append failed");
+    }
+
+    VerifyOrQuit(buffer.GetDroppedCount() == 1, "Dropped count is wrong");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogBenchmark(void)
+{
+    Instance *      instance = testInitInstance();
+    uint8_t         storage[OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE];
+    uint8_t         output[OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE];
+    uint8_t         frame[127];
+    char            text[512];
+    BinaryLogBuffer buffer(storage, sizeof(storage));
+    uint64_t        start;
+    uint64_t        textDuration;
+    uint64_t        binaryDuration;
+
+    // This measures the cost of logging one received packet at INFO level (the three lines logged by
+    // `MeshForwarder::LogIp6Message()` and a dump of the frame) when the log is formatted as text on the
+    // device, compared to appending binary records (including draining the ring buffer).
+
+    printf("TestBinaryLogBenchmark\n");
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    memset(frame, 0xa5, sizeof(frame));
+
+    start = testGetNowUs();
+
+    for (int i = 0; i < kBenchmarkPackets; i++)
+    {
+        FormatText(text, sizeof(text), kPacketFormat, "Received", "UDP", 96 + (i & 0x1f), i & 0xffff, ", from:",
+                   "0x9c00", "yes", "", "", "medium", ", rss:", "-40 dBm");
+        FormatText(text, sizeof(text), kSrcFormat, "fe80:0:0:0:1ce1:a63b:f41a:7dbd");
+        FormatText(text, sizeof(text), kDstFormat, "fdde:ad00:beef:0:0:ff:fe00:9c00");
+        otDump(instance, OT_LOG_LEVEL_INFO, OT_LOG_REGION_MAC, "RX", frame, sizeof(frame));
+    }
+
+    textDuration = testGetNowUs() - start;
+
+    start = testGetNowUs();
+
+    for (int i = 0; i < kBenchmarkPackets; i++)
+    {
+        AppendLog(buffer, 0, kPacketFormat, "Received", "UDP", 96 + (i & 0x1f), i & 0xffff, ", from:", "0x9c00",
+                  "yes", "", "", "medium", ", rss:", "-40 dBm");
+        AppendLog(buffer, 0, kSrcFormat, "fe80:0:0:0:1ce1:a63b:f41a:7dbd");
+        AppendLog(buffer, 0, kDstFormat, "fdde:ad00:beef:0:0:ff:fe00:9c00");
+        buffer.AppendDump(OT_LOG_LEVEL_INFO, OT_LOG_REGION_MAC, 0, "RX", frame, sizeof(frame));
+        ReadAll(buffer, output, sizeof(output));
+    }
+
+    binaryDuration = testGetNowUs() - start;
+
+    VerifyOrQuit(buffer.GetDroppedCount() == 0, "Records were dropped");
+
+    printf("  text:   %5u ns/packet\n", static_cast<unsigned int>(1000ull * textDuration / kBenchmarkPackets));
+    printf("  binary: %5u ns/packet\n", static_cast<unsigned int>(1000ull * binaryDuration / kBenchmarkPackets));
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestBinaryLogRecord();
+    ot::TestBinaryLogDump();
+    ot::TestBinaryLogWrapAround();
+    ot::TestBinaryLogBenchmark();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,393 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/dhcp6.hpp"
+#include "thread/network_data_leader.hpp"
+#include "thread/thread_netif.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#if OPENTHREAD_ENABLE_DHCP6_SERVER
+
+namespace ot {
+
+enum
+{
+    kNumClients  = 4096,
+    kNumPrefixes = 2,
+};
+
+struct ReplyContext
+{
+    uint16_t                mCount;
+    Dhcp6::Dhcp6Header      mHeader;
+    Dhcp6::ClientIdentifier mClient;
+    Dhcp6::StatusCode       mStatus;
+    Dhcp6::IaAddress        mAddresses[kNumPrefixes];
+    uint8_t                 mNumAddresses;
+};
+
+static void ProcessTasklets(Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance))
+    {
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+static void HandleReply(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    ReplyContext &context = *static_cast<ReplyContext *>(aContext);
+    Message &     message = *static_cast<Message *>(aMessage);
+    uint16_t      offset  = message.GetOffset();
+    uint16_t      iaNaEnd;
+    Dhcp6::IaNa   iana;
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    // The server replies with Server Identifier, Client Identifier, IA_NA (Status Code, IA Addresses) and Rapid
+    // Commit options.
+    context.mCount++;
+    context.mNumAddresses = 0;
+
+    offset += message.Read(offset, sizeof(context.mHeader), &context.mHeader);
+    offset += sizeof(Dhcp6::ServerIdentifier);
+    offset += message.Read(offset, sizeof(context.mClient), &context.mClient);
+    VerifyOrQuit(message.Read(offset, sizeof(iana), &iana) == sizeof(iana), "Reply without IA_NA\n");
+    iaNaEnd = offset + sizeof(Dhcp6::Dhcp6Option) + iana.GetLength();
+    offset += sizeof(iana);
+    offset += message.Read(offset, sizeof(context.mStatus), &context.mStatus);
+
+    while (offset < iaNaEnd && context.mNumAddresses < kNumPrefixes)
+    {
+        offset += message.Read(offset, sizeof(Dhcp6::IaAddress), &context.mAddresses[context.mNumAddresses++]);
+    }
+
+    VerifyOrQuit(offset == iaNaEnd, "IA_NA length does not match its addresses\n");
+}
+
+static uint8_t BuildDhcpPrefixRegistration(uint8_t *aTlvs, uint8_t aPrefixIndex, uint16_t aRloc16)
+{
+    const uint8_t                   prefixBytes[] = {0xfd, 0x00, 0x0d, 0xb8, 0x00, 0x00, 0x00, aPrefixIndex};
+    NetworkData::PrefixTlv *        prefix        = reinterpret_cast<NetworkData::PrefixTlv *>(aTlvs);
+    NetworkData::BorderRouterTlv *  borderRouter;
+    NetworkData::BorderRouterEntry *entry;
+
+    prefix->Init(0, 64, prefixBytes);
+    prefix->SetStable();
+
+    borderRouter = static_cast<NetworkData::BorderRouterTlv *>(prefix->GetSubTlvs());
+    borderRouter->Init();
+    borderRouter->SetStable();
+    borderRouter->SetLength(sizeof(NetworkData::BorderRouterEntry));
+
+    entry = borderRouter->GetEntry(0);
+    entry->Init();
+    entry->SetRloc(aRloc16);
+    entry->SetPreferred();
+    entry->SetDhcp();
+    entry->SetOnMesh();
+
+    prefix->SetSubTlvsLength(sizeof(NetworkData::BorderRouterTlv) + sizeof(NetworkData::BorderRouterEntry));
+
+    return static_cast<uint8_t>(sizeof(NetworkData::NetworkDataTlv) + prefix->GetLength());
+}
+
+static void RegisterDhcpPrefixes(Instance &aInstance, const uint8_t *aPrefixIndexes, uint8_t aNumPrefixes)
+{
+    ThreadNetif &netif  = aInstance.GetThreadNetif();
+    uint16_t     rloc16 = netif.GetMle().GetRloc16();
+    uint8_t      tlvs[NetworkData::NetworkData::kMaxSize];
+    uint8_t      length = 0;
+
+    for (uint8_t i = 0; i < aNumPrefixes; i++)
+    {
+        length += BuildDhcpPrefixRegistration(tlvs + length, aPrefixIndexes[i], rloc16);
+    }
+
+    SuccessOrQuit(netif.GetNetworkDataLeader().RegisterNetworkData(rloc16, tlvs, length),
+                  "RegisterNetworkData() failed\n");
+    SuccessOrQuit(netif.GetDhcp6Server().UpdateService(), "UpdateService() failed\n");
+}
+
+static void GetClientExtAddress(uint16_t aClient, Mac::ExtAddress &aExtAddress)
+{
+    memset(&aExtAddress, 0, sizeof(aExtAddress));
+    aExtAddress.m8[0] = 0x12;
+    aExtAddress.m8[1] = 0x34;
+    aExtAddress.m8[6] = static_cast<uint8_t>(aClient >> 8);
+    aExtAddress.m8[7] = static_cast<uint8_t>(aClient & 0xff);
+}
+
+enum SolicitFlags
+{
+    kSolicitRapidCommit      = 1 << 0,
+    kSolicitServerIdentifier = 1 << 1,
+    kSolicitClientIdentifier = 1 << 2,
+    kSolicitTruncatedOption  = 1 << 3, ///< Ends with an option longer than the rest of the message.
+    kSolicitWrappingOption   = 1 << 4, ///< Ends with an option whose length wraps the offset back to the option.
+    kSolicitWrappingIaOption = 1 << 5, ///< The IA_NA holds an option whose length wraps the offset back to it.
+    kSolicitDefault          = kSolicitRapidCommit | kSolicitClientIdentifier,
+};
+
+static void SendSolicit(Instance &          aInstance,
+                        Ip6::UdpSocket &    aSocket,
+                        uint16_t            aClient,
+                        int                 aFlags,
+                        const otIp6Address *aHint)
+{
+    ThreadNetif &           netif   = aInstance.GetThreadNetif();
+    Message *               message = aSocket.NewMessage(0);
+    Ip6::MessageInfo        messageInfo;
+    Mac::ExtAddress         extAddress;
+    uint8_t                 transactionId[Dhcp6::kTransactionIdSize];
+    Dhcp6::Dhcp6Header      header;
+    Dhcp6::ElapsedTime      elapsedTime;
+    Dhcp6::ClientIdentifier clientIdentifier;
+    Dhcp6::ServerIdentifier serverIdentifier;
+    Dhcp6::IaNa             iana;
+    Dhcp6::IaAddress        iaAddress;
+    Dhcp6::RapidCommit      rapidCommit;
+    Dhcp6::Dhcp6Option      option;
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed\n");
+    GetClientExtAddress(aClient, extAddress);
+
+    transactionId[0] = 0x5a;
+    transactionId[1] = static_cast<uint8_t>(aClient >> 8);
+    transactionId[2] = static_cast<uint8_t>(aClient & 0xff);
+
+    header.Init();
+    header.SetType(Dhcp6::kTypeSolicit);
+    header.SetTransactionId(transactionId);
+    SuccessOrQuit(message->Append(&header, sizeof(header)), "Append() failed\n");
+
+    elapsedTime.Init();
+    SuccessOrQuit(message->Append(&elapsedTime, sizeof(elapsedTime)), "Append() failed\n");
+
+    if (aFlags & kSolicitClientIdentifier)
+    {
+        clientIdentifier.Init();
+        clientIdentifier.SetDuidType(Dhcp6::kDuidLL);
+        clientIdentifier.SetDuidHardwareType(Dhcp6::kHardwareTypeEui64);
+        clientIdentifier.SetDuidLinkLayerAddress(extAddress);
+        SuccessOrQuit(message->Append(&clientIdentifier, sizeof(clientIdentifier)), "Append() failed\n");
+    }
+
+    if (aFlags & kSolicitServerIdentifier)
+    {
+        serverIdentifier.Init();
+        serverIdentifier.SetDuidType(Dhcp6::kDuidLL);
+        serverIdentifier.SetDuidHardwareType(Dhcp6::kHardwareTypeEui64);
+        serverIdentifier.SetDuidLinkLayerAddress(netif.GetMac().GetExtAddress());
+        SuccessOrQuit(message->Append(&serverIdentifier, sizeof(serverIdentifier)), "Append() failed\n");
+    }
+
+    iana.Init();
+    iana.SetIaid(aClient);
+    iana.SetLength(sizeof(iana) - sizeof(Dhcp6::Dhcp6Option) + ((aHint != NULL) ? sizeof(iaAddress) : 0) +
+                   ((aFlags & kSolicitWrappingIaOption) ? sizeof(option) : 0));
+    SuccessOrQuit(message->Append(&iana, sizeof(iana)), "Append() failed\n");
+
+    if (aFlags & kSolicitWrappingIaOption)
+    {
+        option.Init();
+        option.SetCode(Dhcp6::kOptionStatusCode);
+        option.SetLength(0x10000 - sizeof(option));
+        SuccessOrQuit(message->Append(&option, sizeof(option)), "Append() failed\n");
+    }
+
+    if (aHint != NULL)
+    {
+        iaAddress.Init();
+        iaAddress.SetAddress(*const_cast<otIp6Address *>(aHint));
+        SuccessOrQuit(message->Append(&iaAddress, sizeof(iaAddress)), "Append() failed\n");
+    }
+
+    if (aFlags & kSolicitRapidCommit)
+    {
+        rapidCommit.Init();
+        SuccessOrQuit(message->Append(&rapidCommit, sizeof(rapidCommit)), "Append() failed\n");
+    }
+
+    if (aFlags & (kSolicitTruncatedOption | kSolicitWrappingOption))
+    {
+        option.Init();
+        option.SetCode(Dhcp6::kOptionStatusCode);
+        option.SetLength((aFlags & kSolicitWrappingOption) ? 0x10000 - sizeof(option) : sizeof(option));
+        SuccessOrQuit(message->Append(&option, sizeof(option)), "Append() failed\n");
+    }
+
+    // Send to the DHCP Agent ALOC of the first DHCP prefix, which is given Context ID 1.
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.GetPeerAddr() = netif.GetMle().GetMeshLocal16();
+    messageInfo.GetPeerAddr().mFields.m16[7] = HostSwap16(0xfc01);
+    messageInfo.mPeerPort                    = Dhcp6::kDhcpServerPort;
+    messageInfo.SetInterfaceId(netif.GetInterfaceId());
+    SuccessOrQuit(aSocket.SendTo(*message, messageInfo), "SendTo() failed\n");
+
+    ProcessTasklets(aInstance);
+}
+
+static void VerifyReply(ReplyContext &aContext, uint16_t aClient, const uint8_t *aPrefixIndexes, uint8_t aNum)
+{
+    Mac::ExtAddress extAddress;
+    Ip6::Address    expected;
+
+    GetClientExtAddress(aClient, extAddress);
+
+    VerifyOrQuit(aContext.mHeader.GetType() == Dhcp6::kTypeReply, "Reply has the wrong type\n");
+    VerifyOrQuit(aContext.mHeader.GetTransactionId()[1] == (aClient >> 8) &&
+                     aContext.mHeader.GetTransactionId()[2] == (aClient & 0xff),
+                 "Reply has the wrong transaction ID\n");
+    VerifyOrQuit(memcmp(aContext.mClient.GetDuidLinkLayerAddress(), extAddress.m8, sizeof(extAddress)) == 0,
+                 "Reply has the wrong Client Identifier\n");
+    VerifyOrQuit(aContext.mStatus.GetStatusCode() == Dhcp6::kStatusSuccess, "Reply has a failure status\n");
+    VerifyOrQuit(aContext.mNumAddresses == aNum, "Reply has the wrong number of addresses\n");
+
+    for (uint8_t i = 0; i < aNum; i++)
+    {
+        memset(&expected, 0, sizeof(expected));
+        expected.mFields.m8[0] = 0xfd;
+        expected.mFields.m8[2] = 0x0d;
+        expected.mFields.m8[3] = 0xb8;
+        expected.mFields.m8[7] = aPrefixIndexes[i];
+        expected.SetIid(extAddress);
+
+        VerifyOrQuit(memcmp(aContext.mAddresses[i].GetAddress(), &expected, sizeof(expected)) == 0,
+                     "Reply has the wrong address\n");
+    }
+}
+
+void TestDhcp6ServerClients(void)
+{
+    const uint8_t kPrefixes[]           = {1, 2};
+    const uint8_t kRenumberedPrefixes[] = {1, 3};
+    ot::Instance *instance;
+    ReplyContext  context;
+    Ip6::SockAddr sockaddr;
+    otIp6Address  hint;
+    uint64_t      start;
+    uint64_t      duration;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    ThreadNetif &  netif = instance->GetThreadNetif();
+    Ip6::UdpSocket socket(netif.GetIp6().GetUdp());
+
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "otIp6SetEnabled() failed\n");
+    ProcessTasklets(*instance);
+    RegisterDhcpPrefixes(*instance, kPrefixes, sizeof(kPrefixes));
+
+    memset(&context, 0, sizeof(context));
+    SuccessOrQuit(socket.Open(HandleReply, &context), "Open() failed\n");
+    sockaddr.mPort = Dhcp6::kDhcpClientPort;
+    SuccessOrQuit(socket.Bind(sockaddr), "Bind() failed\n");
+
+    // Every client gets one address per DHCP prefix, derived from its DUID.
+    start = testGetNowUs();
+
+    for (uint16_t i = 0; i < kNumClients; i++)
+    {
+        SendSolicit(*instance, socket, i, kSolicitDefault, NULL);
+        VerifyOrQuit(context.mCount == i + 1, "No reply to Solicit\n");
+        VerifyReply(context, i, kPrefixes, sizeof(kPrefixes));
+    }
+
+    duration = testGetNowUs() - start;
+
+    // Repeated Solicits are answered with the same addresses.
+    for (uint16_t i = 0; i < kNumClients; i += 64)
+    {
+        context.mCount = 0;
+        SendSolicit(*instance, socket, i, kSolicitDefault, NULL);
+        VerifyOrQuit(context.mCount == 1, "No reply to repeated Solicit\n");
+        VerifyReply(context, i, kPrefixes, sizeof(kPrefixes));
+    }
+
+    // An IA Address hint restricts the reply to the matching prefix.
+    hint           = *context.mAddresses[1].GetAddress();
+    context.mCount = 0;
+    SendSolicit(*instance, socket, 7, kSolicitDefault, &hint);
+    VerifyOrQuit(context.mCount == 1, "No reply to Solicit with an IA Address\n");
+    VerifyReply(context, 7, &kPrefixes[1], 1);
+
+    // Solicits that cannot be answered with Rapid Commit are discarded.
+    context.mCount = 0;
+    SendSolicit(*instance, socket, 1, kSolicitClientIdentifier, NULL);
+    SendSolicit(*instance, socket, 1, kSolicitDefault | kSolicitServerIdentifier, NULL);
+    SendSolicit(*instance, socket, 1, kSolicitRapidCommit, NULL);
+    VerifyOrQuit(context.mCount == 0, "Replied to an invalid Solicit\n");
+
+    // Solicits with an option running past the end of the message or of the IA_NA are discarded.
+    SendSolicit(*instance, socket, 1, kSolicitDefault | kSolicitTruncatedOption, NULL);
+    SendSolicit(*instance, socket, 1, kSolicitDefault | kSolicitWrappingOption, NULL);
+    SendSolicit(*instance, socket, 1, kSolicitDefault | kSolicitWrappingIaOption, NULL);
+    VerifyOrQuit(context.mCount == 0, "Replied to a Solicit with a malformed option\n");
+
+    // Renumbering one prefix is reflected in the next replies.
+    RegisterDhcpPrefixes(*instance, kRenumberedPrefixes, sizeof(kRenumberedPrefixes));
+
+    for (uint16_t i = 0; i < kNumClients; i += 64)
+    {
+        context.mCount = 0;
+        SendSolicit(*instance, socket, i, kSolicitDefault, NULL);
+        VerifyOrQuit(context.mCount == 1, "No reply after renumbering\n");
+        VerifyReply(context, i, kRenumberedPrefixes, sizeof(kRenumberedPrefixes));
+    }
+
+    printf("%d clients served in %llu us (%.2f us per Solicit/Reply)\n", kNumClients,
+           static_cast<unsigned long long>(duration), static_cast<double>(duration) / kNumClients);
+
+    socket.Close();
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_ENABLE_DHCP6_SERVER
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_ENABLE_DHCP6_SERVER
+    ot::TestDhcp6ServerClients();
+#endif
+
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
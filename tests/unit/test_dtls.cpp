@@ -0,0 +1,322 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdlib.h>
+
+#include <openthread/config.h>
+#include <openthread/openthread.h>
+
+#include <mbedtls/platform.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "meshcop/dtls.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kMaxDatagrams    = 8,
+    kMaxDatagramSize = 1280,
+};
+
+/**
+ * This structure represents one side of an in-memory DTLS link.
+ *
+ */
+struct Endpoint
+{
+    MeshCoP::Dtls *mDtls;
+    Endpoint *     mPeer;
+    uint8_t        mDatagrams[kMaxDatagrams][kMaxDatagramSize];
+    uint16_t       mLengths[kMaxDatagrams];
+    uint8_t        mNumDatagrams;
+    uint8_t        mNumReceived;
+    bool           mConnected;
+};
+
+static const uint8_t sClientId[] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0};
+
+static Endpoint sClient;
+static Endpoint sServer;
+
+static otError HandleSend(void *aContext, const uint8_t *aBuf, uint16_t aLength, uint8_t aMessageSubType)
+{
+    Endpoint &endpoint = *static_cast<Endpoint *>(aContext);
+    otError   error    = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(aMessageSubType);
+
+    VerifyOrExit(endpoint.mNumDatagrams < kMaxDatagrams && aLength <= kMaxDatagramSize, error = OT_ERROR_NO_BUFS);
+
+    memcpy(endpoint.mDatagrams[endpoint.mNumDatagrams], aBuf, aLength);
+    endpoint.mLengths[endpoint.mNumDatagrams++] = aLength;
+
+exit:
+    return error;
+}
+
+static void HandleConnected(void *aContext, bool aConnected)
+{
+    static_cast<Endpoint *>(aContext)->mConnected = aConnected;
+}
+
+static void HandleReceive(void *aContext, uint8_t *aBuf, uint16_t aLength)
+{
+    OT_UNUSED_VARIABLE(aBuf);
+    OT_UNUSED_VARIABLE(aLength);
+
+    static_cast<Endpoint *>(aContext)->mNumReceived++;
+}
+
+static void Deliver(Instance &aInstance, Endpoint &aFrom)
+{
+    // A stopped endpoint drops the datagrams sent to it.
+    for (uint8_t i = 0; i < aFrom.mNumDatagrams && aFrom.mPeer->mDtls->IsStarted(); i++)
+    {
+        Message *message = aInstance.GetMessagePool().New(Message::kTypeIp6, 0);
+
+        VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+        SuccessOrQuit(message->Append(aFrom.mDatagrams[i], aFrom.mLengths[i]), "Message::Append() failed");
+
+        // As `CoapSecure`, the server sets the client ID of every received datagram.
+        if (aFrom.mPeer == &sServer)
+        {
+            SuccessOrQuit(sServer.mDtls->SetClientId(sClientId, sizeof(sClientId)), "Dtls::SetClientId() failed");
+        }
+
+        SuccessOrQuit(aFrom.mPeer->mDtls->Receive(*message, 0, aFrom.mLengths[i]), "Dtls::Receive() failed");
+        message->Free();
+    }
+
+    aFrom.mNumDatagrams = 0;
+}
+
+static uint32_t Handshake(Instance &aInstance, const char *aPsk)
+{
+    uint64_t start;
+    uint8_t  rounds = 0;
+
+    sClient.mNumDatagrams = 0;
+    sServer.mNumDatagrams = 0;
+
+    start = testGetNowUs();
+
+    SuccessOrQuit(sServer.mDtls->SetPsk(reinterpret_cast<const uint8_t *>(aPsk), static_cast<uint8_t>(strlen(aPsk))),
+                  "Dtls::SetPsk() failed");
+    SuccessOrQuit(sServer.mDtls->Start(false, HandleConnected, HandleReceive, HandleSend, &sServer),
+                  "Dtls::Start() failed for the server");
+
+    SuccessOrQuit(sClient.mDtls->SetPsk(reinterpret_cast<const uint8_t *>(aPsk), static_cast<uint8_t>(strlen(aPsk))),
+                  "Dtls::SetPsk() failed");
+    SuccessOrQuit(sClient.mDtls->Start(true, HandleConnected, HandleReceive, HandleSend, &sClient),
+                  "Dtls::Start() failed for the client");
+
+    while (sClient.mNumDatagrams != 0 || sServer.mNumDatagrams != 0)
+    {
+        VerifyOrQuit(rounds++ < 2 * MeshCoP::Dtls::kMaxHandshakeFlights, "Handshake did not complete");
+        Deliver(aInstance, sClient);
+        Deliver(aInstance, sServer);
+    }
+
+    VerifyOrQuit(sClient.mConnected && sServer.mConnected, "Handshake failed");
+    VerifyOrQuit(sClient.mDtls->GetHandshakeInfo().mComplete && sServer.mDtls->GetHandshakeInfo().mComplete,
+                 "Handshake was not reported complete");
+
+    return static_cast<uint32_t>(testGetNowUs() - start);
+}
+
+static void Disconnect(void)
+{
+    SuccessOrQuit(sClient.mDtls->Stop(), "Dtls::Stop() failed for the client");
+    SuccessOrQuit(sServer.mDtls->Stop(), "Dtls::Stop() failed for the server");
+    VerifyOrQuit(!sClient.mConnected && !sServer.mConnected, "Dtls::Stop() did not disconnect");
+}
+
+// Sends @p aNumRecords records from the client, one per datagram, and delivers them to the server back to back in a
+// single datagram (as a Joiner Router relaying several datagrams in one Relay Receive notification), with the last
+// byte of record @p aCorrupted (if any) modified.  Returns the number of records the server received.
+static uint8_t DeliverConcatenated(Instance &aInstance, uint8_t aNumRecords, uint8_t aCorrupted)
+{
+    Message *message;
+    uint16_t length = 0;
+
+    sClient.mNumDatagrams = 0;
+    sServer.mNumReceived  = 0;
+
+    for (uint8_t i = 0; i < aNumRecords; i++)
+    {
+        message = aInstance.GetMessagePool().New(Message::kTypeIp6, 0);
+        VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+        SuccessOrQuit(message->Append(&i, sizeof(i)), "Message::Append() failed");
+        SuccessOrQuit(sClient.mDtls->Send(*message, message->GetLength()), "Dtls::Send() failed");
+    }
+
+    VerifyOrQuit(sClient.mNumDatagrams == aNumRecords, "Records were not sent in separate datagrams");
+
+    message = aInstance.GetMessagePool().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+
+    for (uint8_t i = 0; i < aNumRecords; i++)
+    {
+        if (i == aCorrupted)
+        {
+            sClient.mDatagrams[i][sClient.mLengths[i] - 1] ^= 0xff;
+        }
+
+        SuccessOrQuit(message->Append(sClient.mDatagrams[i], sClient.mLengths[i]), "Message::Append() failed");
+        length += sClient.mLengths[i];
+    }
+
+    SuccessOrQuit(sServer.mDtls->SetClientId(sClientId, sizeof(sClientId)), "Dtls::SetClientId() failed");
+    SuccessOrQuit(sServer.mDtls->Receive(*message, 0, length), "Dtls::Receive() failed");
+    message->Free();
+
+    sClient.mNumDatagrams = 0;
+
+    return sServer.mNumReceived;
+}
+
+static void InitEndpoints(MeshCoP::Dtls &aClient, MeshCoP::Dtls &aServer)
+{
+    // Both endpoints run in one instance, whose heap only fits the handshake of a single DTLS session.
+    mbedtls_platform_set_calloc_free(calloc, free);
+
+    memset(&sClient, 0, sizeof(sClient));
+    memset(&sServer, 0, sizeof(sServer));
+    sClient.mDtls = &aClient;
+    sClient.mPeer = &sServer;
+    sServer.mDtls = &aServer;
+    sServer.mPeer = &sClient;
+}
+
+static void PrintFlights(const char *aName, const MeshCoP::Dtls::HandshakeInfo &aInfo)
+{
+    printf("  %s: %u ms, %u flights:", aName, static_cast<unsigned int>(aInfo.mDuration), aInfo.mNumFlights);
+
+    for (uint8_t i = 0; i < aInfo.mNumFlights; i++)
+    {
+        printf(" %s@%u", (aInfo.mFlightSentMask & (1 << i)) ? "tx" : "rx",
+               static_cast<unsigned int>(aInfo.mFlightTime[i]));
+    }
+
+    printf("\n");
+}
+
+void TestDtlsSessionResumption(void)
+{
+    Instance *    instance = static_cast<Instance *>(testInitInstance());
+    MeshCoP::Dtls client(*instance);
+    MeshCoP::Dtls server(*instance);
+    uint32_t      fullTime;
+    uint32_t      resumedTime;
+    uint8_t       fullFlights;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    InitEndpoints(client, server);
+
+    // The first connection runs the full EC-JPAKE handshake.
+    fullTime = Handshake(*instance, "J01NME");
+    VerifyOrQuit(!client.GetHandshakeInfo().mResumed && !server.GetHandshakeInfo().mResumed,
+                 "First handshake was resumed");
+    fullFlights = client.GetHandshakeInfo().mNumFlights;
+    VerifyOrQuit(server.GetHandshakeInfo().mNumFlights == fullFlights, "Endpoints saw different flights");
+    PrintFlights("full client", client.GetHandshakeInfo());
+    PrintFlights("full server", server.GetHandshakeInfo());
+    Disconnect();
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    // Reconnecting with the same PSK resumes the session.
+    resumedTime = Handshake(*instance, "J01NME");
+    VerifyOrQuit(client.GetHandshakeInfo().mResumed && server.GetHandshakeInfo().mResumed,
+                 "Reconnection was not resumed");
+    VerifyOrQuit(client.GetHandshakeInfo().mNumFlights < fullFlights, "Resumed handshake did not save a flight");
+    PrintFlights("resumed client", client.GetHandshakeInfo());
+    PrintFlights("resumed server", server.GetHandshakeInfo());
+    Disconnect();
+
+    // A session is never resumed with another PSK.
+    Handshake(*instance, "J01NU5");
+    VerifyOrQuit(!client.GetHandshakeInfo().mResumed && !server.GetHandshakeInfo().mResumed,
+                 "Session was resumed with another PSK");
+    Disconnect();
+#else
+    resumedTime = Handshake(*instance, "J01NME");
+    VerifyOrQuit(!client.GetHandshakeInfo().mResumed, "Session was resumed without a session cache");
+    Disconnect();
+#endif
+
+    printf("TestDtlsSessionResumption -- PASS (full handshake %u us, resumed %u us)\n",
+           static_cast<unsigned int>(fullTime), static_cast<unsigned int>(resumedTime));
+
+    testFreeInstance(instance);
+}
+
+void TestDtlsConcatenatedRecords(void)
+{
+    Instance *    instance = static_cast<Instance *>(testInitInstance());
+    MeshCoP::Dtls client(*instance);
+    MeshCoP::Dtls server(*instance);
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    InitEndpoints(client, server);
+    Handshake(*instance, "J01NME");
+
+    VerifyOrQuit(DeliverConcatenated(*instance, 3, 3) == 3, "Concatenated records were not all received");
+
+    // mbedtls discards the rest of a datagram after an invalid record, so the records that follow it are lost too.
+    VerifyOrQuit(DeliverConcatenated(*instance, 3, 1) == 1, "Records after an invalid record were received");
+    VerifyOrQuit(DeliverConcatenated(*instance, 3, 0) == 0, "Records after an invalid record were received");
+
+    // The session itself is not affected.
+    VerifyOrQuit(DeliverConcatenated(*instance, 3, 3) == 3, "Concatenated records were not all received");
+    VerifyOrQuit(client.IsConnected() && server.IsConnected(), "Invalid record closed the session");
+
+    Disconnect();
+
+    printf("TestDtlsConcatenatedRecords -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestDtlsSessionResumption();
+    ot::TestDtlsConcatenatedRecords();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,556 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/radio.h>
+
+#include "coap/coap_header.hpp"
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "meshcop/joiner_router.hpp"
+#include "meshcop/meshcop.hpp"
+#include "meshcop/meshcop_tlvs.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/thread_netif.hpp"
+#include "thread/thread_uri_paths.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+using ot::Encoding::BigEndian::HostSwap16;
+
+namespace ot {
+
+enum
+{
+    kMaxJoiners     = OPENTHREAD_CONFIG_JOINER_ROUTER_MAX_JOINERS,
+    kJoinerTimeout  = OPENTHREAD_CONFIG_JOINER_ROUTER_JOINER_TIMEOUT * 1000, ///< milliseconds
+    kRelayBatchSize = OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_BATCH_SIZE,
+    kBatchWindow    = 20,     ///< milliseconds
+    kDatagramLength = 40,     ///< Length of the datagrams sent by the Joiners.
+    kJoinerPortBase = 49152,  ///< UDP port of the first Joiner.
+    kMaxRelayRx     = 64,     ///< Maximum number of Relay Receive notifications recorded.
+    kEntrustDelay   = 50,     ///< Delay before a Joiner Entrust is sent (milliseconds).
+    kEntrustTimeout = 300000, ///< Upper bound of a CoAP transaction (milliseconds).
+};
+
+/**
+ * This structure represents a Relay Receive notification received by the Border Agent.
+ *
+ */
+struct RelayRx
+{
+    uint8_t mJoiner;       ///< The Joiner whose datagrams are relayed.
+    uint8_t mNumDatagrams; ///< The number of datagrams relayed.
+    uint8_t mFirstSeq;     ///< The sequence number of the first datagram.
+};
+
+static const uint8_t kKek[] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                               0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+
+static uint8_t      sRadioPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame sRadioFrame;
+static bool         sTransmitPending;
+static uint32_t     sNow;
+static RelayRx      sRelayRx[kMaxRelayRx];
+static uint8_t      sNumRelayRx;
+
+static otRadioFrame *testGetTransmitBuffer(otInstance *)
+{
+    return &sRadioFrame;
+}
+
+static otError testTransmit(otInstance *)
+{
+    sTransmitPending = true;
+
+    return OT_ERROR_NONE;
+}
+
+static uint32_t testGetNow(void)
+{
+    return sNow;
+}
+
+// Runs the tasklets and completes the transmissions they start.
+static void ProcessTasklets(Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance) || sTransmitPending)
+    {
+        if (sTransmitPending)
+        {
+            sTransmitPending = false;
+            otPlatRadioTxDone(&aInstance, &sRadioFrame, NULL, OT_ERROR_NONE);
+        }
+
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+// Fires the timers that expire within @p aDuration milliseconds.
+static void AdvanceTime(Instance &aInstance, uint32_t aDuration)
+{
+    uint32_t end = sNow + aDuration;
+
+    ProcessTasklets(aInstance);
+
+    while (g_testPlatAlarmSet && static_cast<int32_t>(g_testPlatAlarmNext - end) <= 0)
+    {
+        if (static_cast<int32_t>(g_testPlatAlarmNext - sNow) > 0)
+        {
+            sNow = g_testPlatAlarmNext;
+        }
+
+        otPlatAlarmMilliFired(&aInstance);
+        ProcessTasklets(aInstance);
+    }
+
+    sNow = end;
+}
+
+static void GetJoinerIid(uint8_t aJoiner, uint8_t *aIid)
+{
+    static const uint8_t kIidPrefix[] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde};
+
+    memcpy(aIid, kIidPrefix, sizeof(kIidPrefix));
+    aIid[sizeof(kIidPrefix)] = aJoiner;
+}
+
+// Records the Relay Receive notifications, checking that they carry consecutive datagrams of a single Joiner.
+static void HandleRelayRx(void *aContext, otCoapHeader *aHeader, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    Message &             message = *static_cast<Message *>(aMessage);
+    MeshCoP::JoinerIidTlv iid;
+    RelayRx &             relayRx = sRelayRx[sNumRelayRx];
+    uint16_t              offset;
+    uint16_t              length;
+
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aHeader);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(sNumRelayRx < kMaxRelayRx, "Too many Relay Receive notifications");
+
+    SuccessOrQuit(MeshCoP::Tlv::GetTlv(message, MeshCoP::Tlv::kJoinerIid, sizeof(iid), iid), "No Joiner IID TLV");
+    SuccessOrQuit(MeshCoP::Tlv::GetValueOffset(message, MeshCoP::Tlv::kJoinerDtlsEncapsulation, offset, length),
+                  "No Joiner DTLS Encapsulation TLV");
+    VerifyOrQuit(length > 0 && length % kDatagramLength == 0, "Unexpected Joiner DTLS Encapsulation length");
+
+    relayRx.mJoiner       = iid.GetIid()[7];
+    relayRx.mNumDatagrams = static_cast<uint8_t>(length / kDatagramLength);
+    message.Read(offset, sizeof(relayRx.mFirstSeq), &relayRx.mFirstSeq);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        uint8_t seq;
+
+        message.Read(offset + i, sizeof(seq), &seq);
+        VerifyOrQuit(seq == relayRx.mFirstSeq + i / kDatagramLength, "Datagrams relayed out of order");
+    }
+
+    sNumRelayRx++;
+}
+
+static Instance *InitInstance(MeshCoP::JoinerRouter *&aJoinerRouter, Coap::Resource &aRelayRx)
+{
+    Instance *                     instance;
+    ThreadNetif *                  netif;
+    MeshCoP::BorderAgentLocatorTlv borderAgentLocator;
+    MeshCoP::SteeringDataTlv       steeringData;
+    uint8_t                        commissioningData[sizeof(borderAgentLocator) + sizeof(steeringData)];
+
+    testPlatResetToDefaults();
+    g_testPlatRadioCaps              = OT_RADIO_CAPS_CSMA_BACKOFF;
+    g_testPlatRadioGetTransmitBuffer = testGetTransmitBuffer;
+    g_testPlatRadioTransmit          = testTransmit;
+    g_testPlatAlarmGetNow            = testGetNow;
+
+    memset(&sRadioFrame, 0, sizeof(sRadioFrame));
+    sRadioFrame.mPsdu = sRadioPsdu;
+    sTransmitPending  = false;
+    sNow              = 1000;
+    sNumRelayRx       = 0;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+    netif         = &instance->GetThreadNetif();
+    aJoinerRouter = &netif->GetJoinerRouter();
+
+    SuccessOrQuit(otLinkSetPanId(instance, 0x1234), "otLinkSetPanId() failed");
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "otIp6SetEnabled() failed");
+    SuccessOrQuit(otThreadSetEnabled(instance, true), "otThreadSetEnabled() failed");
+    SuccessOrQuit(netif->GetMle().BecomeLeader(), "BecomeLeader() failed");
+    ProcessTasklets(*instance);
+
+    // The leader is also the Border Agent, which receives the Relay Receive notifications of its own Joiner Router.
+    SuccessOrQuit(netif->GetCoap().AddResource(aRelayRx), "AddResource() failed");
+
+    borderAgentLocator.Init();
+    borderAgentLocator.SetBorderAgentLocator(netif->GetMle().GetRloc16());
+    steeringData.Init();
+    steeringData.Set();
+    memcpy(commissioningData, &borderAgentLocator, sizeof(borderAgentLocator));
+    memcpy(commissioningData + sizeof(borderAgentLocator), &steeringData, sizeof(steeringData));
+    SuccessOrQuit(netif->GetNetworkDataLeader().SetCommissioningData(commissioningData, sizeof(commissioningData)),
+                  "SetCommissioningData() failed");
+    ProcessTasklets(*instance);
+
+    return instance;
+}
+
+// Returns a datagram of sequence number @p aSeq from a Joiner, as received over the radio.
+static Message *NewJoinerDatagram(Instance &aInstance, uint8_t aJoiner, uint8_t aSeq)
+{
+    ThreadNetif &  netif = aInstance.GetThreadNetif();
+    Message *      message;
+    Ip6::Header    header;
+    Ip6::UdpHeader udpHeader;
+    Ip6::Address   source;
+    uint8_t        payload[kDatagramLength];
+    const uint16_t udpLength = sizeof(udpHeader) + sizeof(payload);
+
+    memset(&source, 0, sizeof(source));
+    source.mFields.m16[0] = HostSwap16(0xfe80);
+    GetJoinerIid(aJoiner, source.mFields.m8 + 8);
+
+    header.Init();
+    header.SetPayloadLength(udpLength);
+    header.SetNextHeader(Ip6::kProtoUdp);
+    header.SetHopLimit(255);
+    header.SetSource(source);
+    header.SetDestination(netif.GetMle().GetLinkLocalAddress());
+
+    udpHeader.SetSourcePort(kJoinerPortBase + aJoiner);
+    udpHeader.SetDestinationPort(netif.GetJoinerRouter().GetJoinerUdpPort());
+    udpHeader.SetLength(udpLength);
+    udpHeader.SetChecksum(0);
+
+    memset(payload, aSeq, sizeof(payload));
+
+    message = aInstance.GetMessagePool().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+    SuccessOrQuit(message->Append(&header, sizeof(header)), "Append() failed");
+    SuccessOrQuit(message->Append(&udpHeader, sizeof(udpHeader)), "Append() failed");
+    SuccessOrQuit(message->Append(payload, sizeof(payload)), "Append() failed");
+
+    message->SetOffset(sizeof(header));
+    netif.GetIp6().GetUdp().UpdateChecksum(
+        *message,
+        Ip6::Ip6::ComputePseudoheaderChecksum(header.GetSource(), header.GetDestination(), udpLength, Ip6::kProtoUdp));
+    message->SetLinkSecurityEnabled(false);
+
+    return message;
+}
+
+static void Receive(Instance &aInstance, Message &aMessage)
+{
+    ThreadNetif &netif = aInstance.GetThreadNetif();
+
+    netif.GetIp6().HandleDatagram(aMessage, &netif, netif.GetInterfaceId(), NULL, false);
+    ProcessTasklets(aInstance);
+}
+
+static void ReceiveFromJoiner(Instance &aInstance, uint8_t aJoiner, uint8_t aSeq)
+{
+    Receive(aInstance, *NewJoinerDatagram(aInstance, aJoiner, aSeq));
+}
+
+// Sends a Relay Transmit notification for a Joiner from the Border Agent, with the KEK if @p aKek is TRUE.
+static void SendRelayTx(Instance &aInstance, uint8_t aJoiner, bool aKek)
+{
+    ThreadNetif &                   netif = aInstance.GetThreadNetif();
+    Message *                       message;
+    Coap::Header                    header;
+    MeshCoP::JoinerUdpPortTlv       udpPort;
+    MeshCoP::JoinerIidTlv           iid;
+    MeshCoP::JoinerRouterLocatorTlv rloc;
+    MeshCoP::JoinerRouterKekTlv     kek;
+    ExtendedTlv                     tlv;
+    uint8_t                         joinerIid[8];
+    uint8_t                         payload[kDatagramLength];
+    Ip6::MessageInfo                messageInfo;
+
+    header.Init(OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST);
+    header.AppendUriPathOptions(OT_URI_PATH_RELAY_TX);
+    header.SetPayloadMarker();
+
+    message = MeshCoP::NewMeshCoPMessage(netif.GetCoap(), header);
+    VerifyOrQuit(message != NULL, "NewMeshCoPMessage() failed");
+
+    udpPort.Init();
+    udpPort.SetUdpPort(kJoinerPortBase + aJoiner);
+    SuccessOrQuit(message->Append(&udpPort, sizeof(udpPort)), "Append() failed");
+
+    GetJoinerIid(aJoiner, joinerIid);
+    iid.Init();
+    iid.SetIid(joinerIid);
+    SuccessOrQuit(message->Append(&iid, sizeof(iid)), "Append() failed");
+
+    rloc.Init();
+    rloc.SetJoinerRouterLocator(netif.GetMle().GetRloc16());
+    SuccessOrQuit(message->Append(&rloc, sizeof(rloc)), "Append() failed");
+
+    if (aKek)
+    {
+        kek.Init();
+        kek.SetKek(kKek);
+        SuccessOrQuit(message->Append(&kek, sizeof(kek)), "Append() failed");
+    }
+
+    memset(payload, 0, sizeof(payload));
+    tlv.SetType(MeshCoP::Tlv::kJoinerDtlsEncapsulation);
+    tlv.SetLength(sizeof(payload));
+    SuccessOrQuit(message->Append(&tlv, sizeof(tlv)), "Append() failed");
+    SuccessOrQuit(message->Append(payload, sizeof(payload)), "Append() failed");
+
+    messageInfo.SetPeerAddr(netif.GetMle().GetMeshLocal16());
+    messageInfo.SetPeerPort(kCoapUdpPort);
+    messageInfo.SetInterfaceId(netif.GetInterfaceId());
+
+    SuccessOrQuit(netif.GetCoap().SendMessage(*message, messageInfo), "SendMessage() failed");
+    ProcessTasklets(aInstance);
+}
+
+void TestJoinerRouterBatching(void)
+{
+    Coap::Resource                relayRx(OT_URI_PATH_RELAY_RX, HandleRelayRx, NULL);
+    MeshCoP::JoinerRouter *       joinerRouter;
+    Instance *                    instance = InitInstance(joinerRouter, relayRx);
+    const otJoinerRouterCounters &counters = joinerRouter->GetCounters();
+    const uint8_t                 maxBatch = kRelayBatchSize / kDatagramLength;
+
+    printf("TestJoinerRouterBatching");
+
+    // Without a batching window, every datagram is relayed on its own.
+    joinerRouter->SetRelayBatchWindow(0);
+    ReceiveFromJoiner(*instance, 0, 0);
+    ReceiveFromJoiner(*instance, 0, 1);
+    VerifyOrQuit(sNumRelayRx == 2 && sRelayRx[0].mNumDatagrams == 1 && sRelayRx[1].mNumDatagrams == 1,
+                 "Datagrams batched without a batching window");
+
+    // The datagrams received within the window are relayed together, in a notification per Joiner.
+    joinerRouter->SetRelayBatchWindow(kBatchWindow);
+    sNumRelayRx = 0;
+
+    ReceiveFromJoiner(*instance, 0, 2);
+    AdvanceTime(*instance, kBatchWindow / 2);
+    ReceiveFromJoiner(*instance, 1, 0);
+    ReceiveFromJoiner(*instance, 0, 3);
+    ReceiveFromJoiner(*instance, 0, 4);
+    VerifyOrQuit(sNumRelayRx == 0, "Datagrams relayed before the end of the batching window");
+
+    AdvanceTime(*instance, kBatchWindow / 2);
+    VerifyOrQuit(sNumRelayRx == 1, "Batch not relayed at the end of the batching window");
+    VerifyOrQuit(sRelayRx[0].mJoiner == 0 && sRelayRx[0].mFirstSeq == 2 && sRelayRx[0].mNumDatagrams == 3,
+                 "Unexpected batch");
+
+    AdvanceTime(*instance, kBatchWindow / 2);
+    VerifyOrQuit(sNumRelayRx == 2, "Batch not relayed at the end of the batching window");
+    VerifyOrQuit(sRelayRx[1].mJoiner == 1 && sRelayRx[1].mFirstSeq == 0 && sRelayRx[1].mNumDatagrams == 1,
+                 "Unexpected batch");
+
+    // A batch is relayed as soon as the next datagram would make it too long.
+    sNumRelayRx = 0;
+
+    for (uint8_t seq = 0; seq <= maxBatch; seq++)
+    {
+        ReceiveFromJoiner(*instance, 1, seq);
+    }
+
+    VerifyOrQuit(sNumRelayRx == 1 && sRelayRx[0].mNumDatagrams == maxBatch, "Full batch not relayed");
+
+    AdvanceTime(*instance, kBatchWindow);
+    VerifyOrQuit(sNumRelayRx == 2 && sRelayRx[1].mFirstSeq == maxBatch && sRelayRx[1].mNumDatagrams == 1,
+                 "Batch not relayed at the end of the batching window");
+
+    VerifyOrQuit(counters.mRelayRxMessages == 6 && counters.mRelayRxDatagrams == 7 + maxBatch,
+                 "Unexpected relay counters");
+    VerifyOrQuit(counters.mRelayRxDrops == 0, "Datagrams dropped");
+    VerifyOrQuit(counters.mMaxBatchDelay == kBatchWindow, "Unexpected batch delay");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestJoinerRouterEviction(void)
+{
+    Coap::Resource                relayRx(OT_URI_PATH_RELAY_RX, HandleRelayRx, NULL);
+    MeshCoP::JoinerRouter *       joinerRouter;
+    Instance *                    instance = InitInstance(joinerRouter, relayRx);
+    const otJoinerRouterCounters &counters = joinerRouter->GetCounters();
+
+    printf("TestJoinerRouterEviction");
+
+    joinerRouter->SetRelayBatchWindow(0);
+
+    for (uint8_t joiner = 0; joiner < kMaxJoiners; joiner++)
+    {
+        ReceiveFromJoiner(*instance, joiner, 0);
+    }
+
+    VerifyOrQuit(sNumRelayRx == kMaxJoiners && counters.mActiveJoiners == kMaxJoiners, "Joiners not relayed");
+
+    // Another Joiner is rejected while all the Joiners being relayed wait for their KEK.
+    ReceiveFromJoiner(*instance, kMaxJoiners, 0);
+    VerifyOrQuit(sNumRelayRx == kMaxJoiners && counters.mJoinersRejected == 1, "Joiner not rejected");
+
+    // A Joiner which received its KEK makes room for it.
+    SendRelayTx(*instance, 0, true);
+    VerifyOrQuit(counters.mRelayTxMessages == 1, "Relay Transmit not forwarded");
+
+    ReceiveFromJoiner(*instance, kMaxJoiners, 1);
+    VerifyOrQuit(sNumRelayRx == kMaxJoiners + 1 && sRelayRx[kMaxJoiners].mJoiner == kMaxJoiners,
+                 "Joiner not relayed after another one was entrusted");
+    VerifyOrQuit(counters.mActiveJoiners == kMaxJoiners && counters.mMaxActiveJoiners == kMaxJoiners,
+                 "Unexpected number of active Joiners");
+
+    // The evicted Joiner is rejected in turn.
+    ReceiveFromJoiner(*instance, 0, 1);
+    VerifyOrQuit(sNumRelayRx == kMaxJoiners + 1 && counters.mJoinersRejected == 2, "Evicted Joiner not rejected");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestJoinerRouterTimeout(void)
+{
+    Coap::Resource                relayRx(OT_URI_PATH_RELAY_RX, HandleRelayRx, NULL);
+    MeshCoP::JoinerRouter *       joinerRouter;
+    Instance *                    instance = InitInstance(joinerRouter, relayRx);
+    const otJoinerRouterCounters &counters = joinerRouter->GetCounters();
+    Message *                     datagram;
+    Message *                     messages[kMaxRelayRx];
+    uint8_t                       numMessages = 0;
+
+    printf("TestJoinerRouterTimeout");
+
+    joinerRouter->SetRelayBatchWindow(kBatchWindow);
+
+    ReceiveFromJoiner(*instance, 0, 0);
+    ReceiveFromJoiner(*instance, 1, 0);
+    AdvanceTime(*instance, kJoinerTimeout / 2);
+    ReceiveFromJoiner(*instance, 1, 1);
+    VerifyOrQuit(counters.mActiveJoiners == 2, "Joiner timed out too early");
+
+    // A Joiner times out after it has not been heard from for the timeout, and datagrams from the other one or a
+    // Relay Transmit for it keep it relayed.
+    AdvanceTime(*instance, kJoinerTimeout / 2);
+    VerifyOrQuit(counters.mActiveJoiners == 1, "Joiner did not time out");
+
+    SendRelayTx(*instance, 1, false);
+    AdvanceTime(*instance, kJoinerTimeout - 1);
+    VerifyOrQuit(counters.mActiveJoiners == 1, "Joiner timed out despite a Relay Transmit");
+
+    AdvanceTime(*instance, 1);
+    VerifyOrQuit(counters.mActiveJoiners == 0, "Joiner did not time out");
+    VerifyOrQuit(sNumRelayRx == 3 && counters.mRelayRxDrops == 0, "Datagrams not relayed");
+
+    // A Joiner added while its datagram cannot be relayed still times out.
+    datagram = NewJoinerDatagram(*instance, 2, 0);
+
+    while (numMessages < kMaxRelayRx &&
+           (messages[numMessages] = instance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL)
+    {
+        numMessages++;
+    }
+
+    VerifyOrQuit(numMessages < kMaxRelayRx, "Message pool not exhausted");
+
+    Receive(*instance, *datagram);
+    VerifyOrQuit(counters.mActiveJoiners == 1 && counters.mRelayRxDrops == 1, "Datagram not dropped");
+
+    while (numMessages > 0)
+    {
+        messages[--numMessages]->Free();
+    }
+
+    AdvanceTime(*instance, kJoinerTimeout);
+    VerifyOrQuit(counters.mActiveJoiners == 0, "Joiner with a dropped datagram did not time out");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestJoinerRouterEntrust(void)
+{
+    Coap::Resource                relayRx(OT_URI_PATH_RELAY_RX, HandleRelayRx, NULL);
+    MeshCoP::JoinerRouter *       joinerRouter;
+    Instance *                    instance = InitInstance(joinerRouter, relayRx);
+    const otJoinerRouterCounters &counters = joinerRouter->GetCounters();
+
+    printf("TestJoinerRouterEntrust");
+
+    ReceiveFromJoiner(*instance, 0, 0);
+    ReceiveFromJoiner(*instance, 1, 0);
+
+    // A KEK relayed again for a Joiner replaces its Joiner Entrust that is still waiting.
+    SendRelayTx(*instance, 0, true);
+    SendRelayTx(*instance, 0, true);
+    VerifyOrQuit(counters.mEntrustQueueDepth == 1, "Joiner Entrust queued twice for a Joiner");
+
+    SendRelayTx(*instance, 1, true);
+    VerifyOrQuit(counters.mEntrustQueueDepth == 2 && counters.mMaxEntrustQueueDepth == 2,
+                 "Joiner Entrust not queued for another Joiner");
+    VerifyOrQuit(counters.mRelayTxMessages == 3, "Relay Transmit not forwarded");
+
+    // The Joiner Entrust messages are sent one at a time, the next one once the previous one is acknowledged or its
+    // CoAP transaction times out.
+    AdvanceTime(*instance, kEntrustDelay);
+    VerifyOrQuit(counters.mEntrustQueueDepth == 1, "Joiner Entrust not sent");
+
+    AdvanceTime(*instance, kEntrustTimeout);
+    VerifyOrQuit(counters.mEntrustQueueDepth == 0, "Joiner Entrust not sent");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestJoinerRouterBatching();
+    ot::TestJoinerRouterEviction();
+    ot::TestJoinerRouterTimeout();
+    ot::TestJoinerRouterEntrust();
+
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,301 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/openthread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "meshcop/joiner_table.hpp"
+#include "meshcop/meshcop.hpp"
+
+namespace ot {
+
+enum
+{
+    kNumJoiners        = 10000,
+    kNumBuckets        = 4096,
+    kNumLinearLookups  = 10,
+    kNumSharingJoiners = 300, ///< More Joiners setting the same Bloom filter bit than an 8-bit count can hold.
+};
+
+static MeshCoP::JoinerTable::Entry sEntries[kNumJoiners];
+static uint16_t                    sBuckets[kNumBuckets];
+
+static void GetEui64(uint16_t aIndex, Mac::ExtAddress &aEui64)
+{
+    memset(aEui64.m8, 0, sizeof(aEui64.m8));
+    aEui64.m8[0] = 0x18;
+    aEui64.m8[1] = 0xb4;
+    aEui64.m8[2] = 0x30;
+    aEui64.m8[6] = static_cast<uint8_t>(aIndex >> 8);
+    aEui64.m8[7] = static_cast<uint8_t>(aIndex);
+}
+
+// Computes the Steering Data from scratch, as the Commissioner did on every change.
+static void ComputeSteeringData(MeshCoP::JoinerTable &aTable, MeshCoP::SteeringDataTlv &aSteeringData)
+{
+    Mac::ExtAddress joinerId;
+
+    aSteeringData.Init();
+
+    for (MeshCoP::JoinerTable::Entry *entry = aTable.GetNext(NULL); entry != NULL; entry = aTable.GetNext(entry))
+    {
+        if (entry->mAny)
+        {
+            aSteeringData.SetLength(1);
+            aSteeringData.Set();
+            break;
+        }
+
+        MeshCoP::ComputeJoinerId(entry->mEui64, joinerId);
+        aSteeringData.ComputeBloomFilter(joinerId);
+    }
+}
+
+static void VerifySteeringData(MeshCoP::JoinerTable &aTable)
+{
+    MeshCoP::SteeringDataTlv steeringData;
+    MeshCoP::SteeringDataTlv expected;
+
+    aTable.GetSteeringData(steeringData);
+    ComputeSteeringData(aTable, expected);
+
+    VerifyOrQuit(steeringData.GetLength() == expected.GetLength(), "Wrong Steering Data length");
+    VerifyOrQuit(memcmp(steeringData.GetValue(), expected.GetValue(), expected.GetLength()) == 0,
+                 "Wrong Steering Data");
+}
+
+void TestJoinerTable(void)
+{
+    MeshCoP::JoinerTable         table(sEntries, kNumJoiners, sBuckets, kNumBuckets);
+    MeshCoP::JoinerTable::Entry *entry;
+    MeshCoP::SteeringDataTlv     steeringData;
+    Mac::ExtAddress              eui64;
+    Mac::ExtAddress              joinerId;
+    bool                         changed;
+    uint64_t                     start;
+    uint64_t                     addTime;
+    uint64_t                     lookupTime;
+    uint64_t                     removeTime;
+    uint64_t                     linearTime;
+
+    printf("TestJoinerTable");
+
+    table.GetSteeringData(steeringData);
+    VerifyOrQuit(steeringData.IsCleared(), "Steering Data of an empty table is not cleared");
+
+    // Adding the same Joiner again updates its entry.
+    GetEui64(1, eui64);
+    SuccessOrQuit(table.Add(&eui64, "J01NME", 100, changed), "Add() failed");
+    VerifyOrQuit(changed, "Steering Data did not change");
+    SuccessOrQuit(table.Add(&eui64, "J01NU2", 200, changed), "Add() failed");
+    VerifyOrQuit(!changed && table.GetCount() == 1, "Add() of the same Joiner added an entry");
+    VerifyOrQuit((entry = table.Find(&eui64)) != NULL, "Find() failed");
+    VerifyOrQuit(strcmp(entry->mPsk, "J01NU2") == 0 && entry->mExpirationTime == 200, "Entry was not updated");
+    VerifySteeringData(table);
+
+    // An entry for any Joiner sets all bits, and is only used for Joiners without an entry of their own.
+    SuccessOrQuit(table.Add(NULL, "ANY0NE", 300, changed), "Add() failed");
+    VerifyOrQuit(changed && table.GetCount() == 2, "Add() of any Joiner failed");
+    table.GetSteeringData(steeringData);
+    VerifyOrQuit(steeringData.GetLength() == 1 && steeringData.DoesAllowAny(), "Steering Data does not allow any");
+    MeshCoP::ComputeJoinerId(eui64, joinerId);
+    VerifyOrQuit(table.FindByJoinerId(joinerId) == entry, "FindByJoinerId() did not find the Joiner");
+    GetEui64(2, eui64);
+    MeshCoP::ComputeJoinerId(eui64, joinerId);
+    VerifyOrQuit((entry = table.FindByJoinerId(joinerId)) != NULL && entry->mAny, "FindByJoinerId() did not find any");
+    VerifyOrQuit(table.Find(&eui64) == NULL, "Find() found an unknown Joiner");
+    VerifyOrQuit(table.Remove(*table.Find(NULL)), "Steering Data did not change");
+    VerifyOrQuit(table.FindByJoinerId(joinerId) == NULL, "FindByJoinerId() found an unknown Joiner");
+    VerifySteeringData(table);
+
+    table.Clear();
+    VerifyOrQuit(table.GetCount() == 0 && table.GetNext(NULL) == NULL, "Clear() failed");
+
+    // Fill the table.
+    start = testGetNowUs();
+
+    for (uint16_t i = 0; i < kNumJoiners; i++)
+    {
+        GetEui64(i, eui64);
+        SuccessOrQuit(table.Add(&eui64, "J01NME", i, changed), "Add() failed");
+    }
+
+    addTime = testGetNowUs() - start;
+
+    VerifyOrQuit(table.GetCount() == kNumJoiners, "Wrong number of entries");
+    GetEui64(kNumJoiners, eui64);
+    VerifyOrQuit(table.Add(&eui64, "J01NME", 0, changed) == OT_ERROR_NO_BUFS, "Add() to a full table succeeded");
+    VerifySteeringData(table);
+
+    // Look up every Joiner by its Joiner ID, as done for relayed messages.
+    start = testGetNowUs();
+
+    for (uint16_t i = 0; i < kNumJoiners; i++)
+    {
+        GetEui64(i, eui64);
+        MeshCoP::ComputeJoinerId(eui64, joinerId);
+        entry = table.FindByJoinerId(joinerId);
+        VerifyOrQuit(entry != NULL && entry->mEui64 == eui64, "FindByJoinerId() failed");
+    }
+
+    lookupTime = testGetNowUs() - start;
+
+    // For comparison, look up a few Joiners computing the Joiner ID of every entry.
+    start = testGetNowUs();
+
+    for (uint16_t i = 0; i < kNumLinearLookups; i++)
+    {
+        GetEui64(kNumJoiners - 1 - i, eui64);
+        MeshCoP::ComputeJoinerId(eui64, joinerId);
+
+        for (entry = table.GetNext(NULL); entry != NULL; entry = table.GetNext(entry))
+        {
+            Mac::ExtAddress entryJoinerId;
+
+            MeshCoP::ComputeJoinerId(entry->mEui64, entryJoinerId);
+
+            if (entryJoinerId == joinerId)
+            {
+                break;
+            }
+        }
+
+        VerifyOrQuit(entry != NULL, "Linear lookup failed");
+    }
+
+    linearTime = testGetNowUs() - start;
+
+    // Remove every other Joiner, then the rest.
+    start = testGetNowUs();
+
+    for (uint16_t i = 0; i < kNumJoiners; i += 2)
+    {
+        GetEui64(i, eui64);
+        VerifyOrQuit((entry = table.Find(&eui64)) != NULL, "Find() failed");
+        table.Remove(*entry);
+    }
+
+    removeTime = testGetNowUs() - start;
+
+    VerifyOrQuit(table.GetCount() == kNumJoiners / 2, "Wrong number of entries");
+    GetEui64(0, eui64);
+    VerifyOrQuit(table.Find(&eui64) == NULL, "Removed Joiner was found");
+    VerifySteeringData(table);
+
+    start = testGetNowUs();
+
+    for (uint16_t i = 1; i < kNumJoiners; i += 2)
+    {
+        GetEui64(i, eui64);
+        VerifyOrQuit((entry = table.Find(&eui64)) != NULL, "Find() failed");
+        table.Remove(*entry);
+    }
+
+    removeTime += testGetNowUs() - start;
+
+    VerifyOrQuit(table.GetCount() == 0 && table.GetNext(NULL) == NULL, "Entries left after removing all");
+    table.GetSteeringData(steeringData);
+    VerifyOrQuit(steeringData.IsCleared(), "Steering Data not cleared after removing all");
+
+    printf(" -- PASS (%u joiners: %u ns add, %u ns lookup vs %u ns linear, %u ns remove)\n", kNumJoiners,
+           static_cast<unsigned int>(addTime * 1000 / kNumJoiners),
+           static_cast<unsigned int>(lookupTime * 1000 / kNumJoiners),
+           static_cast<unsigned int>(linearTime * 1000 / kNumLinearLookups),
+           static_cast<unsigned int>(removeTime * 1000 / kNumJoiners));
+}
+
+void TestJoinerTableSharedBit(void)
+{
+    MeshCoP::JoinerTable     table(sEntries, kNumJoiners, sBuckets, kNumBuckets);
+    MeshCoP::SteeringDataTlv steeringData;
+    Mac::ExtAddress          eui64;
+    Mac::ExtAddress          joinerId;
+    uint16_t                 indexes[kNumSharingJoiners];
+    uint16_t                 numIndexes = 0;
+    bool                     changed;
+
+    printf("TestJoinerTableSharedBit");
+
+    // Pick Joiners that all set bit 0 of the Bloom filter.
+    steeringData.Init();
+
+    for (uint16_t i = 0; numIndexes < kNumSharingJoiners; i++)
+    {
+        uint8_t bit1;
+        uint8_t bit2;
+
+        GetEui64(i, eui64);
+        MeshCoP::ComputeJoinerId(eui64, joinerId);
+        steeringData.ComputeBloomFilterBits(joinerId, bit1, bit2);
+
+        if (bit1 == 0 || bit2 == 0)
+        {
+            indexes[numIndexes++] = i;
+        }
+    }
+
+    for (uint16_t i = 0; i < numIndexes; i++)
+    {
+        GetEui64(indexes[i], eui64);
+        SuccessOrQuit(table.Add(&eui64, "J01NME", 0, changed), "Add() failed");
+    }
+
+    VerifySteeringData(table);
+
+    // The bit is cleared once the last of the Joiners setting it is removed.
+    for (uint16_t i = 0; i < numIndexes; i++)
+    {
+        GetEui64(indexes[i], eui64);
+        table.Remove(*table.Find(&eui64));
+        VerifySteeringData(table);
+    }
+
+    table.GetSteeringData(steeringData);
+    VerifyOrQuit(steeringData.IsCleared(), "Steering Data not cleared after removing all");
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestJoinerTable();
+    ot::TestJoinerTableSharedBit();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,175 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/openthread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "crypto/hmac_sha256.hpp"
+#include "thread/key_manager.hpp"
+
+namespace ot {
+
+enum
+{
+    kNumLookups = 1000,
+};
+
+static const otMasterKey kMasterKey = {
+    {0x10, 0x32, 0x54, 0x76, 0x98, 0xba, 0xdc, 0xfe, 0xef, 0xcd, 0xab, 0x89, 0x67, 0x45, 0x23, 0x01}};
+
+static void ComputeExpectedKey(const otMasterKey &aMasterKey, uint32_t aKeySequence, uint8_t *aKey)
+{
+    static const uint8_t kThreadString[] = {'T', 'h', 'r', 'e', 'a', 'd'};
+    Crypto::HmacSha256   hmac;
+    uint8_t              keySequenceBytes[4];
+
+    keySequenceBytes[0] = static_cast<uint8_t>(aKeySequence >> 24);
+    keySequenceBytes[1] = static_cast<uint8_t>(aKeySequence >> 16);
+    keySequenceBytes[2] = static_cast<uint8_t>(aKeySequence >> 8);
+    keySequenceBytes[3] = static_cast<uint8_t>(aKeySequence);
+
+    hmac.Start(aMasterKey.m8, sizeof(aMasterKey.m8));
+    hmac.Update(keySequenceBytes, sizeof(keySequenceBytes));
+    hmac.Update(kThreadString, sizeof(kThreadString));
+    hmac.Finish(aKey);
+}
+
+static void VerifyTemporaryKeys(KeyManager &aKeyManager, const otMasterKey &aMasterKey, uint32_t aKeySequence)
+{
+    uint8_t expected[Crypto::HmacSha256::kHashSize];
+
+    ComputeExpectedKey(aMasterKey, aKeySequence, expected);
+
+    VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMleKey(aKeySequence), expected, 16) == 0, "Wrong temporary MLE key");
+    VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMacKey(aKeySequence), expected + 16, 16) == 0,
+                 "Wrong temporary MAC key");
+}
+
+void TestKeyManagerKeyCache(void)
+{
+    Instance *                instance = testInitInstance();
+    KeyManager &              keyManager(instance->GetThreadNetif().GetKeyManager());
+    const otKeyCacheCounters &counters  = *otThreadGetKeyCacheCounters(instance);
+    otMasterKey               masterKey = kMasterKey;
+    uint8_t                   expected[Crypto::HmacSha256::kHashSize];
+    uint32_t                  derivations;
+    uint32_t                  hits;
+    uint64_t                  start;
+    uint64_t                  cachedTime;
+    uint64_t                  uncachedTime;
+
+    printf("TestKeyManagerKeyCache");
+
+    SuccessOrQuit(keyManager.SetMasterKey(kMasterKey), "SetMasterKey() failed");
+    keyManager.SetCurrentKeySequence(10);
+
+    // The keys of neighboring key sequences are derived once, then served from the cache.
+    derivations = counters.mDerivations;
+    hits        = counters.mHits;
+
+    for (int i = 0; i < 3; i++)
+    {
+        VerifyTemporaryKeys(keyManager, kMasterKey, 9);
+        VerifyTemporaryKeys(keyManager, kMasterKey, 11);
+    }
+
+    VerifyOrQuit(counters.mDerivations == derivations + 2, "Cached keys were derived again");
+    VerifyOrQuit(counters.mHits == hits + 10, "Unexpected number of cache hits");
+
+    // Keys outside of the window are derived on each use.
+    derivations = counters.mDerivations;
+    VerifyTemporaryKeys(keyManager, kMasterKey, 10 + OPENTHREAD_CONFIG_KEY_CACHE_WINDOW + 1);
+    VerifyTemporaryKeys(keyManager, kMasterKey, 10 - OPENTHREAD_CONFIG_KEY_CACHE_WINDOW - 1);
+    VerifyOrQuit(counters.mDerivations == derivations + 4, "Key outside of the window was cached");
+    VerifyTemporaryKeys(keyManager, kMasterKey, 9);
+    VerifyTemporaryKeys(keyManager, kMasterKey, 11);
+    VerifyOrQuit(counters.mDerivations == derivations + 4, "Key outside of the window evicted a key");
+
+    // A key rotation takes the next key from the cache, and keeps the previous one.
+    derivations = counters.mDerivations;
+    keyManager.SetCurrentKeySequence(11);
+    VerifyOrQuit(keyManager.GetCurrentKeySequence() == 11, "SetCurrentKeySequence() failed");
+    ComputeExpectedKey(kMasterKey, 11, expected);
+    VerifyOrQuit(memcmp(keyManager.GetCurrentMleKey(), expected, 16) == 0, "Wrong current MLE key");
+    VerifyOrQuit(memcmp(keyManager.GetCurrentMacKey(), expected + 16, 16) == 0, "Wrong current MAC key");
+    VerifyTemporaryKeys(keyManager, kMasterKey, 10);
+    VerifyOrQuit(counters.mDerivations == derivations, "Key rotation derived a cached key");
+    VerifyTemporaryKeys(keyManager, kMasterKey, 12);
+    VerifyOrQuit(counters.mDerivations == derivations + 1, "Next key was not derived");
+
+    // A new master key invalidates the cache.
+    masterKey.m8[0]++;
+    SuccessOrQuit(keyManager.SetMasterKey(masterKey), "SetMasterKey() failed");
+    keyManager.SetCurrentKeySequence(11);
+    VerifyTemporaryKeys(keyManager, masterKey, 10);
+    VerifyTemporaryKeys(keyManager, masterKey, 12);
+
+    // Compare the cost of a cached and an uncached temporary key.
+    start = testGetNowUs();
+
+    for (int i = 0; i < kNumLookups; i++)
+    {
+        keyManager.GetTemporaryMacKey(12);
+    }
+
+    cachedTime = testGetNowUs() - start;
+    start      = testGetNowUs();
+
+    for (int i = 0; i < kNumLookups; i++)
+    {
+        keyManager.GetTemporaryMacKey(20);
+    }
+
+    uncachedTime = testGetNowUs() - start;
+
+    printf(" -- PASS (%u derivations, %u cache hits, %u ns cached vs %u ns derived per key)\n",
+           counters.mDerivations, counters.mHits,
+           static_cast<unsigned int>(cachedTime * 1000 / kNumLookups),
+           static_cast<unsigned int>(uncachedTime * 1000 / kNumLookups));
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestKeyManagerKeyCache();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
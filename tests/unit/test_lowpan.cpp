@@ -28,6 +28,8 @@
 
 #include "test_lowpan.hpp"
 
+#include <time.h>
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
@@ -1743,6 +1745,133 @@ static void TestErrorReservedNhc6(void)
     Test(testVector, false, true);
 }
 
+/***************************************************************************************************
+ * @section Compression cache tests.
+ **************************************************************************************************/
+
+static void SetupUdpFlowVector(TestIphcVector &aVector, uint16_t aChecksum)
+{
+    uint8_t iphc[] = {0x7e, 0x33, 0xf3, 0x0f, 0x00, 0x00};
+
+    iphc[4] = aChecksum >> 8;
+    iphc[5] = aChecksum & 0xff;
+
+    aVector.SetMacSource(sTestMacSourceDefaultLong);
+    aVector.SetMacDestination(sTestMacDestinationDefaultLong);
+    aVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 64, "fe80::200:5eef:1022:1100",
+                        "fe80::200:5eef:10aa:bbcc");
+    aVector.SetUDPHeader(61616, 61631, sizeof(sTestPayloadDefault) + 8, aChecksum);
+    aVector.SetIphcHeader(iphc, sizeof(iphc));
+    aVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    aVector.SetPayloadOffset(48);
+    aVector.SetError(OT_ERROR_NONE);
+}
+
+static void TestCompressCache(void)
+{
+    TestIphcVector testVector1("Compression cache - new flow");
+    TestIphcVector testVector2("Compression cache - cached flow, other checksum");
+    TestIphcVector testVector3("Compression cache - other hop limit");
+
+    sLowpan->ClearCompressCache();
+
+    SetupUdpFlowVector(testVector1, 0xface);
+    Test(testVector1, true, false);
+
+    // The same flow is compressed from the cache, with the UDP checksum of the message.
+    SetupUdpFlowVector(testVector2, 0xbeef);
+    Test(testVector2, true, false);
+    Test(testVector1, true, false);
+
+    // A change in any of the IPv6 header fields is a different flow.
+    SetupUdpFlowVector(testVector3, 0xface);
+    testVector3.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 255,
+                            "fe80::200:5eef:1022:1100", "fe80::200:5eef:10aa:bbcc");
+    {
+        uint8_t iphc[] = {0x7f, 0x33, 0xf3, 0x0f, 0xfa, 0xce};
+        testVector3.SetIphcHeader(iphc, sizeof(iphc));
+    }
+    Test(testVector3, true, false);
+    Test(testVector1, true, false);
+
+    // Stateful compression from the cache.
+    TestStatefulSource64bitDestination64bitContext1();
+    TestStatefulSource64bitDestination64bitContext1();
+    TestMulticast8bitAddress();
+    TestMulticast8bitAddress();
+}
+
+static uint32_t BenchmarkCompress(TestIphcVector &aVector, uint32_t aFrames, bool aUseCache)
+{
+    Message *message;
+    uint8_t  result[128];
+    clock_t  start;
+    clock_t  elapsed;
+
+    VerifyOrQuit((message = sInstance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                 "6lo: Ip6::NewMessage failed");
+    aVector.GetUncompressedStream(*message);
+
+    sLowpan->ClearCompressCache();
+    start = clock();
+
+    for (uint32_t i = 0; i < aFrames; i++)
+    {
+        if (!aUseCache)
+        {
+            sLowpan->ClearCompressCache();
+        }
+
+        message->SetOffset(0);
+        VerifyOrQuit(sLowpan->Compress(*message, aVector.mMacSource, aVector.mMacDestination, result) ==
+                         aVector.mIphcHeader.mLength,
+                     "6lo: Lowpan::Compress failed");
+    }
+
+    elapsed = clock() - start;
+    message->Free();
+
+    return (elapsed > 0) ? static_cast<uint32_t>((static_cast<uint64_t>(aFrames) * CLOCKS_PER_SEC) / elapsed) : 0;
+}
+
+static void TestCompressBenchmark(void)
+{
+    enum
+    {
+        kNumFrames = 200000,
+    };
+
+    TestIphcVector testVector("Compression benchmark - UDP flow to a context prefix");
+    uint32_t       withoutCache;
+    uint32_t       withCache;
+
+    SetupUdpFlowVector(testVector, 0xface);
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 64,
+                           "2001:2:0:1::200:5eef:1022:1100", "2001:2:0:1::1234");
+
+    // Determine the expected length from a regular compression.
+    {
+        Message *message;
+        uint8_t  result[128];
+
+        VerifyOrQuit((message = sInstance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                     "6lo: Ip6::NewMessage failed");
+        testVector.GetUncompressedStream(*message);
+        sLowpan->ClearCompressCache();
+        testVector.mIphcHeader.mLength = static_cast<uint16_t>(
+            sLowpan->Compress(*message, testVector.mMacSource, testVector.mMacDestination, result));
+        message->Free();
+    }
+
+    withoutCache = BenchmarkCompress(testVector, kNumFrames, false);
+    withCache    = BenchmarkCompress(testVector, kNumFrames, true);
+
+    printf("\n=== Test name: %s ===\n\n", testVector.mTestName);
+    printf("Compressed header length ---- %d\n", testVector.mIphcHeader.mLength);
+    printf("Frames/sec without cache ---- %u\n", withoutCache);
+    printf("Frames/sec with cache ------- %u\n\n", withCache);
+}
+
 /***************************************************************************************************
  * @section Main test.
  **************************************************************************************************/
@@ -1837,6 +1966,10 @@ void TestLowpanIphc(void)
     TestErrorReservedNhc5();
     TestErrorReservedNhc6();
 
+    // Compression cache tests.
+    TestCompressCache();
+    TestCompressBenchmark();
+
     testFreeInstance(sInstance);
 }
 
@@ -0,0 +1,133 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/openthread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+
+namespace ot {
+
+static void PrintUsage(const char *aName, const otMemoryUsage &aUsage)
+{
+    printf("  %-12s %5u / %5u x %u bytes\n", aName, aUsage.mUsedEntries, aUsage.mTotalEntries, aUsage.mEntrySize);
+}
+
+void TestMemoryFootprint(void)
+{
+    const otMemoryFootprintEntry *footprint;
+    uint8_t                       numEntries;
+    uint32_t                      total  = 0;
+    uint32_t                      parent = 0;
+    uint32_t                      parts  = 0;
+
+    footprint = otInstanceGetFootprint(&numEntries);
+    VerifyOrQuit(footprint != NULL && numEntries > 0, "otInstanceGetFootprint() failed\n");
+    VerifyOrQuit(footprint[0].mDepth == 0, "First entry is not an instance member\n");
+
+    printf("Instance footprint (%u bytes):\n", static_cast<unsigned int>(sizeof(Instance)));
+
+    for (uint8_t i = 0; i < numEntries; i++)
+    {
+        printf("  %s%-20s %6u\n", footprint[i].mDepth ? "  " : "", footprint[i].mName, footprint[i].mSize);
+
+        if (footprint[i].mDepth == 0)
+        {
+            VerifyOrQuit(parts <= parent, "Parts are larger than their subsystem\n");
+            total += footprint[i].mSize;
+            parent = footprint[i].mSize;
+            parts  = 0;
+        }
+        else
+        {
+            parts += footprint[i].mSize;
+        }
+    }
+
+    VerifyOrQuit(parts <= parent, "Parts are larger than their subsystem\n");
+    VerifyOrQuit(total <= sizeof(Instance), "Subsystems are larger than the instance\n");
+
+    printf("TestMemoryFootprint passed\n");
+}
+
+void TestMemoryReport(void)
+{
+    Instance *     instance = static_cast<Instance *>(testInitInstance());
+    otMemoryReport report;
+    Message *      message;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    otInstanceGetMemoryReport(instance, &report);
+
+    printf("Memory report:\n");
+    PrintUsage("msgbuf", report.mMessageBuffers);
+    PrintUsage("heap", report.mHeap);
+    PrintUsage("child", report.mChildTable);
+    PrintUsage("eidcache", report.mEidCache);
+    PrintUsage("6locache", report.mLowpanCompressCache);
+
+    VerifyOrQuit(report.mInstanceSize == sizeof(Instance), "Instance size is incorrect\n");
+    VerifyOrQuit(report.mInstancePadding < report.mInstanceSize, "Instance padding is incorrect\n");
+    VerifyOrQuit(report.mMessageBuffers.mTotalEntries == OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+                 "Message buffer count is incorrect\n");
+    VerifyOrQuit(report.mMessageBuffers.mUsedEntries == 0, "Message buffers in use after init\n");
+    VerifyOrQuit(report.mChildTable.mTotalEntries == OPENTHREAD_CONFIG_MAX_CHILDREN, "Child table size is incorrect\n");
+    VerifyOrQuit(report.mChildTable.mUsedEntries == 0, "Child table entries in use after init\n");
+    VerifyOrQuit(report.mEidCache.mTotalEntries == OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES,
+                 "EID cache size is incorrect\n");
+    VerifyOrQuit(report.mHeap.mUsedEntries <= report.mHeap.mTotalEntries, "Heap usage is incorrect\n");
+
+    message = instance->GetMessagePool().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+
+    otInstanceGetMemoryReport(instance, &report);
+    VerifyOrQuit(report.mMessageBuffers.mUsedEntries == 1, "Message buffer usage is incorrect\n");
+
+    message->Free();
+
+    printf("TestMemoryReport passed\n");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestMemoryFootprint();
+    ot::TestMemoryReport();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
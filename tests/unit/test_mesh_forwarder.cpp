@@ -0,0 +1,374 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "mac/mac_frame.hpp"
+#include "thread/thread_netif.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+enum
+{
+    kMaxTransmissions = 32,
+};
+
+// Number of queued messages per priority level, chosen to exceed the quantum of the high and medium levels.
+static const uint8_t kNumMessages[Message::kNumPriorities] = {9, 5, 2, 2};
+
+static uint8_t      sRadioPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame sRadioFrame;
+static bool         sTransmitPending;
+static uint8_t      sTxPriorities[kMaxTransmissions];
+static uint16_t     sNumTx;
+static uint32_t     sNow;
+
+static otRadioFrame *testGetTransmitBuffer(otInstance *)
+{
+    return &sRadioFrame;
+}
+
+// Records the priority carried in the last payload byte of each transmitted frame.
+static otError testTransmit(otInstance *)
+{
+    const Mac::Frame &frame = *static_cast<const Mac::Frame *>(&sRadioFrame);
+
+    VerifyOrQuit(!sTransmitPending, "Transmit() while a transmission is in progress\n");
+    VerifyOrQuit(sNumTx < kMaxTransmissions, "Too many transmissions\n");
+
+    sTxPriorities[sNumTx++] = frame.GetPayload()[frame.GetPayloadLength() - 1];
+    sTransmitPending        = true;
+
+    return OT_ERROR_NONE;
+}
+
+static uint32_t testGetNow(void)
+{
+    return sNow;
+}
+
+static void ProcessTasklets(Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance))
+    {
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+static Instance *InitInstance(void)
+{
+    Instance *instance;
+
+    testPlatResetToDefaults();
+    g_testPlatRadioCaps              = OT_RADIO_CAPS_CSMA_BACKOFF;
+    g_testPlatRadioGetTransmitBuffer = testGetTransmitBuffer;
+    g_testPlatRadioTransmit          = testTransmit;
+    g_testPlatAlarmGetNow            = testGetNow;
+
+    memset(&sRadioFrame, 0, sizeof(sRadioFrame));
+    sRadioFrame.mPsdu = sRadioPsdu;
+    sTransmitPending  = false;
+    sNumTx            = 0;
+    sNow              = 1000;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "otIp6SetEnabled() failed\n");
+    ProcessTasklets(*instance);
+
+    return instance;
+}
+
+// Queues a link-local multicast UDP message whose payload is @p aLength bytes of @p aMarker, its priority by default
+// (sent without link security, so that the payload can be read from the transmitted frames).
+static void SendMessage(Instance &      aInstance,
+                        Ip6::UdpSocket &aSocket,
+                        uint8_t         aPriority,
+                        uint8_t         aMarker,
+                        uint16_t        aLength)
+{
+    ThreadNetif &    netif = aInstance.GetThreadNetif();
+    Message *        message;
+    Ip6::MessageInfo messageInfo;
+
+    message = aSocket.NewMessage(0);
+    VerifyOrQuit(message != NULL, "NewMessage() failed\n");
+    SuccessOrQuit(message->SetPriority(aPriority), "SetPriority() failed\n");
+    message->SetLinkSecurityEnabled(false);
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        SuccessOrQuit(message->Append(&aMarker, sizeof(aMarker)), "Append() failed\n");
+    }
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString("ff02::1"), "FromString() failed\n");
+    messageInfo.mPeerPort = 1234;
+    messageInfo.SetInterfaceId(netif.GetInterfaceId());
+    SuccessOrQuit(aSocket.SendTo(*message, messageInfo), "SendTo() failed\n");
+}
+
+static void SendMessage(Instance &aInstance, Ip6::UdpSocket &aSocket, uint8_t aPriority)
+{
+    SendMessage(aInstance, aSocket, aPriority, aPriority, 1);
+}
+
+// Completes transmissions until the send queue is empty.
+static void TransmitAll(Instance &aInstance)
+{
+    ProcessTasklets(aInstance);
+
+    while (sTransmitPending)
+    {
+        sTransmitPending = false;
+        otPlatRadioTxDone(&aInstance, &sRadioFrame, NULL, OT_ERROR_NONE);
+        ProcessTasklets(aInstance);
+    }
+}
+
+void TestSendQueueRoundRobin(void)
+{
+    Instance *     instance = InitInstance();
+    Ip6::UdpSocket socket(instance->GetThreadNetif().GetIp6().GetUdp());
+    uint8_t        remaining[Message::kNumPriorities];
+    uint8_t        deficits[Message::kNumPriorities];
+    uint16_t       numTx = 0;
+    uint16_t       total = 0;
+
+    SuccessOrQuit(socket.Open(NULL, NULL), "Open() failed\n");
+
+    // Queue the messages from lowest to highest priority, so that the queue order alone does not explain the result.
+    for (uint8_t priority = Message::kNumPriorities; priority-- > 0;)
+    {
+        for (uint8_t i = 0; i < kNumMessages[priority]; i++)
+        {
+            SendMessage(*instance, socket, priority);
+        }
+
+        total += kNumMessages[priority];
+    }
+
+    TransmitAll(*instance);
+    VerifyOrQuit(sNumTx == total, "Not all messages were sent\n");
+
+    // In every round, each priority level sends up to 1, 2, 4 or 8 frames (from very low to high priority).
+    memcpy(remaining, kNumMessages, sizeof(remaining));
+    memset(deficits, 0, sizeof(deficits));
+
+    while (numTx < total)
+    {
+        uint8_t priority;
+
+        for (priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            if (deficits[priority] > 0 && remaining[priority] > 0)
+            {
+                break;
+            }
+        }
+
+        if (priority == Message::kNumPriorities)
+        {
+            for (priority = 0; priority < Message::kNumPriorities; priority++)
+            {
+                deficits[priority] = static_cast<uint8_t>(1 << (Message::kNumPriorities - 1 - priority));
+            }
+
+            continue;
+        }
+
+        VerifyOrQuit(sTxPriorities[numTx] == priority, "Messages were not sent in deficit round-robin order\n");
+
+        deficits[priority]--;
+        remaining[priority]--;
+        numTx++;
+    }
+
+    socket.Close();
+    testFreeInstance(instance);
+}
+
+void TestSendQueueDeadline(void)
+{
+    Instance *                 instance      = InitInstance();
+    MeshForwarder &            meshForwarder = instance->GetThreadNetif().GetMeshForwarder();
+    Ip6::UdpSocket             socket(instance->GetThreadNetif().GetIp6().GetUdp());
+    const otIpCounters &       ipCounters = meshForwarder.GetCounters();
+    const otSendQueueCounters &counters   = meshForwarder.GetSendQueueCounters();
+
+    SuccessOrQuit(socket.Open(NULL, NULL), "Open() failed\n");
+
+    // No message is ever dropped by default.
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        SendMessage(*instance, socket, priority);
+    }
+
+    ProcessTasklets(*instance);
+    sNow += 3600000;
+    TransmitAll(*instance);
+    VerifyOrQuit(sNumTx == Message::kNumPriorities, "Message dropped without a deadline\n");
+
+    // Low priority messages are dropped after waiting longer than their deadline.
+    meshForwarder.SetSendQueueDeadline(Message::kPriorityLow, 100);
+    sNumTx = 0;
+
+    SendMessage(*instance, socket, Message::kPriorityHigh);
+    SendMessage(*instance, socket, Message::kPriorityLow);
+    SendMessage(*instance, socket, Message::kPriorityLow);
+    SendMessage(*instance, socket, Message::kPriorityVeryLow);
+
+    ProcessTasklets(*instance);
+    VerifyOrQuit(sNumTx == 1 && sTxPriorities[0] == Message::kPriorityHigh, "High priority message not sent first\n");
+
+    sNow += 100;
+    TransmitAll(*instance);
+    VerifyOrQuit(sNumTx == 4 && sTxPriorities[1] == Message::kPriorityLow && sTxPriorities[2] == Message::kPriorityLow,
+                 "Message dropped before its deadline\n");
+
+    sNumTx = 0;
+
+    SendMessage(*instance, socket, Message::kPriorityHigh);
+    SendMessage(*instance, socket, Message::kPriorityLow);
+    SendMessage(*instance, socket, Message::kPriorityLow);
+    SendMessage(*instance, socket, Message::kPriorityVeryLow);
+
+    ProcessTasklets(*instance);
+    sNow += 101;
+    TransmitAll(*instance);
+
+    VerifyOrQuit(sNumTx == 2 && sTxPriorities[0] == Message::kPriorityHigh &&
+                     sTxPriorities[1] == Message::kPriorityVeryLow,
+                 "Stale messages were sent\n");
+    VerifyOrQuit(counters.mStaleDrops[Message::kPriorityLow] == 2, "Stale drops not counted\n");
+    VerifyOrQuit(ipCounters.mTxFailure == 2, "Stale drops not counted as transmit failures\n");
+
+    socket.Close();
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX > 1
+void TestConcurrentFragmentedTx(void)
+{
+    enum
+    {
+        kNumFragmented     = OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX + 1,
+        kFragmentedLength  = 250,
+        kSingleFrameLength = 90, // Longer than a frame before compression, but sent in a single frame.
+        kSingleFrameMarker = 0x55,
+    };
+
+    Instance *     instance = InitInstance();
+    Ip6::UdpSocket socket(instance->GetThreadNetif().GetIp6().GetUdp());
+    int            lastFrame[kNumFragmented];
+    int            firstCompleted = kMaxTransmissions;
+    int            lastStarted    = -1;
+
+    SuccessOrQuit(socket.Open(NULL, NULL), "Open() failed\n");
+
+    // One more fragmented message than may be in progress at the same time, and then a message which fits in a single
+    // frame once compressed.
+    for (uint8_t i = 0; i < kNumFragmented; i++)
+    {
+        SendMessage(*instance, socket, Message::kPriorityHigh, i, kFragmentedLength);
+    }
+
+    SendMessage(*instance, socket, Message::kPriorityHigh, kSingleFrameMarker, kSingleFrameLength);
+
+    TransmitAll(*instance);
+
+    // The first frames of the messages in progress are interleaved, and the single frame message is not held back.
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX; i++)
+    {
+        VerifyOrQuit(sTxPriorities[i] == i, "Fragmented messages were not interleaved\n");
+    }
+
+    VerifyOrQuit(sTxPriorities[OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX] == kSingleFrameMarker,
+                 "Message sent in a single frame was held back\n");
+
+    // The last fragmented message only starts once another one has completed.
+    for (uint8_t i = 0; i < kNumFragmented; i++)
+    {
+        lastFrame[i] = -1;
+    }
+
+    for (int frame = 0; frame < sNumTx; frame++)
+    {
+        if (sTxPriorities[frame] < kNumFragmented)
+        {
+            lastFrame[sTxPriorities[frame]] = frame;
+        }
+
+        if (sTxPriorities[frame] == kNumFragmented - 1 && lastStarted < 0)
+        {
+            lastStarted = frame;
+        }
+    }
+
+    for (uint8_t i = 0; i < kNumFragmented - 1; i++)
+    {
+        VerifyOrQuit(lastFrame[i] > static_cast<int>(i), "Message was not fragmented\n");
+
+        if (lastFrame[i] < firstCompleted)
+        {
+            firstCompleted = lastFrame[i];
+        }
+    }
+
+    VerifyOrQuit(lastStarted > firstCompleted, "Too many fragmented messages in progress\n");
+
+    socket.Close();
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX > 1
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestSendQueueRoundRobin();
+    ot::TestSendQueueDeadline();
+#if OPENTHREAD_CONFIG_MAX_CONCURRENT_FRAGMENTED_TX > 1
+    ot::TestConcurrentFragmentedTx();
+#endif
+
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
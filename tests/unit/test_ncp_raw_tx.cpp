@@ -0,0 +1,366 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/link.h>
+#include <openthread/link_raw.h>
+#include <openthread/ncp.h>
+#include <openthread/platform/uart.h>
+
+#include "test_util.h"
+#include "ncp/hdlc.hpp"
+#include "ncp/spinel.h"
+#include "posix/simulation/simulation.h"
+
+#if OPENTHREAD_ENABLE_RAW_LINK_API
+
+enum
+{
+    kChannel      = 11,
+    kFrameLength  = 100,
+    kNumFrames    = 500,
+    kMaxDepth     = OPENTHREAD_CONFIG_NCP_RAW_TX_QUEUE_SIZE + 1,
+    kMaxSpinelTid = 15,
+};
+
+// One-way latency of the host link (e.g. bus transfer and driver scheduling) and the step of the host loop.
+static const uint64_t kHostLatency = 1000;
+static const uint64_t kHostStep    = 50;
+static const uint64_t kUsPerSecond = 1000000;
+
+/**
+ * This class models the host side of the spinel link to the RCP: frames written in either direction are delivered
+ * `kHostLatency` after being written.
+ *
+ */
+class Host
+{
+public:
+    Host(void)
+        : mDecoder(mDecodeBuffer, sizeof(mDecodeBuffer), &Host::HandleFrame, &Host::HandleError, this)
+        , mToRcpHead(0)
+        , mToRcpTail(0)
+        , mToHostHead(0)
+        , mToHostTail(0)
+        , mSendDonePending(false)
+    {
+    }
+
+    void SendRawFrame(uint8_t aTid, uint8_t aSequence)
+    {
+        uint8_t        psdu[kFrameLength];
+        uint8_t        spinelFrame[kFrameLength + 16];
+        spinel_ssize_t length;
+        ToRcpEntry &   entry = mToRcp[mToRcpTail++ % kQueueSize];
+        HdlcBuffer     hdlc(entry.mBuffer, sizeof(entry.mBuffer));
+
+        // Broadcast data frame without ACK request.
+        memset(psdu, aSequence, sizeof(psdu));
+        psdu[0] = 0x41;
+        psdu[1] = 0xc8;
+        psdu[2] = aSequence;
+        psdu[3] = 0xff;
+        psdu[4] = 0xff;
+        psdu[5] = 0xff;
+        psdu[6] = 0xff;
+
+        length = spinel_datatype_pack(spinelFrame, sizeof(spinelFrame),
+                                      SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_UINT8_S,
+                                      SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | aTid, SPINEL_CMD_PROP_VALUE_SET,
+                                      SPINEL_PROP_STREAM_RAW, psdu, static_cast<uint32_t>(sizeof(psdu)), kChannel);
+        VerifyOrQuit(length > 0, "Failed to pack the spinel frame");
+
+        SuccessOrQuit(mEncoder.Init(hdlc), "Hdlc::Encoder::Init() failed");
+        SuccessOrQuit(mEncoder.Encode(spinelFrame, static_cast<uint16_t>(length), hdlc), "Hdlc::Encoder::Encode() failed");
+        SuccessOrQuit(mEncoder.Finalize(hdlc), "Hdlc::Encoder::Finalize() failed");
+
+        entry.mLength      = hdlc.GetLength();
+        entry.mDeliverTime = simulationGetNow() + kHostLatency;
+    }
+
+    void HandleUartSend(const uint8_t *aBuf, uint16_t aLength)
+    {
+        mDecoder.Decode(aBuf, aLength);
+        mSendDonePending = true;
+    }
+
+    // Delivers the frames that reached the RCP and returns the number of transmit statuses that reached the host.
+    uint16_t Process(uint8_t *aTids, spinel_status_t *aStatuses)
+    {
+        uint16_t count = 0;
+
+        if (mSendDonePending)
+        {
+            mSendDonePending = false;
+            otPlatUartSendDone();
+        }
+
+        while (mToRcpHead != mToRcpTail && mToRcp[mToRcpHead % kQueueSize].mDeliverTime <= simulationGetNow())
+        {
+            ToRcpEntry &entry = mToRcp[mToRcpHead++ % kQueueSize];
+
+            otPlatUartReceived(entry.mBuffer, entry.mLength);
+        }
+
+        while (mToHostHead != mToHostTail && mToHost[mToHostHead % kQueueSize].mDeliverTime <= simulationGetNow())
+        {
+            ToHostEntry &entry = mToHost[mToHostHead++ % kQueueSize];
+
+            aTids[count]     = entry.mTid;
+            aStatuses[count] = entry.mStatus;
+            count++;
+        }
+
+        return count;
+    }
+
+private:
+    enum
+    {
+        kQueueSize = 32,
+    };
+
+    struct ToRcpEntry
+    {
+        uint64_t mDeliverTime;
+        uint16_t mLength;
+        uint8_t  mBuffer[2 * (kFrameLength + 16)];
+    };
+
+    struct ToHostEntry
+    {
+        uint64_t        mDeliverTime;
+        uint8_t         mTid;
+        spinel_status_t mStatus;
+    };
+
+    class HdlcBuffer : public ot::Hdlc::Encoder::BufferWriteIterator
+    {
+    public:
+        HdlcBuffer(uint8_t *aBuffer, uint16_t aSize)
+            : mBuffer(aBuffer)
+        {
+            mWritePointer    = aBuffer;
+            mRemainingLength = aSize;
+        }
+
+        uint16_t GetLength(void) const { return static_cast<uint16_t>(mWritePointer - mBuffer); }
+
+    private:
+        uint8_t *mBuffer;
+    };
+
+    static void HandleFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength)
+    {
+        static_cast<Host *>(aContext)->HandleFrame(aFrame, aFrameLength);
+    }
+
+    void HandleFrame(uint8_t *aFrame, uint16_t aFrameLength)
+    {
+        uint8_t      header;
+        unsigned int command;
+        unsigned int prop;
+        unsigned int status;
+
+        if (spinel_datatype_unpack(aFrame, aFrameLength, SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S,
+                                   &header, &command, &prop, &status) > 0 &&
+            command == SPINEL_CMD_PROP_VALUE_IS && prop == SPINEL_PROP_LAST_STATUS &&
+            SPINEL_HEADER_GET_TID(header) != 0)
+        {
+            ToHostEntry &entry = mToHost[mToHostTail++ % kQueueSize];
+
+            entry.mDeliverTime = simulationGetNow() + kHostLatency;
+            entry.mTid         = SPINEL_HEADER_GET_TID(header);
+            entry.mStatus      = static_cast<spinel_status_t>(status);
+        }
+    }
+
+    static void HandleError(void *, otError, uint8_t *, uint16_t) { VerifyOrQuit(false, "Invalid HDLC frame"); }
+
+    uint8_t              mDecodeBuffer[OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE];
+    ot::Hdlc::Decoder    mDecoder;
+    ot::Hdlc::Encoder    mEncoder;
+    ToRcpEntry           mToRcp[kQueueSize];
+    uint32_t             mToRcpHead;
+    uint32_t             mToRcpTail;
+    ToHostEntry          mToHost[kQueueSize];
+    uint32_t             mToHostHead;
+    uint32_t             mToHostTail;
+    bool                 mSendDonePending;
+};
+
+static Host *sHost = NULL;
+
+extern "C" otError otPlatUartEnable(void)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatUartDisable(void)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
+{
+    sHost->HandleUartSend(aBuf, aBufLength);
+    return OT_ERROR_NONE;
+}
+
+static void HandleRawReceive(otInstance *, otRadioFrame *, otError)
+{
+}
+
+static uint8_t GetTid(uint16_t aFrame)
+{
+    return static_cast<uint8_t>(aFrame % kMaxSpinelTid + 1);
+}
+
+/**
+ * This function sends `kNumFrames` raw frames keeping up to @p aDepth of them outstanding, and returns the achieved
+ * rate (frames per second of virtual time).
+ *
+ */
+static uint32_t RunRawTransmit(uint8_t aDepth, uint16_t &aNumBusy)
+{
+    otInstance *    instance;
+    Host            host;
+    uint64_t        start;
+    uint64_t        duration;
+    bool            outstanding[kMaxSpinelTid + 1];
+    uint16_t        sent      = 0;
+    uint16_t        completed = 0;
+    uint16_t        busy      = 0;
+    uint8_t         tids[kMaxSpinelTid];
+    spinel_status_t statuses[kMaxSpinelTid];
+
+    sHost = &host;
+    memset(outstanding, 0, sizeof(outstanding));
+
+    SuccessOrQuit(simulationInit(1, 1), "Failed to initialize the simulation");
+    instance = simulationGetInstance(1);
+
+    otNcpInit(instance);
+    SuccessOrQuit(otLinkRawSetEnable(instance, true), "Failed to enable the raw link");
+    SuccessOrQuit(otLinkSetChannel(instance, kChannel), "Failed to set the channel");
+    SuccessOrQuit(otLinkRawReceive(instance, HandleRawReceive), "Failed to start receiving");
+
+    // Let the NCP send its reset notification.
+    simulationRun(10 * kHostLatency);
+    host.Process(tids, statuses);
+
+    start = simulationGetNow();
+
+    while (completed < kNumFrames)
+    {
+        uint16_t count = host.Process(tids, statuses);
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            // Each frame is reported once, with the TID of its own set command.
+            VerifyOrQuit(outstanding[tids[i]], "Transmit status has an unexpected TID");
+            outstanding[tids[i]] = false;
+
+            if (statuses[i] == SPINEL_STATUS_BUSY)
+            {
+                busy++;
+            }
+            else
+            {
+                VerifyOrQuit(statuses[i] == SPINEL_STATUS_OK, "Raw transmit failed");
+            }
+
+            completed++;
+        }
+
+        while (sent < kNumFrames && sent - completed < aDepth)
+        {
+            VerifyOrQuit(!outstanding[GetTid(sent)], "TID is still in use");
+            outstanding[GetTid(sent)] = true;
+            host.SendRawFrame(GetTid(sent), static_cast<uint8_t>(sent));
+            sent++;
+        }
+
+        simulationRun(kHostStep);
+    }
+
+    VerifyOrQuit(simulationGetCounters()->mTxFrames == static_cast<uint32_t>(kNumFrames - busy), "Unexpected number of frames on the air");
+
+    aNumBusy = busy;
+    duration = simulationGetNow() - start;
+
+    simulationDeinit();
+    sHost = NULL;
+
+    return static_cast<uint32_t>((kNumFrames - busy) * kUsPerSecond / duration);
+}
+
+void TestNcpRawTransmitQueue(void)
+{
+    uint32_t rate[kMaxDepth + 2];
+    uint16_t busy;
+
+    printf("TestNcpRawTransmitQueue");
+
+    for (uint8_t depth = 1; depth <= kMaxDepth; depth++)
+    {
+        rate[depth] = RunRawTransmit(depth, busy);
+        VerifyOrQuit(busy == 0, "Raw frame rejected within the queue size");
+    }
+
+    VerifyOrQuit(rate[kMaxDepth] > rate[1], "Pipelined raw frames are not faster");
+
+    // Frames beyond the queue size are rejected, and reported with their own TID.
+    RunRawTransmit(kMaxDepth + 1, busy);
+    VerifyOrQuit(busy > 0, "Raw frame beyond the queue size was accepted");
+
+    printf(" -- PASS (%u byte frames, %u us host latency:", kFrameLength, static_cast<unsigned int>(kHostLatency));
+
+    for (uint8_t depth = 1; depth <= kMaxDepth; depth++)
+    {
+        printf(" depth %u %u frames/s%s", depth, rate[depth], depth < kMaxDepth ? "," : ")\n");
+    }
+}
+
+#endif // OPENTHREAD_ENABLE_RAW_LINK_API
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_ENABLE_RAW_LINK_API
+    TestNcpRawTransmitQueue();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
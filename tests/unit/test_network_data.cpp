@@ -30,6 +30,9 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/message.hpp"
+#include "thread/network_data_delta.hpp"
+#include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 
 #include "test_platform.h"
@@ -171,12 +174,216 @@ void TestNetworkDataIterator(void)
     testFreeInstance(instance);
 }
 
+void TestNetworkDataDelta(void)
+{
+    const uint8_t kBase[] = {0x08, 0x04, 0x0B, 0x02, 0x00, 0x00, 0x03, 0x14, 0x00, 0x40, 0xFD, 0x00, 0x12, 0x34,
+                             0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC8, 0x00, 0x40, 0x01, 0x03, 0x54, 0x00, 0x00};
+
+    // The preference of the first route changes and a server is added to the second one.
+    const uint8_t kData[] = {0x08, 0x04, 0x0B, 0x02, 0x00, 0x00, 0x03, 0x17, 0x00, 0x40, 0xFD, 0x00, 0x12,
+                             0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC8, 0x00, 0x00, 0x01, 0x06, 0x54,
+                             0x00, 0x00, 0x58, 0x00, 0x40};
+
+    ot::Instance *            instance;
+    Message *                 message;
+    NetworkData::DeltaHistory history;
+    uint8_t                   data[NetworkData::NetworkData::kMaxSize];
+    uint8_t                   length;
+    uint8_t                   version;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    message = instance->GetMessagePool().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "Message::New failed\n");
+
+    VerifyOrQuit(history.GetPreviousVersion(version) == OT_ERROR_NOT_FOUND, "GetPreviousVersion() succeeded\n");
+    history.Save(7, kBase, sizeof(kBase));
+    history.Save(8, kData, sizeof(kData));
+    SuccessOrQuit(history.GetPreviousVersion(version), "GetPreviousVersion() failed\n");
+    VerifyOrQuit(version == 7, "GetPreviousVersion() returned the wrong version\n");
+
+    VerifyOrQuit(history.AppendDelta(*message, 6, kData, sizeof(kData)) == OT_ERROR_NOT_FOUND,
+                 "AppendDelta() succeeded from a missing version\n");
+    SuccessOrQuit(history.AppendDelta(*message, 7, kData, sizeof(kData)), "AppendDelta() failed\n");
+    VerifyOrQuit(message->GetLength() < sizeof(Mle::Tlv) + sizeof(kData), "Delta is not smaller than Network Data\n");
+
+    memcpy(data, kBase, sizeof(kBase));
+    length = sizeof(kBase);
+    SuccessOrQuit(NetworkData::Delta::Apply(*message, 0, data, length), "Delta::Apply() failed\n");
+    VerifyOrQuit(length == sizeof(kData) && memcmp(data, kData, length) == 0, "Delta::Apply() result is wrong\n");
+
+    // A base that does not match the version of the delta is detected.
+    memcpy(data, kBase, sizeof(kBase));
+    data[2] = 0x0C;
+    length  = sizeof(kBase);
+    VerifyOrQuit(NetworkData::Delta::Apply(*message, 0, data, length) == OT_ERROR_SECURITY,
+                 "Delta::Apply() accepted a wrong base\n");
+
+    length = 4;
+    VerifyOrQuit(NetworkData::Delta::Apply(*message, 0, data, length) == OT_ERROR_PARSE,
+                 "Delta::Apply() accepted a too short base\n");
+
+    // Saving the latest version again replaces its content.
+    history.Save(8, kBase, sizeof(kBase));
+    SuccessOrQuit(history.GetPreviousVersion(version), "GetPreviousVersion() failed\n");
+    VerifyOrQuit(version == 7, "Saving the same version added an entry\n");
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+// Builds the registration of a border router advertising an external route on fd00:1234:0:<index>::/64.
+static uint8_t BuildRouteRegistration(uint8_t *aTlvs, uint8_t aPrefixIndex, uint16_t aRloc16, int8_t aPreference)
+{
+    const uint8_t               prefixBytes[] = {0xfd, 0x00, 0x12, 0x34, 0x00, 0x00, 0x00, aPrefixIndex};
+    NetworkData::PrefixTlv *    prefix        = reinterpret_cast<NetworkData::PrefixTlv *>(aTlvs);
+    NetworkData::HasRouteTlv *  hasRoute;
+    NetworkData::HasRouteEntry *entry;
+
+    prefix->Init(0, 64, prefixBytes);
+    prefix->SetStable();
+
+    hasRoute = static_cast<NetworkData::HasRouteTlv *>(prefix->GetSubTlvs());
+    hasRoute->Init();
+    hasRoute->SetStable();
+    hasRoute->SetLength(sizeof(NetworkData::HasRouteEntry));
+
+    entry = hasRoute->GetEntry(0);
+    entry->Init();
+    entry->SetRloc(aRloc16);
+    entry->SetPreference(aPreference);
+
+    prefix->SetSubTlvsLength(sizeof(NetworkData::HasRouteTlv) + sizeof(NetworkData::HasRouteEntry));
+
+    return static_cast<uint8_t>(sizeof(NetworkData::NetworkDataTlv) + prefix->GetLength());
+}
+
+static uint16_t GetBenchmarkRloc16(uint8_t aIndex)
+{
+    return static_cast<uint16_t>(((aIndex % 32) << 10) | (aIndex / 32 + 1));
+}
+
+void TestLeaderUpdateThroughput(void)
+{
+    enum
+    {
+        kIterations = 4000,
+    };
+
+    const uint8_t kNumEntries[] = {8, 16, 32, 64};
+
+    ot::Instance *instance;
+    uint8_t       tlvs[NetworkData::NetworkData::kMaxSize];
+    uint8_t       before[NetworkData::NetworkData::kMaxSize];
+    uint8_t       after[NetworkData::NetworkData::kMaxSize];
+    uint8_t       beforeLength;
+    uint8_t       afterLength;
+    uint8_t       length;
+    uint8_t       version;
+    uint64_t      start;
+    uint64_t      unchangedUs;
+    uint64_t      changedUs;
+    uint64_t      removeUs;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    NetworkData::Leader &leader = instance->GetThreadNetif().GetNetworkDataLeader();
+
+    printf("\nLeader update throughput (us per operation):\n");
+    printf("entries  unchanged  changed  remove-absent\n");
+
+    for (uint8_t n = 0; n < sizeof(kNumEntries); n++)
+    {
+        leader.Reset();
+
+        for (uint8_t i = 0; i < kNumEntries[n]; i++)
+        {
+            length = BuildRouteRegistration(tlvs, i % 4, GetBenchmarkRloc16(i), 0);
+            SuccessOrQuit(leader.RegisterNetworkData(GetBenchmarkRloc16(i), tlvs, length),
+                          "RegisterNetworkData() failed\n");
+        }
+
+        // Re-registering the same data must not produce a new Network Data version.
+        beforeLength = sizeof(before);
+        SuccessOrQuit(leader.GetNetworkData(false, before, beforeLength), "GetNetworkData() failed\n");
+        version = leader.GetVersion();
+        length  = BuildRouteRegistration(tlvs, 0, GetBenchmarkRloc16(0), 0);
+        SuccessOrQuit(leader.RegisterNetworkData(GetBenchmarkRloc16(0), tlvs, length),
+                      "RegisterNetworkData() failed\n");
+        afterLength = sizeof(after);
+        SuccessOrQuit(leader.GetNetworkData(false, after, afterLength), "GetNetworkData() failed\n");
+        VerifyOrQuit(leader.GetVersion() == version, "Unchanged registration updated the version\n");
+        VerifyOrQuit(afterLength == beforeLength && memcmp(after, before, afterLength) == 0,
+                     "Unchanged registration modified the Network Data\n");
+
+        start = testGetNowUs();
+
+        for (uint16_t i = 0; i < kIterations; i++)
+        {
+            uint8_t index = static_cast<uint8_t>(i % kNumEntries[n]);
+
+            length = BuildRouteRegistration(tlvs, index % 4, GetBenchmarkRloc16(index), 0);
+            SuccessOrQuit(leader.RegisterNetworkData(GetBenchmarkRloc16(index), tlvs, length),
+                          "RegisterNetworkData() failed\n");
+        }
+
+        unchangedUs = testGetNowUs() - start;
+
+        start = testGetNowUs();
+
+        for (uint16_t i = 0; i < kIterations; i++)
+        {
+            uint8_t index      = static_cast<uint8_t>(i % kNumEntries[n]);
+            int8_t  preference = ((i / kNumEntries[n]) & 1) ? 0 : 1;
+
+            length = BuildRouteRegistration(tlvs, index % 4, GetBenchmarkRloc16(index), preference);
+            SuccessOrQuit(leader.RegisterNetworkData(GetBenchmarkRloc16(index), tlvs, length),
+                          "RegisterNetworkData() failed\n");
+        }
+
+        changedUs = testGetNowUs() - start;
+
+        // Changing a registration produces a new version and keeps every border router.
+        version = leader.GetVersion();
+        length  = BuildRouteRegistration(tlvs, 0, GetBenchmarkRloc16(0), -1);
+        SuccessOrQuit(leader.RegisterNetworkData(GetBenchmarkRloc16(0), tlvs, length),
+                      "RegisterNetworkData() failed\n");
+        VerifyOrQuit(leader.GetVersion() == static_cast<uint8_t>(version + 1),
+                     "Changed registration kept the version\n");
+        afterLength = sizeof(after);
+        SuccessOrQuit(leader.GetNetworkData(false, after, afterLength), "GetNetworkData() failed\n");
+        VerifyOrQuit(afterLength == beforeLength, "Changed registration lost entries\n");
+
+        // Removing devices that have not registered anything (e.g. detaching children) leaves the data alone.
+        version = leader.GetVersion();
+        start   = testGetNowUs();
+
+        for (uint16_t i = 0; i < kIterations; i++)
+        {
+            leader.RemoveBorderRouter(static_cast<uint16_t>(GetBenchmarkRloc16(i % 64) + 0x100));
+        }
+
+        removeUs = testGetNowUs() - start;
+
+        VerifyOrQuit(leader.GetVersion() == version, "Removing an absent RLOC16 updated the version\n");
+
+        printf("%7d  %9.2f  %7.2f  %13.2f\n", kNumEntries[n], static_cast<double>(unchangedUs) / kIterations,
+               static_cast<double>(changedUs) / kIterations, static_cast<double>(removeUs) / kIterations);
+    }
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     ot::TestNetworkDataIterator();
+    ot::TestNetworkDataDelta();
+    ot::TestLeaderUpdateThroughput();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -0,0 +1,253 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/tasklet.h>
+
+#include "test_util.h"
+
+// The network information is written with the settings driver of the example platforms on the posix `flash.c`
+// file backend, with a settings area large enough to hold all the writes of a test without a compaction.
+#define SETTINGS_CONFIG_BASE_ADDRESS 0
+#define SETTINGS_CONFIG_PAGE_SIZE 0x800
+#define SETTINGS_CONFIG_PAGE_NUM 16
+
+#include "utils/settings.cpp"
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/settings.hpp"
+#include "thread/key_manager.hpp"
+#include "thread/mle.hpp"
+
+extern "C" {
+uint32_t NODE_ID = 2;
+}
+
+namespace ot {
+
+enum
+{
+    kNumFrames       = 20000,
+    kFrameInterval   = 10,     ///< Time between two transmitted frames (milliseconds).
+    kKeyNetworkInfo  = 0x0003, ///< Settings key of the network information.
+    kKeyFiller       = 0x7fff,
+    kMaxStoresNeeded = kNumFrames / (OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD / 2) + 1,
+};
+
+static uint32_t sNow;
+
+static uint32_t testGetNow(void)
+{
+    return sNow;
+}
+
+static void ProcessTasklets(Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance))
+    {
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+// Returns the number of network information records written to the settings area in use.
+static uint16_t CountNetworkInfoWrites(void)
+{
+    uint16_t count = 0;
+
+    for (uint32_t offset = kSettingsFlagSize; offset < sSettingsUsedSize;)
+    {
+        struct settingsBlock block;
+
+        utilsFlashRead(sSettingsBaseAddress + offset, reinterpret_cast<uint8_t *>(&block), sizeof(block));
+
+        if (block.key == kKeyNetworkInfo)
+        {
+            count++;
+        }
+
+        offset += getAlignLength(block.length) + sizeof(struct settingsBlock);
+    }
+
+    return count;
+}
+
+static uint32_t GetStoredMacFrameCounter(Instance &aInstance)
+{
+    Settings::NetworkInfo networkInfo;
+
+    SuccessOrQuit(aInstance.GetSettings().ReadNetworkInfo(networkInfo), "ReadNetworkInfo() failed");
+
+    return networkInfo.mMacFrameCounter;
+}
+
+static Instance *InitInstance(void)
+{
+    Instance *instance;
+
+    testPlatResetToDefaults();
+    g_testPlatAlarmGetNow = testGetNow;
+    sNow                  = 0;
+
+    otPlatSettingsInit(NULL);
+    otPlatSettingsWipe(NULL);
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    SuccessOrQuit(instance->GetThreadNetif().GetMle().Store(), "Store() failed");
+
+    return instance;
+}
+
+void TestNetworkInfoStoreDeferred(void)
+{
+    Instance *                        instance   = InitInstance();
+    Mle::MleRouter &                  mle        = instance->GetThreadNetif().GetMle();
+    KeyManager &                      keyManager = instance->GetThreadNetif().GetKeyManager();
+    const otNetworkInfoStoreCounters &counters   = mle.GetStoreCounters();
+    uint32_t                          stores     = counters.mStores;
+    uint16_t                          writes     = CountNetworkInfoWrites();
+
+    printf("TestNetworkInfoStoreDeferred");
+
+    VerifyOrQuit(writes == 1 && stores == 1, "Initial store not written");
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        sNow += kFrameInterval;
+        keyManager.IncrementMacFrameCounter();
+        ProcessTasklets(*instance);
+
+        VerifyOrQuit(keyManager.GetMacFrameCounter() < GetStoredMacFrameCounter(*instance),
+                     "Frame counter used before it was stored");
+    }
+
+    stores = counters.mStores - stores;
+    writes = CountNetworkInfoWrites() - writes;
+
+    VerifyOrQuit(stores == writes, "Store counter does not match the writes to flash");
+    VerifyOrQuit(stores > 0 && stores <= kMaxStoresNeeded, "Unexpected number of writes");
+    VerifyOrQuit(counters.mSyncStores == 0, "Frame counters stored on the transmit path");
+
+    printf(" -- PASS (%u frames: %u writes)\n", kNumFrames, static_cast<unsigned int>(writes));
+
+    testFreeInstance(instance);
+}
+
+void TestNetworkInfoStoreSync(void)
+{
+    Instance *                        instance   = InitInstance();
+    Mle::MleRouter &                  mle        = instance->GetThreadNetif().GetMle();
+    KeyManager &                      keyManager = instance->GetThreadNetif().GetKeyManager();
+    const otNetworkInfoStoreCounters &counters   = mle.GetStoreCounters();
+    uint32_t                          stored     = GetStoredMacFrameCounter(*instance);
+
+    printf("TestNetworkInfoStoreSync");
+
+    // Without the tasklet running, the counter is stored when it reaches the stored value and not before.
+    while (keyManager.GetMacFrameCounter() + 1 < stored)
+    {
+        keyManager.IncrementMacFrameCounter();
+    }
+
+    VerifyOrQuit(counters.mStores == 1 && CountNetworkInfoWrites() == 1, "Deferred store written without tasklet");
+
+    keyManager.IncrementMacFrameCounter();
+    VerifyOrQuit(counters.mSyncStores == 1 && counters.mStores == 2 && CountNetworkInfoWrites() == 2,
+                 "Frame counter not stored on reaching the stored value");
+    VerifyOrQuit(keyManager.GetMacFrameCounter() < GetStoredMacFrameCounter(*instance),
+                 "Frame counter used before it was stored");
+
+    // The synchronous write satisfied the deferred request.
+    ProcessTasklets(*instance);
+    VerifyOrQuit(counters.mStores == 2 && CountNetworkInfoWrites() == 2, "Deferred store written twice");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestNetworkInfoStoreFailure(void)
+{
+    Instance *                        instance   = InitInstance();
+    Mle::MleRouter &                  mle        = instance->GetThreadNetif().GetMle();
+    KeyManager &                      keyManager = instance->GetThreadNetif().GetKeyManager();
+    const otNetworkInfoStoreCounters &counters   = mle.GetStoreCounters();
+    uint32_t                          stored     = GetStoredMacFrameCounter(*instance);
+    uint8_t                           filler[kSettingsBlockDataSize];
+    uint16_t                          fillerLength;
+
+    printf("TestNetworkInfoStoreFailure");
+
+    // Fill the settings area so that the network information no longer fits.
+    memset(filler, 0, sizeof(filler));
+
+    for (fillerLength = sizeof(filler); fillerLength > 0; fillerLength /= 2)
+    {
+        while (otPlatSettingsAdd(instance, kKeyFiller, filler, fillerLength) == OT_ERROR_NONE)
+        {
+        }
+    }
+
+    while (stored - keyManager.GetMacFrameCounter() > keyManager.GetStoreFrameCounterAhead() / 2)
+    {
+        keyManager.IncrementMacFrameCounter();
+    }
+
+    ProcessTasklets(*instance);
+    VerifyOrQuit(counters.mStores == 1 && CountNetworkInfoWrites() == 1, "Failed write counted as a store");
+    VerifyOrQuit(GetStoredMacFrameCounter(*instance) == stored, "Stored frame counter changed");
+
+    // The request stays pending and is written by the next attempt once there is room again.
+    SuccessOrQuit(otPlatSettingsDelete(instance, kKeyFiller, -1), "Delete() failed");
+    keyManager.IncrementMacFrameCounter();
+    ProcessTasklets(*instance);
+    VerifyOrQuit(counters.mStores == 2, "Pending write not retried");
+    VerifyOrQuit(GetStoredMacFrameCounter(*instance) > stored, "Frame counter not stored");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestNetworkInfoStoreDeferred();
+    ot::TestNetworkInfoStoreSync();
+    ot::TestNetworkInfoStoreFailure();
+
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
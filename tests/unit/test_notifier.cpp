@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/openthread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/notifier.hpp"
+
+namespace ot {
+
+static uint32_t sLastFlags;
+
+static void HandleStateChanged(Notifier::Callback &aCallback, uint32_t aFlags)
+{
+    OT_UNUSED_VARIABLE(aCallback);
+    sLastFlags = aFlags;
+}
+
+static void ProcessTasklets(Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance))
+    {
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+void TestNotifierSubscriptionMask(void)
+{
+    Instance *         instance = static_cast<Instance *>(testInitInstance());
+    Notifier &         notifier = instance->GetNotifier();
+    Notifier::Callback roleCallback(HandleStateChanged, NULL, OT_CHANGED_THREAD_ROLE);
+    Notifier::Callback netDataCallback(HandleStateChanged, NULL, OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ML_ADDR);
+    uint32_t           dispatchCount;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    // Dispatch the changes made during the instance initialization.
+    ProcessTasklets(*instance);
+    dispatchCount = notifier.GetDispatchCount();
+
+    SuccessOrQuit(notifier.RegisterCallback(roleCallback), "RegisterCallback() failed\n");
+    SuccessOrQuit(notifier.RegisterCallback(netDataCallback), "RegisterCallback() failed\n");
+    VerifyOrQuit(notifier.RegisterCallback(roleCallback) == OT_ERROR_ALREADY, "RegisterCallback() did not fail\n");
+
+    // Flags outside of both masks.
+    notifier.SetFlags(OT_CHANGED_THREAD_CHANNEL);
+    ProcessTasklets(*instance);
+    VerifyOrQuit(notifier.GetDispatchCount() == dispatchCount + 1, "GetDispatchCount() is incorrect\n");
+    VerifyOrQuit(roleCallback.GetInvocationCount() == 0, "Callback invoked for flags outside of its mask\n");
+    VerifyOrQuit(netDataCallback.GetInvocationCount() == 0, "Callback invoked for flags outside of its mask\n");
+
+    // Flags intersecting one mask, the callback still gets all the changed flags.
+    notifier.SetFlags(OT_CHANGED_THREAD_CHANNEL | OT_CHANGED_THREAD_ML_ADDR);
+    ProcessTasklets(*instance);
+    VerifyOrQuit(roleCallback.GetInvocationCount() == 0, "Callback invoked for flags outside of its mask\n");
+    VerifyOrQuit(netDataCallback.GetInvocationCount() == 1, "Callback not invoked\n");
+    VerifyOrQuit(sLastFlags == (OT_CHANGED_THREAD_CHANNEL | OT_CHANGED_THREAD_ML_ADDR), "Flags are incorrect\n");
+
+    // Flags set multiple times before the tasklet runs are coalesced into one invocation.
+    notifier.SetFlags(OT_CHANGED_THREAD_ROLE);
+    notifier.SetFlags(OT_CHANGED_THREAD_NETDATA);
+    ProcessTasklets(*instance);
+    VerifyOrQuit(notifier.GetDispatchCount() == dispatchCount + 3, "GetDispatchCount() is incorrect\n");
+    VerifyOrQuit(roleCallback.GetInvocationCount() == 1, "Callback not invoked\n");
+    VerifyOrQuit(netDataCallback.GetInvocationCount() == 2, "Callback not invoked\n");
+
+    notifier.RemoveCallback(roleCallback);
+    notifier.SetFlags(OT_CHANGED_THREAD_ROLE);
+    ProcessTasklets(*instance);
+    VerifyOrQuit(roleCallback.GetInvocationCount() == 1, "Removed callback was invoked\n");
+
+    notifier.RemoveCallback(netDataCallback);
+
+    printf("TestNotifierSubscriptionMask passed\n");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestNotifierSubscriptionMask();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -402,7 +402,7 @@ otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
 int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
 {
     (void)aInstance;
-    return 0;
+    return -100;
 }
 //
 // Random
@@ -497,36 +497,36 @@ void otPlatLog(otLogLevel, otLogRegion, const char *, ...)
 }
 
 //
-// Settings
+// Settings, weak so that a test can link a real settings driver instead
 //
 
-void otPlatSettingsInit(otInstance *aInstance)
+OT_TOOL_WEAK void otPlatSettingsInit(otInstance *aInstance)
 {
     (void)aInstance;
 }
 
-otError otPlatSettingsBeginChange(otInstance *aInstance)
+OT_TOOL_WEAK otError otPlatSettingsBeginChange(otInstance *aInstance)
 {
     (void)aInstance;
 
     return OT_ERROR_NONE;
 }
 
-otError otPlatSettingsCommitChange(otInstance *aInstance)
+OT_TOOL_WEAK otError otPlatSettingsCommitChange(otInstance *aInstance)
 {
     (void)aInstance;
 
     return OT_ERROR_NONE;
 }
 
-otError otPlatSettingsAbandonChange(otInstance *aInstance)
+OT_TOOL_WEAK otError otPlatSettingsAbandonChange(otInstance *aInstance)
 {
     (void)aInstance;
 
     return OT_ERROR_NONE;
 }
 
-otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+OT_TOOL_WEAK otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     (void)aInstance;
     (void)aKey;
@@ -537,7 +537,7 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint
     return OT_ERROR_NOT_FOUND;
 }
 
-otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+OT_TOOL_WEAK otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
     (void)aInstance;
     (void)aKey;
@@ -547,7 +547,7 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     return OT_ERROR_NONE;
 }
 
-otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+OT_TOOL_WEAK otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
     (void)aInstance;
     (void)aKey;
@@ -557,7 +557,7 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     return OT_ERROR_NONE;
 }
 
-otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+OT_TOOL_WEAK otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
     (void)aInstance;
     (void)aKey;
@@ -566,7 +566,7 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
     return OT_ERROR_NONE;
 }
 
-void otPlatSettingsWipe(otInstance *aInstance)
+OT_TOOL_WEAK void otPlatSettingsWipe(otInstance *aInstance)
 {
     (void)aInstance;
 }
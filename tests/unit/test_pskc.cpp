@@ -25,9 +25,14 @@
  *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *  POSSIBILITY OF SUCH DAMAGE.
  */
+
 #include <openthread/config.h>
 #include <openthread/openthread.h>
+#include <openthread/tasklet.h>
+
+#include <mbedtls/cmac.h>
 
+#include "common/instance.hpp"
 #include "common/logging.hpp"
 #include "meshcop/commissioner.hpp"
 #include "utils/wrap_string.h"
@@ -79,11 +84,126 @@ void TestMaximumPassphrase(void)
     testFreeInstance(instance);
 }
 
+// Computes the PSKc with one AES-CMAC-PRF-128 computation per PBKDF2 iteration, following RFC 8018 and RFC 4615.
+static void ComputeReferencePskc(const char *aPassPhrase, const char *aNetworkName, uint8_t *aPskc)
+{
+    uint8_t  salt[OT_PBKDF2_SALT_MAX_LEN + 4];
+    uint8_t  prf[OT_PBKDF2_BLOCK_SIZE];
+    uint16_t saltLen = 0;
+
+    memcpy(salt, "Thread", 6);
+    saltLen += 6;
+    memcpy(salt + saltLen, sXPanId, sizeof(sXPanId));
+    saltLen += sizeof(sXPanId);
+    memcpy(salt + saltLen, aNetworkName, strlen(aNetworkName));
+    saltLen += static_cast<uint16_t>(strlen(aNetworkName));
+    salt[saltLen++] = 0;
+    salt[saltLen++] = 0;
+    salt[saltLen++] = 0;
+    salt[saltLen++] = 1;
+
+    mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassPhrase), strlen(aPassPhrase), salt, saltLen, prf);
+    memcpy(aPskc, prf, sizeof(prf));
+
+    for (int i = 1; i < 16384; i++)
+    {
+        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassPhrase), strlen(aPassPhrase), prf,
+                                 sizeof(prf), prf);
+
+        for (size_t j = 0; j < sizeof(prf); j++)
+        {
+            aPskc[j] ^= prf[j];
+        }
+    }
+}
+
+static uint8_t sGeneratedPskc[OT_PSKC_MAX_SIZE];
+static int     sGeneratedCount;
+
+static void HandlePskcGenerated(const uint8_t *aPSKc, void *aContext)
+{
+    VerifyOrQuit(aContext == &sGeneratedCount, "HandlePskcGenerated() got wrong context");
+    memcpy(sGeneratedPskc, aPSKc, sizeof(sGeneratedPskc));
+    sGeneratedCount++;
+}
+
+void TestPskcGenerator(void)
+{
+    uint8_t                     pskc[OT_PSKC_MAX_SIZE];
+    uint8_t                     expectedPskc[OT_PSKC_MAX_SIZE];
+    const char                  passphrase[] = "1234567812345678"; // The PRF key is the passphrase itself.
+    ot::Instance *              instance     = testInitInstance();
+    ot::MeshCoP::PskcGenerator &generator    = instance->GetThreadNetif().GetCommissioner().GetPskcGenerator();
+    int                         taskletRuns  = 0;
+    uint64_t                    start;
+    uint64_t                    referenceTime;
+    uint64_t                    computeTime;
+    uint64_t                    cachedTime;
+
+    start = testGetNowUs();
+    ComputeReferencePskc(passphrase, "OpenThread", expectedPskc);
+    referenceTime = testGetNowUs() - start;
+
+    start = testGetNowUs();
+    SuccessOrQuit(ot::MeshCoP::Commissioner::GeneratePSKc(passphrase, "OpenThread", sXPanId, pskc),
+                  "TestPskcGenerator failed to generate PSKc");
+    computeTime = testGetNowUs() - start;
+    VerifyOrQuit(memcmp(pskc, expectedPskc, sizeof(pskc)) == 0, "TestPskcGenerator got wrong pskc");
+
+    // The PBKDF2 iterations are run from several tasklets.
+    SuccessOrQuit(otCommissionerGeneratePSKcAsync(instance, passphrase, "OpenThread", sXPanId, HandlePskcGenerated,
+                                                  &sGeneratedCount),
+                  "otCommissionerGeneratePSKcAsync() failed");
+    VerifyOrQuit(otCommissionerGeneratePSKcAsync(instance, passphrase, "OpenThread", sXPanId, HandlePskcGenerated,
+                                                 &sGeneratedCount) == OT_ERROR_BUSY,
+                 "otCommissionerGeneratePSKcAsync() was not busy");
+
+    while (otTaskletsArePending(instance))
+    {
+        otTaskletsProcess(instance);
+        taskletRuns++;
+    }
+
+    VerifyOrQuit(sGeneratedCount == 1 && !generator.IsBusy(), "PSKc was not generated");
+    VerifyOrQuit(taskletRuns > 1, "PSKc was generated from a single tasklet");
+    VerifyOrQuit(memcmp(sGeneratedPskc, expectedPskc, sizeof(pskc)) == 0, "TestPskcGenerator got wrong pskc");
+
+    // The generated PSKc is cached.
+    start = testGetNowUs();
+    SuccessOrQuit(otCommissionerGeneratePSKc(instance, passphrase, "OpenThread", sXPanId, pskc),
+                  "otCommissionerGeneratePSKc() failed");
+    cachedTime = testGetNowUs() - start;
+    VerifyOrQuit(memcmp(pskc, expectedPskc, sizeof(pskc)) == 0, "TestPskcGenerator got wrong cached pskc");
+
+    SuccessOrQuit(otCommissionerGeneratePSKcAsync(instance, passphrase, "OpenThread", sXPanId, HandlePskcGenerated,
+                                                  &sGeneratedCount),
+                  "otCommissionerGeneratePSKcAsync() failed");
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sGeneratedCount == 2, "Cached PSKc was not reported from the next tasklet");
+    VerifyOrQuit(memcmp(sGeneratedPskc, expectedPskc, sizeof(pskc)) == 0, "TestPskcGenerator got wrong cached pskc");
+
+    // Other inputs are not found in the cache.
+    SuccessOrQuit(otCommissionerGeneratePSKc(instance, passphrase, "OpenThreaD", sXPanId, pskc),
+                  "otCommissionerGeneratePSKc() failed");
+    VerifyOrQuit(memcmp(pskc, expectedPskc, sizeof(pskc)) != 0, "TestPskcGenerator got the pskc of other inputs");
+    VerifyOrQuit(otCommissionerGeneratePSKcAsync(instance, "12345", "OpenThread", sXPanId, HandlePskcGenerated,
+                                                 &sGeneratedCount) == OT_ERROR_INVALID_ARGS,
+                 "otCommissionerGeneratePSKcAsync() accepted a short passphrase");
+    VerifyOrQuit(!generator.IsBusy(), "Failed otCommissionerGeneratePSKcAsync() left the generator busy");
+
+    printf("TestPskcGenerator -- PASS (%u tasklets, %u us per-iteration CMAC vs %u us, %u us cached)\n", taskletRuns,
+           static_cast<unsigned int>(referenceTime), static_cast<unsigned int>(computeTime),
+           static_cast<unsigned int>(cachedTime));
+
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMinimumPassphrase();
     TestMaximumPassphrase();
+    TestPskcGenerator();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,457 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/openthread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/router_table.hpp"
+
+namespace ot {
+
+static ot::Instance *sInstance;
+
+enum
+{
+    kNumIterations = 2000,
+    kLocalRouterId = 0,
+};
+
+static const int8_t  kNoiseFloor  = -100;
+static const int8_t  kRssValues[] = {-100, -95, -85, -60}; // Link quality 0, 1, 2 and 3.
+static const uint8_t kRouterIds[] = {0, 1, 2, 5, 9, 10, 17, 22, 33, 40, 41, 47, 53, 58, 62};
+
+// Reference implementation of next hop selection, evaluated directly from the router entries.
+static uint16_t ReferenceGetNextHop(RouterTable &aTable, uint16_t aDestination)
+{
+    uint8_t       destinationId = Mle::Mle::GetRouterId(aDestination);
+    uint16_t      rval          = Mac::kShortAddrInvalid;
+    Router *      router;
+    const Router *nextHop;
+    uint8_t       linkCost;
+    uint8_t       routeCost;
+    uint8_t       nextHopLinkCost;
+
+    if (destinationId == kLocalRouterId)
+    {
+        ExitNow(rval = aDestination);
+    }
+
+    router = aTable.GetRouter(destinationId);
+    VerifyOrExit(router != NULL);
+
+    linkCost        = aTable.GetLinkCost(*router);
+    nextHop         = aTable.GetRouter(router->GetNextHop());
+    routeCost       = (nextHop != NULL) ? router->GetCost() : static_cast<uint8_t>(Mle::kMaxRouteCost);
+    nextHopLinkCost = (nextHop != NULL) ? aTable.GetLinkCost(*aTable.GetRouter(router->GetNextHop()))
+                                        : static_cast<uint8_t>(Mle::kMaxRouteCost);
+
+    if (routeCost + nextHopLinkCost < linkCost)
+    {
+        VerifyOrExit(nextHop != NULL && nextHop->GetState() != Neighbor::kStateInvalid);
+        rval = Mle::Mle::GetRloc16(router->GetNextHop());
+    }
+    else if (linkCost < Mle::kMaxRouteCost)
+    {
+        rval = Mle::Mle::GetRloc16(destinationId);
+    }
+
+exit:
+    return rval;
+}
+
+// Reference implementation of path cost calculation, evaluated directly from the router entries.
+static uint8_t ReferenceGetCost(RouterTable &aTable, uint16_t aRloc16)
+{
+    uint8_t cost   = Mle::kMaxRouteCost;
+    Router *router = aTable.GetRouter(Mle::Mle::GetRouterId(aRloc16));
+    Router *nextHop;
+
+    VerifyOrExit(router != NULL);
+
+    cost    = aTable.GetLinkCost(*router);
+    nextHop = aTable.GetRouter(router->GetNextHop());
+
+    if (nextHop != NULL && router->GetCost() + aTable.GetLinkCost(*nextHop) < cost)
+    {
+        cost = router->GetCost() + aTable.GetLinkCost(*nextHop);
+    }
+
+exit:
+    return cost;
+}
+
+// Checks the precomputed route of every router id against the reference route selection.
+static void VerifyRoutes(RouterTable &aTable, const char *aMessage)
+{
+    Mle::MleRouter &mle = sInstance->Get<Mle::MleRouter>();
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        uint16_t rloc16 = Mle::Mle::GetRloc16(routerId);
+
+        VerifyOrQuit(mle.GetNextHop(rloc16) == ReferenceGetNextHop(aTable, rloc16), aMessage);
+        VerifyOrQuit(mle.GetCost(rloc16) == ReferenceGetCost(aTable, rloc16), aMessage);
+    }
+}
+
+// Passes an unsecured broadcast frame from a neighboring router to the MAC, which updates the link quality.
+static void ReceiveFrame(const Router &aRouter, int8_t aRss)
+{
+    Mac::Mac &   mac = sInstance->GetThreadNetif().GetMac();
+    uint8_t      psdu[OT_RADIO_FRAME_MAX_SIZE];
+    otRadioFrame radioFrame;
+    Mac::Frame & frame = *static_cast<Mac::Frame *>(&radioFrame);
+
+    memset(&radioFrame, 0, sizeof(radioFrame));
+    frame.mPsdu    = psdu;
+    frame.mChannel = mac.GetPanChannel();
+
+    frame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfDstAddrShort |
+                            Mac::Frame::kFcfSrcAddrExt | Mac::Frame::kFcfFrameVersion2006,
+                        Mac::Frame::kSecNone);
+    frame.SetDstPanId(mac.GetPanId());
+    frame.SetDstAddr(Mac::kShortAddrBroadcast);
+    frame.SetSrcAddr(aRouter.GetExtAddress());
+    frame.SetPayloadLength(0);
+    frame.SetRssi(aRss);
+
+    otPlatRadioReceiveDone(sInstance, &radioFrame, OT_ERROR_NONE);
+}
+
+// Receives frames from a neighboring router until its link quality changes to @p aLinkQuality.
+static void ChangeLinkQuality(Router &aRouter, uint8_t aLinkQuality, int8_t aLinkMargin)
+{
+    int8_t noiseFloor = sInstance->GetThreadNetif().GetMac().GetNoiseFloor();
+
+    for (uint8_t i = 0; i < 100 && aRouter.GetLinkInfo().GetLinkQuality() != aLinkQuality; i++)
+    {
+        ReceiveFrame(aRouter, noiseFloor + aLinkMargin);
+    }
+
+    VerifyOrQuit(aRouter.GetLinkInfo().GetLinkQuality() == aLinkQuality, "Link quality did not change");
+}
+
+// Randomizes link state, link quality and advertised route of every router entry.
+static void RandomizeRouters(RouterTable &aTable)
+{
+    for (RouterTable::Iterator iter(*sInstance); !iter.IsDone(); iter.Advance())
+    {
+        Router &router = *iter.GetRouter();
+
+        switch (rand() % 3)
+        {
+        case 0:
+            router.SetState(Neighbor::kStateInvalid);
+            break;
+
+        case 1:
+            router.SetState(Neighbor::kStateLinkRequest);
+            break;
+
+        default:
+            router.SetState(Neighbor::kStateValid);
+            break;
+        }
+
+        router.GetLinkInfo().Clear();
+        router.GetLinkInfo().AddRss(kNoiseFloor, kRssValues[rand() % OT_ARRAY_LENGTH(kRssValues)]);
+        router.SetLinkQualityOut(static_cast<uint8_t>(rand() % 4));
+
+        if (rand() % 4 == 0)
+        {
+            router.SetNextHop(Mle::kInvalidRouterId);
+            router.SetCost(0);
+        }
+        else
+        {
+            router.SetNextHop(static_cast<uint8_t>(rand() % (Mle::kMaxRouterId + 2)));
+            router.SetCost(static_cast<uint8_t>(rand() % (Mle::kMaxRouteCost + 1)));
+        }
+    }
+
+    aTable.UpdateRoutes();
+}
+
+void TestRouterTableRoutes(void)
+{
+    RouterTable *       table;
+    Mle::MleRouter *    mle;
+    ThreadRouterMaskTlv routerMask;
+    uint32_t            numDirect    = 0;
+    uint32_t            numMultiHop  = 0;
+    uint32_t            numUnreached = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<RouterTable>();
+    mle   = &sInstance->Get<Mle::MleRouter>();
+
+    mle->SetRouterId(kLocalRouterId);
+
+    routerMask.Init();
+    routerMask.SetIdSequence(1);
+    routerMask.ClearAssignedRouterIdMask();
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kRouterIds); i++)
+    {
+        routerMask.SetAssignedRouterId(kRouterIds[i]);
+    }
+
+    table->ProcessTlv(routerMask);
+    VerifyOrQuit(table->GetActiveRouterCount() == OT_ARRAY_LENGTH(kRouterIds), "ProcessTlv() failed");
+
+    printf("Comparing precomputed routes with reference route selection");
+
+    srand(0);
+
+    for (uint32_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        RandomizeRouters(*table);
+
+        for (uint8_t routerId = 0; routerId <= Mle::kInvalidRouterId; routerId++)
+        {
+            uint16_t rloc16 = Mle::Mle::GetRloc16(routerId);
+            uint16_t nextHop;
+
+            // Check both the router itself and one of its children.
+            for (uint16_t childId = 0; childId < 2; childId++)
+            {
+                nextHop = mle->GetNextHop(rloc16 | childId);
+
+                VerifyOrQuit(nextHop == ReferenceGetNextHop(*table, rloc16 | childId), "GetNextHop() mismatch");
+                VerifyOrQuit(mle->GetCost(rloc16 | childId) == ReferenceGetCost(*table, rloc16 | childId),
+                             "GetCost() mismatch");
+            }
+
+            if (routerId == kLocalRouterId)
+            {
+                continue;
+            }
+
+            if (nextHop == Mac::kShortAddrInvalid)
+            {
+                numUnreached++;
+            }
+            else if (nextHop == rloc16)
+            {
+                numDirect++;
+            }
+            else
+            {
+                numMultiHop++;
+            }
+        }
+    }
+
+    VerifyOrQuit(numDirect > 0 && numMultiHop > 0 && numUnreached > 0, "Random topologies did not cover all cases");
+
+    printf(" -- PASS (direct:%lu, multi-hop:%lu, unreachable:%lu)\n", static_cast<unsigned long>(numDirect),
+           static_cast<unsigned long>(numMultiHop), static_cast<unsigned long>(numUnreached));
+
+    printf("Checking routes after neighbor removal");
+
+    RandomizeRouters(*table);
+
+    for (RouterTable::Iterator iter(*sInstance); !iter.IsDone(); iter.Advance())
+    {
+        Router &router = *iter.GetRouter();
+
+        if (router.GetState() == Neighbor::kStateValid && router.GetRouterId() != kLocalRouterId)
+        {
+            table->RemoveNeighbor(router);
+            router.SetState(Neighbor::kStateInvalid);
+            table->UpdateRoutes();
+            VerifyOrQuit(mle->GetNextHop(router.GetRloc16()) == ReferenceGetNextHop(*table, router.GetRloc16()),
+                         "GetNextHop() mismatch after RemoveNeighbor()");
+        }
+    }
+
+    for (uint8_t routerId = 1; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        VerifyOrQuit(mle->GetNextHop(Mle::Mle::GetRloc16(routerId)) == Mac::kShortAddrInvalid,
+                     "Route exists after all neighbors were removed");
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestRouterTableRouteUpdates(void)
+{
+    RouterTable *       table;
+    Mle::MleRouter *    mle;
+    ThreadRouterMaskTlv routerMask;
+    int8_t              noiseFloor;
+    Router *            hopA;
+    Router *            hopB;
+    uint8_t             hopAId = kRouterIds[1];
+    uint8_t             hopBId = kRouterIds[2];
+    uint8_t             movedId;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table      = &sInstance->Get<RouterTable>();
+    mle        = &sInstance->Get<Mle::MleRouter>();
+    noiseFloor = sInstance->GetThreadNetif().GetMac().GetNoiseFloor();
+
+    // The MAC only updates the link quality of neighbors while attached as a router.
+    mle->SetRouterId(kLocalRouterId);
+    SuccessOrQuit(otLinkSetPanId(sInstance, 0x1234), "otLinkSetPanId() failed");
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true), "otIp6SetEnabled() failed");
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true), "otThreadSetEnabled() failed");
+    SuccessOrQuit(mle->BecomeLeader(), "BecomeLeader() failed");
+    VerifyOrQuit(Mle::Mle::GetRouterId(mle->GetRloc16()) == kLocalRouterId, "BecomeLeader() picked another router id");
+
+    routerMask.Init();
+    routerMask.SetIdSequence(table->GetRouterIdSequence() + 1);
+    routerMask.ClearAssignedRouterIdMask();
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kRouterIds); i++)
+    {
+        routerMask.SetAssignedRouterId(kRouterIds[i]);
+    }
+
+    table->ProcessTlv(routerMask);
+    VerifyOrQuit(table->GetActiveRouterCount() == OT_ARRAY_LENGTH(kRouterIds), "ProcessTlv() failed");
+
+    // Routers A and B are direct neighbors, all other routers are only reachable through one of them.
+    for (RouterTable::Iterator iter(*sInstance); !iter.IsDone(); iter.Advance())
+    {
+        Router &        router   = *iter.GetRouter();
+        uint8_t         routerId = router.GetRouterId();
+        Mac::ExtAddress extAddress;
+
+        if (routerId == kLocalRouterId)
+        {
+            continue;
+        }
+
+        memset(&extAddress, 0, sizeof(extAddress));
+        extAddress.m8[0] = 0x12;
+        extAddress.m8[7] = routerId;
+
+        router.SetExtAddress(extAddress);
+        router.SetState(Neighbor::kStateValid);
+        router.SetLinkQualityOut(3);
+        router.GetLinkInfo().Clear();
+
+        if (routerId == hopAId || routerId == hopBId)
+        {
+            router.GetLinkInfo().AddRss(noiseFloor, noiseFloor + 30);
+            router.SetNextHop(Mle::kInvalidRouterId);
+            router.SetCost(0);
+        }
+        else
+        {
+            router.GetLinkInfo().AddRss(noiseFloor, noiseFloor);
+            router.SetNextHop((routerId % 2) ? hopAId : hopBId);
+            router.SetCost(2);
+        }
+    }
+
+    table->UpdateRoutes();
+
+    hopA    = table->GetRouter(hopAId);
+    hopB    = table->GetRouter(hopBId);
+    movedId = kRouterIds[3];
+
+    VerifyOrQuit(hopA != NULL && hopB != NULL, "GetRouter() failed");
+    VerifyOrQuit(table->GetRouter(movedId)->GetNextHop() == hopAId, "Unexpected initial topology");
+    VerifyRoutes(*table, "Route mismatch in initial topology");
+
+    printf("Checking routes after link quality change");
+
+    ChangeLinkQuality(*hopA, 1, 5);
+    VerifyRoutes(*table, "Route mismatch after link quality change");
+    VerifyOrQuit(mle->GetCost(Mle::Mle::GetRloc16(movedId)) == 2 + Mle::MleRouter::LinkQualityToCost(1),
+                 "Route through the degraded neighbor was not updated");
+
+    ChangeLinkQuality(*hopB, 2, 15);
+    VerifyRoutes(*table, "Route mismatch after link quality change");
+
+    printf(" -- PASS\n");
+
+    printf("Checking routes after next hop change");
+
+    table->GetRouter(movedId)->SetNextHop(hopBId);
+    table->UpdateRoutes();
+    VerifyRoutes(*table, "Route mismatch after next hop change");
+    VerifyOrQuit(mle->GetNextHop(Mle::Mle::GetRloc16(movedId)) == hopB->GetRloc16(), "Next hop was not updated");
+
+    // Link quality changes of the old next hop no longer affect the moved route.
+    ChangeLinkQuality(*hopA, 3, 30);
+    VerifyRoutes(*table, "Route mismatch after next hop change");
+    VerifyOrQuit(mle->GetCost(Mle::Mle::GetRloc16(movedId)) == 2 + Mle::MleRouter::LinkQualityToCost(2),
+                 "Route cost follows the old next hop");
+
+    ChangeLinkQuality(*hopB, 0, 0);
+    VerifyRoutes(*table, "Route mismatch after next hop change");
+    VerifyOrQuit(mle->GetNextHop(Mle::Mle::GetRloc16(movedId)) == Mac::kShortAddrInvalid,
+                 "Route through a neighbor without link exists");
+
+    printf(" -- PASS\n");
+
+    printf("Checking routes after router removal");
+
+    SuccessOrQuit(table->Release(hopAId), "Release() failed");
+    VerifyRoutes(*table, "Route mismatch after router removal");
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kRouterIds); i++)
+    {
+        if (kRouterIds[i] != kLocalRouterId)
+        {
+            VerifyOrQuit(mle->GetNextHop(Mle::Mle::GetRloc16(kRouterIds[i])) == Mac::kShortAddrInvalid,
+                         "Route exists after its next hop was removed");
+        }
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestRouterTableRoutes();
+    ot::TestRouterTableRouteUpdates();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,532 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/types.h>
+#include <openthread/platform/settings.h>
+
+#include "test_util.h"
+
+// The settings driver is built here with a larger settings area than the posix platform default, so that the
+// test can store hundreds of child records. test-settings also uses an index large enough to hold all of them, and
+// test-settings-default-index keeps the default index size, which they overflow. Flash accesses go to the posix
+// `flash.c` file backend.
+#define SETTINGS_CONFIG_BASE_ADDRESS 0
+#define SETTINGS_CONFIG_PAGE_SIZE 0x800
+#define SETTINGS_CONFIG_PAGE_NUM 16
+#ifndef TEST_SETTINGS_DEFAULT_INDEX_SIZE
+#define SETTINGS_CONFIG_INDEX_SIZE 320
+#endif
+
+#include "utils/flash.h"
+
+static uint32_t sNumFlashReads = 0;
+
+// Counts the flash reads of the settings driver.
+static uint32_t testFlashRead(uint32_t aAddress, uint8_t *aData, uint32_t aSize)
+{
+    sNumFlashReads++;
+    return utilsFlashRead(aAddress, aData, aSize);
+}
+
+#define utilsFlashRead testFlashRead
+#include "utils/settings.cpp"
+#undef utilsFlashRead
+
+extern "C" {
+uint32_t NODE_ID = 1;
+}
+
+enum
+{
+    kKeyNetworkInfo = 0x0003,
+    kKeyChildInfo   = 0x0005,
+    kNumChildren    = 300,
+    kNumValues      = SETTINGS_CONFIG_INDEX_SIZE + 10,
+};
+
+struct TestChildInfo
+{
+    uint8_t  mExtAddress[8];
+    uint32_t mTimeout;
+    uint16_t mRloc16;
+    uint8_t  mMode;
+};
+
+static otInstance *sInstance = NULL;
+
+static void InitChildInfo(TestChildInfo &aChildInfo, uint16_t aChildId)
+{
+    memset(&aChildInfo, 0, sizeof(aChildInfo));
+    aChildInfo.mExtAddress[6] = static_cast<uint8_t>(aChildId >> 8);
+    aChildInfo.mExtAddress[7] = static_cast<uint8_t>(aChildId);
+    aChildInfo.mTimeout       = 240;
+    aChildInfo.mRloc16        = static_cast<uint16_t>(0x0400 + aChildId);
+    aChildInfo.mMode          = 0x0f;
+}
+
+static void VerifyValue(uint16_t aKey, int aIndex, uint32_t aExpected)
+{
+    uint32_t value  = 0;
+    uint16_t length = sizeof(value);
+
+    SuccessOrQuit(otPlatSettingsGet(sInstance, aKey, aIndex, reinterpret_cast<uint8_t *>(&value), &length),
+                  "Get() failed");
+    VerifyOrQuit(length == sizeof(value) && value == aExpected, "Get() returned a wrong value");
+}
+
+static void VerifyNotFound(uint16_t aKey, int aIndex)
+{
+    uint16_t length = 0;
+
+    VerifyOrQuit(otPlatSettingsGet(sInstance, aKey, aIndex, NULL, &length) == OT_ERROR_NOT_FOUND,
+                 "Get() found a deleted value");
+}
+
+static void AddValue(uint16_t aKey, uint32_t aValue)
+{
+    SuccessOrQuit(otPlatSettingsAdd(sInstance, aKey, reinterpret_cast<uint8_t *>(&aValue), sizeof(aValue)),
+                  "Add() failed");
+}
+
+static void SetValue(uint16_t aKey, uint32_t aValue)
+{
+    SuccessOrQuit(otPlatSettingsSet(sInstance, aKey, reinterpret_cast<uint8_t *>(&aValue), sizeof(aValue)),
+                  "Set() failed");
+}
+
+static void AddChildren(uint16_t aNumChildren)
+{
+    TestChildInfo childInfo;
+
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        InitChildInfo(childInfo, i);
+        SuccessOrQuit(otPlatSettingsAdd(sInstance, kKeyChildInfo, reinterpret_cast<uint8_t *>(&childInfo),
+                                        sizeof(childInfo)),
+                      "Add() failed");
+    }
+}
+
+// Reads all the children in batches as `Settings::ChildInfoIterator` does, and returns the number read.
+static uint16_t ReadAllChildren(void)
+{
+    TestChildInfo childInfo[8];
+    uint16_t      numChildren = 0;
+    uint16_t      numValues;
+
+    do
+    {
+        numValues = sizeof(childInfo) / sizeof(childInfo[0]);
+        SuccessOrQuit(otPlatSettingsGetAll(sInstance, kKeyChildInfo, numChildren,
+                                           reinterpret_cast<uint8_t *>(childInfo), sizeof(childInfo[0]), &numValues),
+                      "GetAll() failed");
+
+        for (uint16_t i = 0; i < numValues; i++)
+        {
+            TestChildInfo expected;
+
+            InitChildInfo(expected, numChildren);
+            VerifyOrQuit(memcmp(&childInfo[i], &expected, sizeof(expected)) == 0, "Restored child does not match");
+            numChildren++;
+        }
+    } while (numValues == sizeof(childInfo) / sizeof(childInfo[0]));
+
+    return numChildren;
+}
+
+void TestSettingsListOperations(void)
+{
+    printf("TestSettingsListOperations");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+
+    VerifyNotFound(kKeyChildInfo, 0);
+    VerifyOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, -1) == OT_ERROR_NOT_FOUND, "Delete() of empty key");
+
+    AddValue(kKeyChildInfo, 10);
+    AddValue(kKeyChildInfo, 11);
+    AddValue(kKeyChildInfo, 12);
+    AddValue(kKeyChildInfo, 13);
+    SetValue(kKeyNetworkInfo, 1);
+
+    // Deleting index 0 makes the next value the first one.
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 0), "Delete(0) failed");
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 1), "Delete(1) failed");
+    VerifyOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 2) == OT_ERROR_NOT_FOUND, "Delete(2) succeeded");
+
+    for (int reboot = 0; reboot < 2; reboot++)
+    {
+        VerifyValue(kKeyChildInfo, 0, 11);
+        VerifyValue(kKeyChildInfo, 1, 13);
+        VerifyNotFound(kKeyChildInfo, 2);
+        VerifyValue(kKeyNetworkInfo, 0, 1);
+
+        otPlatSettingsInit(sInstance);
+    }
+
+    // Set() replaces all the values of the key, also after a reboot and once the new value is deleted.
+    SetValue(kKeyChildInfo, 20);
+    VerifyValue(kKeyChildInfo, 0, 20);
+    VerifyNotFound(kKeyChildInfo, 1);
+
+    otPlatSettingsInit(sInstance);
+    VerifyValue(kKeyChildInfo, 0, 20);
+    VerifyNotFound(kKeyChildInfo, 1);
+
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 0), "Delete(0) failed");
+    otPlatSettingsInit(sInstance);
+    VerifyNotFound(kKeyChildInfo, 0);
+
+    AddValue(kKeyChildInfo, 30);
+    AddValue(kKeyChildInfo, 31);
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, -1), "Delete(-1) failed");
+    VerifyNotFound(kKeyChildInfo, 0);
+
+    otPlatSettingsInit(sInstance);
+    VerifyNotFound(kKeyChildInfo, 0);
+    VerifyValue(kKeyNetworkInfo, 0, 1);
+
+    printf(" -- PASS\n");
+}
+
+void TestSettingsCompaction(void)
+{
+    printf("TestSettingsCompaction");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+
+    AddValue(kKeyChildInfo, 100);
+    AddValue(kKeyChildInfo, 101);
+    AddValue(kKeyChildInfo, 102);
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 0), "Delete(0) failed");
+
+    // Overwriting a value many times fills the settings area several times over and forces compactions.
+    for (uint32_t i = 0; i < 4 * kSettingsSize / sizeof(struct settingsBlock); i++)
+    {
+        SetValue(kKeyNetworkInfo, i);
+        VerifyValue(kKeyNetworkInfo, 0, i);
+        VerifyValue(kKeyChildInfo, 0, 101);
+        VerifyValue(kKeyChildInfo, 1, 102);
+    }
+
+    otPlatSettingsInit(sInstance);
+    VerifyValue(kKeyNetworkInfo, 0, 4 * kSettingsSize / sizeof(struct settingsBlock) - 1);
+    VerifyValue(kKeyChildInfo, 0, 101);
+    VerifyValue(kKeyChildInfo, 1, 102);
+    VerifyNotFound(kKeyChildInfo, 2);
+
+    // Deleting the first child after a compaction still keeps the second one.
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 0), "Delete(0) failed");
+    otPlatSettingsInit(sInstance);
+    VerifyValue(kKeyChildInfo, 0, 102);
+    VerifyNotFound(kKeyChildInfo, 1);
+
+    printf(" -- PASS\n");
+}
+
+void TestSettingsIndexFull(void)
+{
+    uint32_t values[8];
+    uint16_t numValues;
+
+    printf("TestSettingsIndexFull");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+
+    SetValue(kKeyNetworkInfo, 1);
+
+    for (uint32_t i = 0; i < kNumValues; i++)
+    {
+        AddValue(kKeyChildInfo, i);
+    }
+
+    VerifyOrQuit(!sSettingsIndexComplete, "Index holds more records than its size");
+
+    // Values are found by scanning the flash, also after a reboot.
+    for (int reboot = 0; reboot < 2; reboot++)
+    {
+        VerifyValue(kKeyNetworkInfo, 0, 1);
+        VerifyValue(kKeyChildInfo, 0, 0);
+        VerifyValue(kKeyChildInfo, kNumValues - 1, kNumValues - 1);
+        VerifyNotFound(kKeyChildInfo, kNumValues);
+
+        numValues = sizeof(values) / sizeof(values[0]);
+        SuccessOrQuit(otPlatSettingsGetAll(sInstance, kKeyChildInfo, kNumValues - 4, reinterpret_cast<uint8_t *>(values),
+                                           sizeof(values[0]), &numValues),
+                      "GetAll() failed");
+        VerifyOrQuit(numValues == 4 && values[0] == kNumValues - 4 && values[3] == kNumValues - 1,
+                     "GetAll() returned wrong values");
+
+        otPlatSettingsInit(sInstance);
+        VerifyOrQuit(!sSettingsIndexComplete, "Index holds more records than its size");
+    }
+
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 0), "Delete(0) failed");
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, 5), "Delete(5) failed");
+    VerifyValue(kKeyChildInfo, 0, 1);
+    VerifyValue(kKeyChildInfo, 5, 7);
+    VerifyNotFound(kKeyChildInfo, kNumValues - 2);
+
+    // Compactions keep the values while the index stays full.
+    for (uint32_t i = 0; i < 2 * kSettingsSize / sizeof(struct settingsBlock); i++)
+    {
+        SetValue(kKeyNetworkInfo, i);
+    }
+
+    VerifyOrQuit(!sSettingsIndexComplete, "Index holds more records than its size");
+    VerifyValue(kKeyChildInfo, 0, 1);
+    VerifyValue(kKeyChildInfo, 5, 7);
+    VerifyValue(kKeyChildInfo, kNumValues - 3, kNumValues - 1);
+    VerifyNotFound(kKeyChildInfo, kNumValues - 2);
+
+    otPlatSettingsInit(sInstance);
+    VerifyValue(kKeyChildInfo, 0, 1);
+    VerifyValue(kKeyChildInfo, kNumValues - 3, kNumValues - 1);
+
+    // Set() replaces all the values of the key, after which the index is used again.
+    SetValue(kKeyChildInfo, 20);
+    VerifyValue(kKeyChildInfo, 0, 20);
+    VerifyNotFound(kKeyChildInfo, 1);
+
+    otPlatSettingsInit(sInstance);
+    VerifyOrQuit(sSettingsIndexComplete, "Index not rebuilt");
+    VerifyValue(kKeyChildInfo, 0, 20);
+    VerifyNotFound(kKeyChildInfo, 1);
+    VerifyValue(kKeyNetworkInfo, 0, 2 * kSettingsSize / sizeof(struct settingsBlock) - 1);
+
+    // Delete(-1) removes all the values without the index.
+    for (uint32_t i = 0; i < kNumValues; i++)
+    {
+        AddValue(kKeyChildInfo, i);
+    }
+
+    VerifyOrQuit(!sSettingsIndexComplete, "Index holds more records than its size");
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, -1), "Delete(-1) failed");
+    VerifyNotFound(kKeyChildInfo, 0);
+
+    otPlatSettingsInit(sInstance);
+    VerifyOrQuit(sSettingsIndexComplete, "Index not rebuilt");
+    VerifyNotFound(kKeyChildInfo, 0);
+
+    printf(" -- PASS\n");
+}
+
+void TestSettingsErasedAcrossReboot(void)
+{
+    uint32_t erasedSize;
+
+    printf("TestSettingsErasedAcrossReboot");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+
+    // Each write outside a change erases one page of the standby area.
+    AddValue(kKeyChildInfo, 1);
+    AddValue(kKeyChildInfo, 2);
+    erasedSize = sSettingsErasedSize;
+    VerifyOrQuit(erasedSize >= 2 * SETTINGS_CONFIG_PAGE_SIZE, "Standby area pages not erased");
+
+    // A reboot finds the pages still erased rather than erasing them again.
+    otPlatSettingsInit(sInstance);
+    VerifyOrQuit(sSettingsErasedSize == erasedSize, "Erased state of the standby area lost on reboot");
+
+    // A compaction writes to the standby area, which then has to be erased again.
+    for (uint32_t i = 0; i < kSettingsSize / sizeof(struct settingsBlock); i++)
+    {
+        SetValue(kKeyNetworkInfo, i);
+    }
+
+    erasedSize = sSettingsErasedSize;
+    otPlatSettingsInit(sInstance);
+    VerifyOrQuit(sSettingsErasedSize == erasedSize, "Erased state of the standby area lost on reboot");
+    VerifyValue(kKeyChildInfo, 1, 2);
+
+    printf(" -- PASS\n");
+}
+
+void TestSettingsChildRestore(void)
+{
+    TestChildInfo childInfo;
+    uint16_t      numChildren = 0;
+    uint64_t      start;
+    uint64_t      initTime;
+    uint64_t      restoreTime;
+
+    printf("TestSettingsChildRestore");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+
+    AddChildren(kNumChildren);
+
+    // Boot-time restore, as done by Settings::ChildInfoIterator.
+    start = testGetNowUs();
+    otPlatSettingsInit(sInstance);
+    initTime = testGetNowUs() - start;
+
+    start = testGetNowUs();
+
+    for (;;)
+    {
+        TestChildInfo expected;
+        uint16_t      length = sizeof(childInfo);
+
+        if (otPlatSettingsGet(sInstance, kKeyChildInfo, numChildren, reinterpret_cast<uint8_t *>(&childInfo),
+                              &length) != OT_ERROR_NONE)
+        {
+            break;
+        }
+
+        InitChildInfo(expected, numChildren);
+        VerifyOrQuit(length == sizeof(childInfo) && memcmp(&childInfo, &expected, sizeof(childInfo)) == 0,
+                     "Restored child does not match");
+        numChildren++;
+    }
+
+    restoreTime = testGetNowUs() - start;
+
+    VerifyOrQuit(numChildren == kNumChildren, "Restored a wrong number of children");
+
+    printf(" -- PASS (%u children, index size %u: init %u us, restore %u us)\n", numChildren, kSettingsIndexSize,
+           static_cast<unsigned int>(initTime), static_cast<unsigned int>(restoreTime));
+}
+
+void TestSettingsChildRestoreBatched(void)
+{
+    TestChildInfo childInfo;
+    uint16_t      numChildren;
+    uint64_t      start;
+    uint64_t      restoreTime;
+    uint64_t      refreshTime;
+    uint64_t      batchedRefreshTime;
+
+    printf("TestSettingsChildRestoreBatched");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+    AddChildren(kNumChildren);
+    otPlatSettingsInit(sInstance);
+
+    start       = testGetNowUs();
+    numChildren = ReadAllChildren();
+    restoreTime = testGetNowUs() - start;
+    VerifyOrQuit(numChildren == kNumChildren, "Restored a wrong number of children");
+
+    // Reading past the end of the list returns no value.
+    numChildren = 1;
+    SuccessOrQuit(otPlatSettingsGetAll(sInstance, kKeyChildInfo, kNumChildren, reinterpret_cast<uint8_t *>(&childInfo),
+                                       sizeof(childInfo), &numChildren),
+                  "GetAll() failed");
+    VerifyOrQuit(numChildren == 0, "GetAll() returned a value past the end of the list");
+
+    // Refresh of the stored children as previously done by `MleRouter::RefreshStoredChildren()`: each child is
+    // stored with `StoreChild()`, which first searches the list for an entry to remove.
+    start = testGetNowUs();
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, -1), "Delete(-1) failed");
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        for (int index = 0;; index++)
+        {
+            uint16_t length = sizeof(childInfo);
+
+            if (otPlatSettingsGet(sInstance, kKeyChildInfo, index, reinterpret_cast<uint8_t *>(&childInfo), &length) !=
+                OT_ERROR_NONE)
+            {
+                break;
+            }
+        }
+
+        InitChildInfo(childInfo, i);
+        SuccessOrQuit(otPlatSettingsAdd(sInstance, kKeyChildInfo, reinterpret_cast<uint8_t *>(&childInfo),
+                                        sizeof(childInfo)),
+                      "Add() failed");
+    }
+
+    refreshTime = testGetNowUs() - start;
+
+    // Refresh as now done, adding the children to the emptied list in a single change.
+    start = testGetNowUs();
+    SuccessOrQuit(otPlatSettingsBeginChange(sInstance), "BeginChange() failed");
+    VerifyOrQuit(otPlatSettingsBeginChange(sInstance) == OT_ERROR_ALREADY, "BeginChange() nested");
+    SuccessOrQuit(otPlatSettingsDelete(sInstance, kKeyChildInfo, -1), "Delete(-1) failed");
+    AddChildren(kNumChildren);
+    SuccessOrQuit(otPlatSettingsCommitChange(sInstance), "CommitChange() failed");
+    batchedRefreshTime = testGetNowUs() - start;
+    VerifyOrQuit(otPlatSettingsCommitChange(sInstance) == OT_ERROR_INVALID_STATE, "CommitChange() without change");
+
+    otPlatSettingsInit(sInstance);
+    VerifyOrQuit(ReadAllChildren() == kNumChildren, "Refreshed a wrong number of children");
+
+    printf(" -- PASS (%u children, index size %u: restore %u us, refresh %u us, batched refresh %u us)\n",
+           kNumChildren, kSettingsIndexSize, static_cast<unsigned int>(restoreTime),
+           static_cast<unsigned int>(refreshTime), static_cast<unsigned int>(batchedRefreshTime));
+}
+
+void TestSettingsChildRestoreIndexFull(void)
+{
+    uint32_t maxNumFlashReads;
+
+    printf("TestSettingsChildRestoreIndexFull");
+
+    otPlatSettingsInit(sInstance);
+    otPlatSettingsWipe(sInstance);
+    AddChildren(kNumValues);
+    otPlatSettingsInit(sInstance);
+    VerifyOrQuit(!sSettingsIndexComplete, "Index holds more records than its size");
+
+    // Each batch is read in a single scan of the log: one read per record and one per value returned.
+    maxNumFlashReads = (kNumValues / 8 + 1) * kNumValues + kNumValues;
+    sNumFlashReads   = 0;
+    VerifyOrQuit(ReadAllChildren() == kNumValues, "Restored a wrong number of children");
+    VerifyOrQuit(sNumFlashReads <= maxNumFlashReads, "GetAll() scanned the log more than once");
+
+    printf(" -- PASS (%u children, index size %u: %u flash reads)\n", kNumValues, kSettingsIndexSize,
+           static_cast<unsigned int>(sNumFlashReads));
+}
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    TestSettingsListOperations();
+    TestSettingsCompaction();
+    TestSettingsIndexFull();
+    TestSettingsErasedAcrossReboot();
+    TestSettingsChildRestore();
+    TestSettingsChildRestoreBatched();
+    TestSettingsChildRestoreIndexFull();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,509 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/border_router.h>
+#include <openthread/icmp6.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/message.h>
+#include <openthread/netdata.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "test_util.h"
+#include "posix/simulation/simulation.h"
+
+enum
+{
+    kNumNodes = 32,
+    kPanId    = 0x1234,
+    kChannel  = 11,
+
+    kGridSize = 8,
+    kGridNearRssi    = -60,
+    kGridFarRssi     = -85,
+    kNumEchoRequests = 20,
+
+    kNumBorderRouters   = 8,
+    kNetDataUpdateDelay = 10, ///< Time given to each Network Data update to propagate (seconds).
+};
+
+static const uint64_t kUsPerSecond    = 1000000;
+static const char     kTopologyFile[] = "test-simulation-topology.txt";
+
+struct EchoContext
+{
+    uint16_t mReplies;
+    uint64_t mRoundTripTime;
+};
+
+static bool IsAttached(otInstance *aInstance)
+{
+    otDeviceRole role = otThreadGetDeviceRole(aInstance);
+
+    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+}
+
+static bool IsLeader(void *aContext)
+{
+    return otThreadGetDeviceRole(static_cast<otInstance *>(aContext)) == OT_DEVICE_ROLE_LEADER;
+}
+
+static bool IsNodeAttached(void *aContext)
+{
+    return IsAttached(static_cast<otInstance *>(aContext));
+}
+
+static bool AreAllNodesAttached(void *)
+{
+    bool attached = true;
+
+    for (uint16_t id = 1; id <= simulationGetNodeCount() && attached; id++)
+    {
+        attached = IsAttached(simulationGetInstance(id));
+    }
+
+    return attached;
+}
+
+static bool IsSinglePartition(void *)
+{
+    bool     single      = AreAllNodesAttached(NULL);
+    uint32_t partitionId = otThreadGetPartitionId(simulationGetInstance(1));
+
+    for (uint16_t id = 2; id <= simulationGetNodeCount() && single; id++)
+    {
+        single = (otThreadGetPartitionId(simulationGetInstance(id)) == partitionId);
+    }
+
+    return single;
+}
+
+static bool HasEchoReply(void *aContext)
+{
+    return static_cast<EchoContext *>(aContext)->mReplies > 0;
+}
+
+static void HandleIcmpReceive(void *aContext, otMessage *, const otMessageInfo *, const otIcmp6Header *aIcmpHeader)
+{
+    if (aIcmpHeader->mType == OT_ICMP6_TYPE_ECHO_REPLY)
+    {
+        static_cast<EchoContext *>(aContext)->mReplies++;
+    }
+}
+
+static uint16_t GetGridNodeId(uint16_t aX, uint16_t aY)
+{
+    return static_cast<uint16_t>(aY * kGridSize + aX + 1);
+}
+
+static void WriteGridTopology(void)
+{
+    FILE *file = fopen(kTopologyFile, "w");
+
+    VerifyOrQuit(file != NULL, "Failed to create the topology file");
+
+    // Every node hears its 8 direct neighbors well and the next ring of nodes barely.
+    fprintf(file, "# %ux%u grid\n* * -128\n", kGridSize, kGridSize);
+
+    for (int y1 = 0; y1 < kGridSize; y1++)
+    {
+        for (int x1 = 0; x1 < kGridSize; x1++)
+        {
+            for (int y2 = y1 - 2; y2 <= y1 + 2; y2++)
+            {
+                for (int x2 = x1 - 2; x2 <= x1 + 2; x2++)
+                {
+                    bool isNear = (abs(x2 - x1) <= 1 && abs(y2 - y1) <= 1);
+
+                    if (x2 < 0 || x2 >= kGridSize || y2 < 0 || y2 >= kGridSize || (x1 == x2 && y1 == y2))
+                    {
+                        continue;
+                    }
+
+                    fprintf(file, "%u %u %d %s\n", GetGridNodeId(static_cast<uint16_t>(x1), static_cast<uint16_t>(y1)),
+                            GetGridNodeId(static_cast<uint16_t>(x2), static_cast<uint16_t>(y2)),
+                            isNear ? kGridNearRssi : kGridFarRssi, isNear ? "2 10" : "10 20");
+                }
+            }
+        }
+    }
+
+    fclose(file);
+}
+
+static void StartNode(uint16_t aNodeId)
+{
+    otInstance *instance = simulationGetInstance(aNodeId);
+
+    SuccessOrQuit(otLinkSetPanId(instance, kPanId), "Failed to set the PAN ID");
+    SuccessOrQuit(otLinkSetChannel(instance, kChannel), "Failed to set the channel");
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "Failed to bring up the interface");
+    SuccessOrQuit(otThreadSetEnabled(instance, true), "Failed to start Thread");
+}
+
+void TestSimulationNetwork(void)
+{
+    uint64_t    start = testGetNowUs();
+    uint64_t    wallTime;
+    uint64_t    attachTime;
+    otInstance *leader;
+    uint32_t    partitionId;
+    uint16_t    numLeaders = 0;
+    uint16_t    numRouters = 0;
+
+    printf("TestSimulationNetwork");
+
+    SuccessOrQuit(simulationInit(kNumNodes, 1), "Failed to initialize the simulation");
+
+    leader = simulationGetInstance(1);
+    StartNode(1);
+    VerifyOrQuit(simulationRunUntil(30 * kUsPerSecond, IsLeader, leader), "Node 1 did not become leader");
+
+    for (uint16_t id = 2; id <= kNumNodes; id++)
+    {
+        StartNode(id);
+    }
+
+    VerifyOrQuit(simulationRunUntil(300 * kUsPerSecond, AreAllNodesAttached, NULL), "Not all nodes attached");
+    attachTime = simulationGetNow();
+
+    // Give router-eligible children time to upgrade to routers.
+    simulationRun(300 * kUsPerSecond);
+
+    partitionId = otThreadGetPartitionId(leader);
+
+    for (uint16_t id = 1; id <= kNumNodes; id++)
+    {
+        otInstance *instance = simulationGetInstance(id);
+
+        VerifyOrQuit(IsAttached(instance), "Node detached");
+        VerifyOrQuit(otThreadGetPartitionId(instance) == partitionId, "Network is partitioned");
+
+        switch (otThreadGetDeviceRole(instance))
+        {
+        case OT_DEVICE_ROLE_LEADER:
+            numLeaders++;
+            break;
+
+        case OT_DEVICE_ROLE_ROUTER:
+            numRouters++;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    VerifyOrQuit(numLeaders == 1, "Network does not have exactly one leader");
+    VerifyOrQuit(numRouters > 0, "No child upgraded to router");
+
+    // A reset node restores its network information from its settings and re-attaches.
+    otInstanceReset(simulationGetInstance(kNumNodes));
+    simulationRun(0);
+    VerifyOrQuit(!IsAttached(simulationGetInstance(kNumNodes)), "Node was not reset");
+    StartNode(kNumNodes);
+    VerifyOrQuit(simulationRunUntil(10 * kUsPerSecond, IsNodeAttached, simulationGetInstance(kNumNodes)),
+                 "Reset node did not re-attach");
+    VerifyOrQuit(otThreadGetPartitionId(simulationGetInstance(kNumNodes)) == partitionId, "Reset node changed partition");
+
+    wallTime = testGetNowUs() - start;
+
+    printf(" -- PASS (%u nodes, %u routers, attached after %u ms, %u s simulated in %u ms)\n", kNumNodes,
+           numRouters + numLeaders, static_cast<unsigned int>(attachTime / 1000),
+           static_cast<unsigned int>(simulationGetNow() / kUsPerSecond), static_cast<unsigned int>(wallTime / 1000));
+
+    simulationDeinit();
+}
+
+void TestSimulationTopology(void)
+{
+    const uint16_t            numNodes = kGridSize * kGridSize;
+    uint64_t                  start    = testGetNowUs();
+    uint64_t                  convergenceTime;
+    otInstance *              source;
+    otInstance *              destination;
+    otNeighborInfoIterator    iterator = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo            neighborInfo;
+    EchoContext               echo;
+    otIcmp6Handler            handler;
+    otMessageInfo             messageInfo;
+    const SimulationCounters *counters;
+
+    printf("TestSimulationTopology");
+
+    SuccessOrQuit(simulationInit(numNodes, 2), "Failed to initialize the simulation");
+
+    VerifyOrQuit(simulationLoadTopology("nonexistent-topology.txt") == OT_ERROR_NOT_FOUND, "Loaded a missing file");
+    WriteGridTopology();
+    SuccessOrQuit(simulationLoadTopology(kTopologyFile), "Failed to load the topology");
+    remove(kTopologyFile);
+
+    source      = simulationGetInstance(GetGridNodeId(0, 0));
+    destination = simulationGetInstance(GetGridNodeId(kGridSize - 1, kGridSize - 1));
+
+    StartNode(GetGridNodeId(0, 0));
+    VerifyOrQuit(simulationRunUntil(30 * kUsPerSecond, IsLeader, source), "Corner node did not become leader");
+
+    for (uint16_t id = 1; id <= numNodes; id++)
+    {
+        if (simulationGetInstance(id) != source)
+        {
+            StartNode(id);
+        }
+    }
+
+    VerifyOrQuit(simulationRunUntil(1200 * kUsPerSecond, IsSinglePartition, NULL), "Grid did not converge");
+    convergenceTime = simulationGetNow();
+
+    // Let router upgrades and route costs settle before sending traffic across the grid. Router downgrades
+    // may briefly split the lossy grid, so wait for it to merge again.
+    simulationRun(300 * kUsPerSecond);
+    VerifyOrQuit(simulationRunUntil(600 * kUsPerSecond, IsSinglePartition, NULL), "Grid partitioned");
+
+    // Only the nodes of the topology are neighbors, at the RSSI of their link.
+    while (otThreadGetNextNeighborInfo(source, &iterator, &neighborInfo) == OT_ERROR_NONE)
+    {
+        VerifyOrQuit(abs(neighborInfo.mAverageRssi - kGridNearRssi) <= 1 ||
+                         abs(neighborInfo.mAverageRssi - kGridFarRssi) <= 1,
+                     "Neighbor RSSI does not match the topology");
+    }
+
+    memset(&echo, 0, sizeof(echo));
+    memset(&handler, 0, sizeof(handler));
+    handler.mReceiveCallback = HandleIcmpReceive;
+    handler.mContext         = &echo;
+    SuccessOrQuit(otIcmp6RegisterHandler(source, &handler), "Failed to register the ICMPv6 handler");
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr    = *otThreadGetMeshLocalEid(destination);
+    messageInfo.mInterfaceId = OT_NETIF_INTERFACE_ID_THREAD;
+
+    for (uint16_t i = 0; i < kNumEchoRequests; i++)
+    {
+        otMessage *message = otIp6NewMessage(source, true);
+        uint8_t    payload[64];
+        uint16_t   replies = echo.mReplies;
+        uint64_t   sent    = simulationGetNow();
+
+        memset(payload, static_cast<int>(i), sizeof(payload));
+        VerifyOrQuit(message != NULL, "Failed to allocate a message");
+        SuccessOrQuit(otMessageAppend(message, payload, sizeof(payload)), "Failed to append the payload");
+        SuccessOrQuit(otIcmp6SendEchoRequest(source, message, &messageInfo, i), "Failed to send an echo request");
+
+        echo.mReplies = 0;
+
+        if (simulationRunUntil(2 * kUsPerSecond, HasEchoReply, &echo))
+        {
+            echo.mRoundTripTime += simulationGetNow() - sent;
+        }
+
+        echo.mReplies = static_cast<uint16_t>(replies + echo.mReplies);
+        simulationRun(kUsPerSecond - (simulationGetNow() - sent) % kUsPerSecond);
+    }
+
+    VerifyOrQuit(echo.mReplies >= kNumEchoRequests / 2, "Too few echo replies across the grid");
+
+    counters = simulationGetCounters();
+
+    printf(" -- PASS (%u nodes, converged after %u ms, %u/%u echo replies, mean RTT %u us, %u tx %u rx %u lost "
+           "frames, %u s simulated in %u ms)\n",
+           numNodes, static_cast<unsigned int>(convergenceTime / 1000), echo.mReplies, kNumEchoRequests,
+           static_cast<unsigned int>(echo.mReplies ? echo.mRoundTripTime / echo.mReplies : 0), counters->mTxFrames,
+           counters->mRxFrames, counters->mLostFrames, static_cast<unsigned int>(simulationGetNow() / kUsPerSecond),
+           static_cast<unsigned int>((testGetNowUs() - start) / 1000));
+
+    simulationDeinit();
+}
+
+#if OPENTHREAD_ENABLE_BORDER_ROUTER && OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+static bool AreAllNodesRouters(void *)
+{
+    bool routers = true;
+
+    for (uint16_t id = 1; id <= simulationGetNodeCount() && routers; id++)
+    {
+        otDeviceRole role = otThreadGetDeviceRole(simulationGetInstance(id));
+
+        routers = (role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER);
+    }
+
+    return routers;
+}
+
+static bool IsNetworkDataSynchronized(void *aContext)
+{
+    const uint8_t *previousVersion = static_cast<const uint8_t *>(aContext);
+    uint8_t        version         = otNetDataGetVersion(simulationGetInstance(1));
+    bool           synchronized    = (previousVersion == NULL || version != *previousVersion);
+
+    for (uint16_t id = 2; id <= simulationGetNodeCount() && synchronized; id++)
+    {
+        synchronized = (otNetDataGetVersion(simulationGetInstance(id)) == version);
+    }
+
+    return synchronized;
+}
+
+static void RegisterPrefix(uint16_t aNodeId, otRoutePreference aPreference)
+{
+    otInstance *         instance = simulationGetInstance(aNodeId);
+    otBorderRouterConfig config;
+
+    memset(&config, 0, sizeof(config));
+    config.mPrefix.mPrefix.mFields.m8[0] = 0xfd;
+    config.mPrefix.mPrefix.mFields.m8[7] = static_cast<uint8_t>(aNodeId);
+    config.mPrefix.mLength               = 64;
+    config.mPreference                   = aPreference;
+    config.mPreferred                    = true;
+    config.mSlaac                        = true;
+    config.mOnMesh                       = true;
+    config.mStable                       = true;
+
+    SuccessOrQuit(otBorderRouterAddOnMeshPrefix(instance, &config), "Failed to add an on-mesh prefix");
+    SuccessOrQuit(otBorderRouterRegister(instance), "Failed to register the local network data");
+}
+
+static uint32_t MeasureNetworkDataUpdates(bool aDelta)
+{
+    uint32_t txBytes = 0;
+
+    for (uint16_t id = 1; id <= kNumNodes; id++)
+    {
+        otThreadSetNetworkDataDeltaEnabled(simulationGetInstance(id), aDelta);
+    }
+
+    // Each update changes the preference of the prefix of one border router, a one-byte change of the Network Data.
+    for (uint16_t id = 2; id < 2 + kNumBorderRouters; id++)
+    {
+        uint8_t  version = otNetDataGetVersion(simulationGetInstance(1));
+        uint32_t start   = simulationGetCounters()->mTxBytes;
+        uint64_t now     = simulationGetNow();
+
+        RegisterPrefix(id, aDelta ? OT_ROUTE_PREFERENCE_MED : OT_ROUTE_PREFERENCE_HIGH);
+        VerifyOrQuit(simulationRunUntil(kNetDataUpdateDelay * kUsPerSecond, IsNetworkDataSynchronized, &version),
+                     "Network Data update did not propagate");
+        simulationRun(kNetDataUpdateDelay * kUsPerSecond - (simulationGetNow() - now));
+
+        txBytes += simulationGetCounters()->mTxBytes - start;
+    }
+
+    return txBytes / kNumBorderRouters;
+}
+
+void TestSimulationNetworkDataDelta(void)
+{
+    uint64_t    start = testGetNowUs();
+    otInstance *leader;
+    uint8_t     leaderData[255];
+    uint8_t     leaderDataLength = sizeof(leaderData);
+    uint32_t    fullBytes;
+    uint32_t    deltaBytes;
+
+    printf("TestSimulationNetworkDataDelta");
+
+    SuccessOrQuit(simulationInit(kNumNodes, 3), "Failed to initialize the simulation");
+
+    for (uint16_t id = 1; id <= kNumNodes; id++)
+    {
+        otInstance *instance = simulationGetInstance(id);
+
+        otThreadSetRouterUpgradeThreshold(instance, kNumNodes);
+        otThreadSetRouterDowngradeThreshold(instance, kNumNodes);
+        otThreadSetRouterSelectionJitter(instance, 10);
+    }
+
+    leader = simulationGetInstance(1);
+    StartNode(1);
+    VerifyOrQuit(simulationRunUntil(30 * kUsPerSecond, IsLeader, leader), "Node 1 did not become leader");
+
+    for (uint16_t id = 2; id <= kNumNodes; id++)
+    {
+        StartNode(id);
+    }
+
+    VerifyOrQuit(simulationRunUntil(600 * kUsPerSecond, AreAllNodesRouters, NULL), "Not all nodes became routers");
+
+    for (uint16_t id = 2; id < 2 + kNumBorderRouters; id++)
+    {
+        RegisterPrefix(id, OT_ROUTE_PREFERENCE_MED);
+    }
+
+    simulationRun(kNetDataUpdateDelay * kUsPerSecond);
+    VerifyOrQuit(simulationRunUntil(kNetDataUpdateDelay * kUsPerSecond, IsNetworkDataSynchronized, NULL),
+                 "Network Data did not propagate");
+
+    // The full Network Data updates raise the preferences, the delta updates restore them.
+    fullBytes  = MeasureNetworkDataUpdates(false);
+    deltaBytes = MeasureNetworkDataUpdates(true);
+
+    VerifyOrQuit(AreAllNodesRouters(NULL), "Router left the network");
+    VerifyOrQuit(deltaBytes < fullBytes, "Network Data deltas did not reduce the bytes transmitted");
+
+    SuccessOrQuit(otNetDataGet(leader, false, leaderData, &leaderDataLength), "Failed to get the Network Data");
+
+    for (uint16_t id = 2; id <= kNumNodes; id++)
+    {
+        uint8_t data[255];
+        uint8_t dataLength = sizeof(data);
+
+        SuccessOrQuit(otNetDataGet(simulationGetInstance(id), false, data, &dataLength),
+                      "Failed to get the Network Data");
+        VerifyOrQuit(dataLength == leaderDataLength && memcmp(data, leaderData, dataLength) == 0,
+                     "Network Data differs from the leader");
+    }
+
+    printf(" -- PASS (%u routers, %u bytes of Network Data, %u bytes on air per update with full Network Data, %u "
+           "with deltas, %u s simulated in %u ms)\n",
+           kNumNodes, leaderDataLength, fullBytes, deltaBytes,
+           static_cast<unsigned int>(simulationGetNow() / kUsPerSecond),
+           static_cast<unsigned int>((testGetNowUs() - start) / 1000));
+
+    simulationDeinit();
+}
+#endif // OPENTHREAD_ENABLE_BORDER_ROUTER && OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    TestSimulationNetwork();
+    TestSimulationTopology();
+#if OPENTHREAD_ENABLE_BORDER_ROUTER && OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA_ENABLE
+    TestSimulationNetworkDataDelta();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -32,6 +32,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "ncp/spinel_decoder.hpp"
 #include "ncp/spinel_encoder.hpp"
 
 #include "test_util.h"
@@ -402,6 +403,256 @@ void TestSpinelEncoder(void)
     printf(" -- PASS\n");
 }
 
+enum RawFrameEncoding
+{
+    kEncodeWithFormat, // Metadata encoded by `WritePacked()` from a spinel format string.
+    kEncodeByField,    // Metadata encoded by one `Write<Type>()` call per field.
+    kEncodeWithFields, // Metadata encoded in a `SpinelFields` group, as in `NcpBase::LinkRawReceiveDone()`.
+};
+
+struct RawFrame
+{
+    uint8_t  mPsdu[127];
+    uint8_t  mLength;
+    int8_t   mRssi;
+    uint16_t mFlags;
+    uint8_t  mChannel;
+    uint8_t  mLqi;
+    uint32_t mMsec;
+    uint16_t mUsec;
+    uint32_t mError;
+};
+
+// Encodes a `STREAM_RAW` received frame as `NcpBase::LinkRawReceiveDone()` does.
+static otError EncodeRawFrame(SpinelEncoder &aEncoder, const RawFrame &aFrame, RawFrameEncoding aEncoding)
+{
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = aEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_CMD_PROP_VALUE_IS,
+                                              SPINEL_PROP_STREAM_RAW));
+    SuccessOrExit(error = aEncoder.WriteUint16(aFrame.mLength));
+    SuccessOrExit(error = aEncoder.WriteData(aFrame.mPsdu, aFrame.mLength));
+
+    switch (aEncoding)
+    {
+    case kEncodeWithFormat:
+        SuccessOrExit(error = aEncoder.WritePacked(
+                          SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_UINT16_S SPINEL_DATATYPE_STRUCT_S(
+                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT32_S
+                                  SPINEL_DATATYPE_UINT16_S) SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT_PACKED_S),
+                          aFrame.mRssi, -128, aFrame.mFlags, aFrame.mChannel, aFrame.mLqi, aFrame.mMsec, aFrame.mUsec,
+                          aFrame.mError));
+        break;
+
+    case kEncodeByField:
+        SuccessOrExit(error = aEncoder.WriteInt8(aFrame.mRssi));
+        SuccessOrExit(error = aEncoder.WriteInt8(-128));
+        SuccessOrExit(error = aEncoder.WriteUint16(aFrame.mFlags));
+        SuccessOrExit(error = aEncoder.OpenStruct());
+        SuccessOrExit(error = aEncoder.WriteUint8(aFrame.mChannel));
+        SuccessOrExit(error = aEncoder.WriteUint8(aFrame.mLqi));
+        SuccessOrExit(error = aEncoder.WriteUint32(aFrame.mMsec));
+        SuccessOrExit(error = aEncoder.WriteUint16(aFrame.mUsec));
+        SuccessOrExit(error = aEncoder.CloseStruct());
+        SuccessOrExit(error = aEncoder.OpenStruct());
+        SuccessOrExit(error = aEncoder.WriteUintPacked(aFrame.mError));
+        SuccessOrExit(error = aEncoder.CloseStruct());
+        break;
+
+    case kEncodeWithFields:
+    {
+        enum
+        {
+            kMetadataSize = SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kUint16Size +
+                            SpinelFieldsBase::kStructHeaderSize + SpinelFieldsBase::kUint8Size +
+                            SpinelFieldsBase::kUint8Size + SpinelFieldsBase::kUint32Size +
+                            SpinelFieldsBase::kUint16Size + SpinelFieldsBase::kStructHeaderSize +
+                            SpinelFieldsBase::kMaxUintPackedSize,
+        };
+
+        SpinelFields<kMetadataSize> metadata;
+
+        metadata.WriteInt8(aFrame.mRssi);
+        metadata.WriteInt8(-128);
+        metadata.WriteUint16(aFrame.mFlags);
+        metadata.OpenStruct();
+        metadata.WriteUint8(aFrame.mChannel);
+        metadata.WriteUint8(aFrame.mLqi);
+        metadata.WriteUint32(aFrame.mMsec);
+        metadata.WriteUint16(aFrame.mUsec);
+        metadata.CloseStruct();
+        metadata.OpenStruct();
+        metadata.WriteUintPacked(aFrame.mError);
+        metadata.CloseStruct();
+        SuccessOrExit(error = aEncoder.WriteFields(metadata));
+        break;
+    }
+    }
+
+    SuccessOrExit(error = aEncoder.EndFrame());
+
+exit:
+    return error;
+}
+
+// Decodes a `STREAM_RAW` received frame with the typed `SpinelDecoder` methods.
+static otError DecodeRawFrame(const uint8_t *aBuffer, uint16_t aLength, RawFrame &aFrame)
+{
+    SpinelDecoder  decoder;
+    otError        error = OT_ERROR_NONE;
+    uint8_t        header;
+    unsigned int   command;
+    unsigned int   key;
+    const uint8_t *psdu;
+    uint16_t       psduLength;
+    int8_t         noiseFloor;
+
+    decoder.Init(aBuffer, aLength);
+    SuccessOrExit(error = decoder.ReadUint8(header));
+    SuccessOrExit(error = decoder.ReadUintPacked(command));
+    SuccessOrExit(error = decoder.ReadUintPacked(key));
+    SuccessOrExit(error = decoder.ReadDataWithLen(psdu, psduLength));
+    SuccessOrExit(error = decoder.ReadInt8(aFrame.mRssi));
+    SuccessOrExit(error = decoder.ReadInt8(noiseFloor));
+    SuccessOrExit(error = decoder.ReadUint16(aFrame.mFlags));
+    SuccessOrExit(error = decoder.OpenStruct());
+    SuccessOrExit(error = decoder.ReadUint8(aFrame.mChannel));
+    SuccessOrExit(error = decoder.ReadUint8(aFrame.mLqi));
+    SuccessOrExit(error = decoder.ReadUint32(aFrame.mMsec));
+    SuccessOrExit(error = decoder.ReadUint16(aFrame.mUsec));
+    SuccessOrExit(error = decoder.CloseStruct());
+    SuccessOrExit(error = decoder.OpenStruct());
+    SuccessOrExit(error = decoder.ReadUintPacked(key));
+    SuccessOrExit(error = decoder.CloseStruct());
+
+    VerifyOrExit(psduLength <= sizeof(aFrame.mPsdu), error = OT_ERROR_PARSE);
+    memcpy(aFrame.mPsdu, psdu, psduLength);
+    aFrame.mLength = static_cast<uint8_t>(psduLength);
+    aFrame.mError  = key;
+
+exit:
+    return error;
+}
+
+void TestSpinelEncoderRawFrameBenchmark(void)
+{
+    enum
+    {
+        kNumFrames = 20000,
+    };
+
+    static const char *const kEncodingNames[] = {"format string", "per field", "SpinelFields"};
+
+    uint8_t        buffer[kTestBufferSize];
+    NcpFrameBuffer ncpBuffer(buffer, kTestBufferSize);
+    SpinelEncoder  encoder(ncpBuffer);
+    uint8_t        frame[3][kTestBufferSize];
+    uint16_t       frameLen[3];
+    RawFrame       rawFrame;
+    RawFrame       decoded;
+    uint64_t       start;
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 6: STREAM_RAW frame encoding/decoding benchmark\n");
+
+    for (uint8_t i = 0; i < sizeof(rawFrame.mPsdu); i++)
+    {
+        rawFrame.mPsdu[i] = i;
+    }
+
+    rawFrame.mLength  = sizeof(rawFrame.mPsdu);
+    rawFrame.mRssi    = -45;
+    rawFrame.mFlags   = 0;
+    rawFrame.mChannel = 15;
+    rawFrame.mLqi     = 0xf0;
+    rawFrame.mMsec    = 0x12345678;
+    rawFrame.mUsec    = 0x9abc;
+
+    // A packed value too large for three bytes is encoded as `SpinelEncoder::WriteUintPacked()` does (a format string
+    // rejects it).
+    rawFrame.mError = 0xffffffff;
+
+    for (int encoding = kEncodeByField; encoding <= kEncodeWithFields; encoding++)
+    {
+        SuccessOrQuit(EncodeRawFrame(encoder, rawFrame, static_cast<RawFrameEncoding>(encoding)), "Encoding failed.");
+        SuccessOrQuit(ReadFrame(ncpBuffer, frame[encoding], frameLen[encoding]), "ReadFrame() failed.");
+    }
+
+    VerifyOrQuit(frameLen[kEncodeWithFields] == frameLen[kEncodeByField] &&
+                     memcmp(frame[kEncodeWithFields], frame[kEncodeByField], frameLen[kEncodeByField]) == 0,
+                 "Encodings of a large packed value differ.");
+
+    // All the encodings give the same frame.
+    rawFrame.mError = 0;
+
+    for (int encoding = kEncodeWithFormat; encoding <= kEncodeWithFields; encoding++)
+    {
+        SuccessOrQuit(EncodeRawFrame(encoder, rawFrame, static_cast<RawFrameEncoding>(encoding)), "Encoding failed.");
+        SuccessOrQuit(ReadFrame(ncpBuffer, frame[encoding], frameLen[encoding]), "ReadFrame() failed.");
+        VerifyOrQuit(frameLen[encoding] == frameLen[0] && memcmp(frame[encoding], frame[0], frameLen[0]) == 0,
+                     "Encodings differ.");
+    }
+
+    for (int encoding = kEncodeWithFormat; encoding <= kEncodeWithFields; encoding++)
+    {
+        start = testGetNowUs();
+
+        for (uint32_t i = 0; i < kNumFrames; i++)
+        {
+            EncodeRawFrame(encoder, rawFrame, static_cast<RawFrameEncoding>(encoding));
+            ncpBuffer.OutFrameRemove();
+        }
+
+        printf("    encode (%s): %u ns/frame\n", kEncodingNames[encoding],
+               static_cast<unsigned int>((testGetNowUs() - start) * 1000 / kNumFrames));
+    }
+
+    start = testGetNowUs();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        uint8_t        header;
+        unsigned int   command;
+        unsigned int   key;
+        const uint8_t *psdu;
+        unsigned int   psduLength;
+        int8_t         noiseFloor;
+
+        VerifyOrQuit(spinel_datatype_unpack(
+                         frame[0], frameLen[0],
+                         SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S
+                             SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S
+                                 SPINEL_DATATYPE_UINT16_S SPINEL_DATATYPE_STRUCT_S(
+                                     SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT32_S
+                                         SPINEL_DATATYPE_UINT16_S)
+                                     SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT_PACKED_S),
+                         &header, &command, &key, &psdu, &psduLength, &decoded.mRssi, &noiseFloor, &decoded.mFlags,
+                         &decoded.mChannel, &decoded.mLqi, &decoded.mMsec, &decoded.mUsec, &decoded.mError) > 0,
+                     "spinel_datatype_unpack() failed.");
+    }
+
+    printf("    decode (format string): %u ns/frame\n",
+           static_cast<unsigned int>((testGetNowUs() - start) * 1000 / kNumFrames));
+
+    start = testGetNowUs();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        SuccessOrQuit(DecodeRawFrame(frame[0], frameLen[0], decoded), "DecodeRawFrame() failed.");
+    }
+
+    printf("    decode (SpinelDecoder): %u ns/frame\n",
+           static_cast<unsigned int>((testGetNowUs() - start) * 1000 / kNumFrames));
+
+    VerifyOrQuit(decoded.mLength == rawFrame.mLength && memcmp(decoded.mPsdu, rawFrame.mPsdu, rawFrame.mLength) == 0 &&
+                     decoded.mRssi == rawFrame.mRssi && decoded.mChannel == rawFrame.mChannel &&
+                     decoded.mLqi == rawFrame.mLqi && decoded.mMsec == rawFrame.mMsec &&
+                     decoded.mUsec == rawFrame.mUsec && decoded.mError == rawFrame.mError,
+                 "Decoded frame does not match.");
+
+    printf(" -- PASS\n");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -409,6 +660,7 @@ void TestSpinelEncoder(void)
 int main(void)
 {
     ot::Ncp::TestSpinelEncoder();
+    ot::Ncp::TestSpinelEncoderRawFrameBenchmark();
     printf("\nAll tests passed.\n");
     return 0;
 }
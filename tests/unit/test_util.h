@@ -36,6 +36,9 @@
 
 #ifndef _WIN32
 
+#include <stdint.h>
+#include <sys/time.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -74,6 +77,22 @@ extern "C" {
 
 #define Log(aFormat, ...) printf(aFormat "\n", ##__VA_ARGS__)
 
+/**
+ * This function returns the wall-clock time in microseconds.
+ *
+ * It is only meant to report the duration of benchmarks, which depends on the host and must not decide whether a
+ * test passes.
+ *
+ */
+static inline uint64_t testGetNowUs(void)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_usec;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,324 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2018, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Decoder for OpenThread binary logs (OPENTHREAD_CONFIG_LOG_BINARY).
+
+A binary log record only holds the identifier of its format string, which is
+the offset of the string from the `otLogBinaryFormatAnchor` symbol in the
+firmware image. The format strings are read from the (unstripped) ELF image,
+either directly or through a format table generated from it beforehand.
+"""
+
+from __future__ import print_function
+
+import argparse
+import binascii
+import bisect
+import json
+import re
+import struct
+import sys
+
+ANCHOR_SYMBOL = 'otLogBinaryFormatAnchor'
+
+HEADER = struct.Struct('<BBHIi')
+
+LEVELS = ['NONE', 'CRIT', 'WARN', 'INFO', 'DEBG']
+
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+
+SPEC = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXcsDpeEfFgGaAn%])')
+
+
+def read_format_table(elf_file):
+    """Returns a dict of {offset from the anchor: string} for all strings in the read-only data of an ELF image."""
+    with open(elf_file, 'rb') as f:
+        elf = f.read()
+
+    if elf[:4] != b'\x7fELF':
+        raise ValueError('%s is not an ELF file' % elf_file)
+
+    is64 = (elf[4:5] == b'\x02')
+    endian = '<' if elf[5:6] == b'\x01' else '>'
+
+    if is64:
+        shoff, = struct.unpack_from(endian + 'Q', elf, 0x28)
+        shentsize, shnum = struct.unpack_from(endian + 'HH', elf, 0x3a)
+        section = struct.Struct(endian + 'IIQQQQIIQQ')
+        symbol = struct.Struct(endian + 'IBBHQQ')
+    else:
+        shoff, = struct.unpack_from(endian + 'I', elf, 0x20)
+        shentsize, shnum = struct.unpack_from(endian + 'HH', elf, 0x2e)
+        section = struct.Struct(endian + 'IIIIIIIIII')
+        symbol = struct.Struct(endian + 'IIIBBH')
+
+    sections = [section.unpack_from(elf, shoff + i * shentsize) for i in range(shnum)]
+    anchor = None
+
+    for sh_name, sh_type, sh_flags, sh_addr, sh_offset, sh_size, sh_link, _, _, sh_entsize in sections:
+        if sh_type != SHT_SYMTAB:
+            continue
+
+        strtab = sections[sh_link]
+
+        for i in range(sh_size // sh_entsize):
+            fields = symbol.unpack_from(elf, sh_offset + i * sh_entsize)
+            name_offset = fields[0]
+            value = fields[4] if is64 else fields[1]
+            name_start = strtab[4] + name_offset
+            name_end = elf.index(b'\0', name_start)
+
+            if elf[name_start:name_end] == ANCHOR_SYMBOL.encode():
+                anchor = value
+                break
+
+    if anchor is None:
+        raise ValueError('symbol %s not found in %s (stripped image?)' % (ANCHOR_SYMBOL, elf_file))
+
+    table = {}
+
+    for sh_name, sh_type, sh_flags, sh_addr, sh_offset, sh_size, _, _, _, _ in sections:
+        if sh_type != SHT_PROGBITS or (sh_flags & (SHF_ALLOC | SHF_WRITE | SHF_EXECINSTR)) != SHF_ALLOC:
+            continue
+
+        data = elf[sh_offset:sh_offset + sh_size]
+        start = 0
+
+        for end in [m.start() for m in re.finditer(b'\0', data)]:
+            if end > start:
+                table[sh_addr + start - anchor] = data[start:end].decode('latin-1')
+
+            start = end + 1
+
+    return table
+
+
+class FormatTable(object):
+    """Maps format string identifiers to format strings.
+
+    The linker may merge a string with the tail of a longer one, so an identifier which is not the start of a string
+    is looked up in the string before it.
+    """
+
+    def __init__(self, table):
+        self._table = table
+        self._offsets = sorted(table)
+
+    def lookup(self, format_id):
+        if format_id in self._table:
+            return self._table[format_id]
+
+        index = bisect.bisect_right(self._offsets, format_id) - 1
+
+        if index >= 0:
+            offset = self._offsets[index]
+            string = self._table[offset]
+
+            if format_id - offset < len(string):
+                return string[format_id - offset:]
+
+        return None
+
+
+def dump_lines(data):
+    """Formats bytes as `otDump()` does."""
+    lines = []
+
+    for i in range(0, len(data), 16):
+        chunk = bytearray(data[i:i + 16])
+        line = '|'
+
+        for j in range(16):
+            line += ' %02X' % chunk[j] if j < len(chunk) else ' ..'
+
+            if (j + 1) % 8 == 0:
+                line += ' |'
+
+        line += ' '
+
+        for j in range(16):
+            c = chunk[j] & 0x7f if j < len(chunk) else 0
+            line += chr(c) if 0x20 <= c < 0x7f else '.'
+
+        lines.append(line)
+
+    return lines
+
+
+def format_record(fmt, args):
+    """Formats a record from its format string and encoded arguments."""
+    output = []
+    position = [0]
+    last = 0
+
+    def take(size):
+        if position[0] + size > len(args):
+            raise IndexError()
+
+        value = args[position[0]:position[0] + size]
+        position[0] += size
+        return value
+
+    def take_int(size, signed):
+        code = {4: 'i', 8: 'q'}[size]
+        return struct.unpack('<' + (code if signed else code.upper()), take(size))[0]
+
+    try:
+        for match in SPEC.finditer(fmt):
+            flags, width, precision, length, conversion = match.groups()
+            output.append(fmt[last:match.start()])
+            last = match.end()
+
+            if conversion == '%':
+                output.append('%')
+                continue
+
+            if width == '*':
+                width = str(take_int(4, True))
+
+            if precision == '*':
+                precision = str(take_int(4, True))
+
+            spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+            size = 8 if length in ('l', 'll', 'j', 'z', 't') else 4
+
+            if conversion in 'di':
+                output.append((spec + 'd') % take_int(size, True))
+            elif conversion in 'ouxX':
+                output.append((spec + conversion.replace('u', 'd')) % take_int(size, False))
+            elif conversion == 'c':
+                output.append((spec + 'c') % chr(take_int(4, False) & 0xff))
+            elif conversion == 's':
+                string_length = bytearray(take(1))[0]
+                output.append((spec + 's') % take(string_length).decode('latin-1'))
+            elif conversion == 'p':
+                output.append('0x%x' % take_int(8, False))
+            elif conversion in 'eEfFgGaA':
+                output.append((spec + conversion.replace('a', 'e').replace('A', 'E').replace('F', 'f')) %
+                              struct.unpack('<d', take(8))[0])
+            elif conversion == 'D':
+                dump_length, = struct.unpack('<H', take(2))
+                data = take(dump_length)
+                output.append('\n' + '\n'.join(dump_lines(data)))
+
+        output.append(fmt[last:])
+
+    except IndexError:
+        output.append(' <truncated>')
+
+    return ''.join(output).rstrip('\r\n')
+
+
+def decode_stream(data, table, output):
+    """Decodes a stream of binary log records."""
+    offset = 0
+
+    while offset + HEADER.size <= len(data):
+        level, region, args_length, timestamp, format_id = HEADER.unpack_from(data, offset)
+        args = data[offset + HEADER.size:offset + HEADER.size + args_length]
+        offset += HEADER.size + args_length
+
+        fmt = table.lookup(format_id)
+
+        if fmt is None:
+            message = '<unknown format id %d, level %s, region %d>' % (
+                format_id, LEVELS[level] if level < len(LEVELS) else level, region)
+        else:
+            message = format_record(fmt, args)
+
+        output.write('%8u.%03u %s\n' % (timestamp // 1000, timestamp % 1000, message))
+
+    if offset != len(data):
+        output.write('<%d trailing bytes>\n' % (len(data) - offset))
+
+
+def read_hex_lines(lines):
+    """Extracts the binary log data from text log lines written by the default `otPlatLogBinary()`."""
+    data = bytearray()
+
+    for line in lines:
+        index = line.find('[BIN] ')
+
+        if index >= 0:
+            data += binascii.unhexlify(line[index + 6:].strip())
+
+    return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(dest='command')
+
+    table_parser = subparsers.add_parser('table', help='generate the format table of a firmware image')
+    table_parser.add_argument('elf', help='the (unstripped) firmware ELF image')
+    table_parser.add_argument('-o', '--output', help='the format table file (default: stdout)')
+
+    decode_parser = subparsers.add_parser('decode', help='decode a binary log')
+    decode_parser.add_argument('input', help='the binary log file (- for stdin)')
+    source = decode_parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('-e', '--elf', help='the (unstripped) firmware ELF image')
+    source.add_argument('-t', '--table', help='a format table generated by the table command')
+    decode_parser.add_argument('-x', '--hex', action='store_true', help='the input is a text log with [BIN] lines')
+
+    args = parser.parse_args()
+
+    if args.command == 'table':
+        table = read_format_table(args.elf)
+        output = open(args.output, 'w') if args.output else sys.stdout
+        json.dump(dict((str(k), v) for k, v in table.items()), output, indent=0, sort_keys=True)
+        output.write('\n')
+
+    elif args.command == 'decode':
+        if args.elf:
+            table = read_format_table(args.elf)
+        else:
+            with open(args.table) as f:
+                table = dict((int(k), v) for k, v in json.load(f).items())
+
+        if args.hex:
+            lines = sys.stdin if args.input == '-' else open(args.input)
+            data = read_hex_lines(lines)
+        else:
+            stream = getattr(sys.stdin, 'buffer', sys.stdin) if args.input == '-' else open(args.input, 'rb')
+            data = stream.read()
+
+        decode_stream(data, FormatTable(table), sys.stdout)
+
+    else:
+        parser.print_help()
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
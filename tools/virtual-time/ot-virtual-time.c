@@ -0,0 +1,799 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the virtual time event coordinator for POSIX nodes built with
+ *   OPENTHREAD_POSIX_VIRTUAL_TIME.
+ *
+ *   Nodes report their next alarm and every transmitted frame as `struct Event` datagrams (see
+ *   examples/platforms/posix/platform-posix.h). The coordinator keeps them in a priority queue, advances the virtual
+ *   time to the next event and delivers all events due at that time in one batch, at most one event per node, before
+ *   waiting for the nodes to go back to sleep.
+ *
+ *   The coordinator is driven by line commands on stdin:
+ *
+ *     go <usec>       Run the nodes for the given duration. Replies `<now> <event-count>`.
+ *     sniff <node>    Flush the frames sent by a node. Replies `<count>` followed by one hex-encoded frame per line.
+ *     exit            Exit the coordinator.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+enum
+{
+    EVENT_ALARM_FIRED    = 0,
+    EVENT_RADIO_RECEIVED = 1,
+    EVENT_DATA_MAX_SIZE  = 1024,
+};
+
+enum
+{
+    BASE_PORT        = 9000,
+    MAX_NODES        = 34,    ///< Nodes per port offset, must match WELLKNOWN_NODE_ID of the nodes.
+    MAX_COMMAND_SIZE = 128,
+    NODE_TIMEOUT     = 10000, ///< Wall time (in milliseconds) a node may take to process an event.
+};
+
+struct Event
+{
+    uint64_t mDelay;
+    uint8_t  mEvent;
+    uint16_t mDataLength;
+    uint8_t  mData[EVENT_DATA_MAX_SIZE];
+} __attribute__((packed));
+
+#define EVENT_HEADER_SIZE offsetof(struct Event, mData)
+
+/**
+ * This structure represents a transmitted frame (channel byte followed by the PSDU), shared by all of its deliveries.
+ *
+ */
+struct Frame
+{
+    uint32_t mRefCount;
+    uint16_t mLength;
+    uint8_t  mData[1];
+};
+
+/**
+ * This structure represents an entry of the event queue.
+ *
+ * Alarm entries are superseded rather than removed: each new sleep event from a node bumps the node's alarm
+ * generation, and entries with an older generation are dropped when they reach the head of the queue.
+ *
+ */
+struct QueueEntry
+{
+    uint64_t      mTime;
+    uint64_t      mSequence;
+    uint32_t      mGeneration;
+    uint16_t      mNode;
+    struct Frame *mFrame; ///< The transmitted frame, or NULL for an alarm.
+};
+
+struct Delivery
+{
+    uint32_t      mGeneration;
+    struct Frame *mFrame;
+};
+
+struct Node
+{
+    bool               mValid;
+    bool               mBusy;
+    uint64_t           mTime;
+    uint32_t           mAlarmGeneration;
+    struct sockaddr_in mAddr;
+
+    struct Delivery *mDue; ///< Events due at the current time, delivered one per batch.
+    size_t           mDueHead;
+    size_t           mDueCount;
+    size_t           mDueCapacity;
+
+    char *   mSniffed; ///< Hex-encoded frames sent by the node, one per line, parsed only on request.
+    size_t   mSniffedLength;
+    size_t   mSniffedCapacity;
+    uint32_t mSniffedCount;
+};
+
+static int         sSockFd;
+static uint16_t    sBasePort = BASE_PORT;
+static uint64_t    sNow      = 0;
+static uint64_t    sSequence = 0;
+static uint64_t    sEventCount;
+static uint16_t    sBusyCount;
+static bool        sVerbose = false;
+static struct Node sNodes[MAX_NODES + 1];
+
+static struct QueueEntry *sQueue;
+static size_t             sQueueLength;
+static size_t             sQueueCapacity;
+
+static void *checkedRealloc(void *aPointer, size_t aSize)
+{
+    void *rval = realloc(aPointer, aSize);
+
+    if (rval == NULL)
+    {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+    }
+
+    return rval;
+}
+
+static void frameRelease(struct Frame *aFrame)
+{
+    if (--aFrame->mRefCount == 0)
+    {
+        free(aFrame);
+    }
+}
+
+static bool queueEntryBefore(const struct QueueEntry *aFirst, const struct QueueEntry *aSecond)
+{
+    // Alarms are delivered before frames due at the same time, as the Python coordinator did.
+    if (aFirst->mTime != aSecond->mTime)
+    {
+        return aFirst->mTime < aSecond->mTime;
+    }
+
+    if ((aFirst->mFrame == NULL) != (aSecond->mFrame == NULL))
+    {
+        return aFirst->mFrame == NULL;
+    }
+
+    return aFirst->mSequence < aSecond->mSequence;
+}
+
+static void queuePush(uint64_t aTime, uint16_t aNode, uint32_t aGeneration, struct Frame *aFrame)
+{
+    size_t            index;
+    struct QueueEntry entry;
+
+    if (sQueueLength == sQueueCapacity)
+    {
+        sQueueCapacity = sQueueCapacity ? sQueueCapacity * 2 : 256;
+        sQueue         = (struct QueueEntry *)checkedRealloc(sQueue, sQueueCapacity * sizeof(*sQueue));
+    }
+
+    entry.mTime       = aTime;
+    entry.mSequence   = sSequence++;
+    entry.mGeneration = aGeneration;
+    entry.mNode       = aNode;
+    entry.mFrame      = aFrame;
+
+    for (index = sQueueLength++; index > 0; index = (index - 1) / 2)
+    {
+        size_t parent = (index - 1) / 2;
+
+        if (!queueEntryBefore(&entry, &sQueue[parent]))
+        {
+            break;
+        }
+
+        sQueue[index] = sQueue[parent];
+    }
+
+    sQueue[index] = entry;
+}
+
+static struct QueueEntry queuePop(void)
+{
+    struct QueueEntry rval = sQueue[0];
+    struct QueueEntry last = sQueue[--sQueueLength];
+    size_t            index = 0;
+
+    for (;;)
+    {
+        size_t child = 2 * index + 1;
+
+        if (child >= sQueueLength)
+        {
+            break;
+        }
+
+        if (child + 1 < sQueueLength && queueEntryBefore(&sQueue[child + 1], &sQueue[child]))
+        {
+            child++;
+        }
+
+        if (!queueEntryBefore(&sQueue[child], &last))
+        {
+            break;
+        }
+
+        sQueue[index] = sQueue[child];
+        index         = child;
+    }
+
+    if (sQueueLength > 0)
+    {
+        sQueue[index] = last;
+    }
+
+    return rval;
+}
+
+static void nodeAppendDue(struct Node *aNode, uint32_t aGeneration, struct Frame *aFrame)
+{
+    struct Delivery *delivery;
+
+    if (aNode->mDueHead + aNode->mDueCount == aNode->mDueCapacity)
+    {
+        if (aNode->mDueHead > 0)
+        {
+            memmove(aNode->mDue, aNode->mDue + aNode->mDueHead, aNode->mDueCount * sizeof(*aNode->mDue));
+            aNode->mDueHead = 0;
+        }
+        else
+        {
+            aNode->mDueCapacity = aNode->mDueCapacity ? aNode->mDueCapacity * 2 : 8;
+            aNode->mDue = (struct Delivery *)checkedRealloc(aNode->mDue, aNode->mDueCapacity * sizeof(*aNode->mDue));
+        }
+    }
+
+    delivery              = &aNode->mDue[aNode->mDueHead + aNode->mDueCount++];
+    delivery->mGeneration = aGeneration;
+    delivery->mFrame      = aFrame;
+
+    if (aFrame != NULL)
+    {
+        aFrame->mRefCount++;
+    }
+}
+
+static void nodeSniff(struct Node *aNode, const uint8_t *aData, uint16_t aLength)
+{
+    static const char kHex[] = "0123456789abcdef";
+    size_t            needed = aNode->mSniffedLength + 2 * (size_t)aLength + 1;
+
+    if (needed > aNode->mSniffedCapacity)
+    {
+        while (needed > aNode->mSniffedCapacity)
+        {
+            aNode->mSniffedCapacity = aNode->mSniffedCapacity ? aNode->mSniffedCapacity * 2 : 4096;
+        }
+
+        aNode->mSniffed = (char *)checkedRealloc(aNode->mSniffed, aNode->mSniffedCapacity);
+    }
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aNode->mSniffed[aNode->mSniffedLength++] = kHex[aData[i] >> 4];
+        aNode->mSniffed[aNode->mSniffedLength++] = kHex[aData[i] & 0xf];
+    }
+
+    aNode->mSniffed[aNode->mSniffedLength++] = '\n';
+    aNode->mSniffedCount++;
+}
+
+static void nodeSend(struct Node *aNode, uint8_t aType, const struct Frame *aFrame)
+{
+    struct Event event;
+    size_t       length = EVENT_HEADER_SIZE;
+
+    event.mDelay      = sNow - aNode->mTime;
+    event.mEvent      = aType;
+    event.mDataLength = 0;
+
+    if (aFrame != NULL)
+    {
+        event.mDataLength = aFrame->mLength;
+        memcpy(event.mData, aFrame->mData, aFrame->mLength);
+        length += aFrame->mLength;
+    }
+
+    aNode->mTime = sNow;
+
+    if (sendto(sSockFd, (const char *)&event, length, 0, (const struct sockaddr *)&aNode->mAddr,
+               sizeof(aNode->mAddr)) < 0)
+    {
+        perror("sendto");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void handleEvent(const struct sockaddr_in *aAddr, const struct Event *aEvent, size_t aLength)
+{
+    uint16_t     port = ntohs(aAddr->sin_port);
+    uint16_t     id;
+    struct Node *node;
+
+    if (aLength < EVENT_HEADER_SIZE || aLength - EVENT_HEADER_SIZE < aEvent->mDataLength || port <= sBasePort ||
+        port - sBasePort > MAX_NODES)
+    {
+        fprintf(stderr, "Ignoring invalid event from port %u\n", port);
+        return;
+    }
+
+    id   = (uint16_t)(port - sBasePort);
+    node = &sNodes[id];
+
+    if (!node->mValid)
+    {
+        node->mValid = true;
+        node->mTime  = sNow;
+        node->mAddr  = *aAddr;
+    }
+
+    switch (aEvent->mEvent)
+    {
+    case EVENT_ALARM_FIRED:
+        // A node sends its next alarm whenever it goes back to sleep, which also ends the processing of an event.
+        queuePush(sNow + aEvent->mDelay, id, ++node->mAlarmGeneration, NULL);
+
+        if (node->mBusy)
+        {
+            node->mBusy = false;
+            sBusyCount--;
+        }
+
+        break;
+
+    case EVENT_RADIO_RECEIVED:
+    {
+        struct Frame *frame = (struct Frame *)checkedRealloc(NULL, offsetof(struct Frame, mData) + aEvent->mDataLength);
+
+        frame->mRefCount = 1;
+        frame->mLength   = aEvent->mDataLength;
+        memcpy(frame->mData, aEvent->mData, aEvent->mDataLength);
+
+        nodeSniff(node, aEvent->mData, aEvent->mDataLength);
+        queuePush(sNow + aEvent->mDelay, id, 0, frame);
+        break;
+    }
+
+    default:
+        fprintf(stderr, "Ignoring unknown event %u from node %u\n", aEvent->mEvent, id);
+        break;
+    }
+}
+
+static void removeBusyNodes(void)
+{
+    // Nodes that were stopped never reply, forget them so that the others keep running.
+    for (uint16_t id = 1; id <= MAX_NODES; id++)
+    {
+        if (sNodes[id].mBusy)
+        {
+            fprintf(stderr, "Node %u did not respond, removing it\n", id);
+            sNodes[id].mValid = false;
+            sNodes[id].mBusy  = false;
+            sNodes[id].mAlarmGeneration++;
+        }
+    }
+
+    sBusyCount = 0;
+}
+
+/**
+ * This function receives the pending events of the nodes, and waits for all busy nodes to go back to sleep if
+ * @p aWait is true.
+ *
+ */
+static void receiveEvents(bool aWait)
+{
+    for (;;)
+    {
+        bool               wait = aWait && sBusyCount > 0;
+        struct Event       event;
+        struct sockaddr_in addr;
+        socklen_t          addrLength = sizeof(addr);
+        ssize_t            rval;
+
+        // Blocking receives time out after NODE_TIMEOUT (see socketInit()).
+        rval = recvfrom(sSockFd, (char *)&event, sizeof(event), wait ? 0 : MSG_DONTWAIT, (struct sockaddr *)&addr,
+                        &addrLength);
+
+        if (rval < 0)
+        {
+            if (errno == EINTR || errno == ECONNREFUSED)
+            {
+                continue;
+            }
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                perror("recvfrom");
+                exit(EXIT_FAILURE);
+            }
+
+            if (wait)
+            {
+                removeBusyNodes();
+            }
+
+            break;
+        }
+
+        handleEvent(&addr, &event, (size_t)rval);
+    }
+}
+
+/**
+ * This function delivers all events due at the head of the queue.
+ *
+ * Each batch sends at most one event to every node with due events and then waits for all of them to go back to
+ * sleep, so a node never sees its next event before it has finished processing the previous one.
+ *
+ */
+static void processNextEvents(void)
+{
+    bool sent;
+
+    sNow = sQueue[0].mTime;
+
+    while (sQueueLength > 0 && sQueue[0].mTime == sNow)
+    {
+        struct QueueEntry entry = queuePop();
+
+        if (entry.mFrame == NULL)
+        {
+            if (sNodes[entry.mNode].mValid && entry.mGeneration == sNodes[entry.mNode].mAlarmGeneration)
+            {
+                nodeAppendDue(&sNodes[entry.mNode], entry.mGeneration, NULL);
+            }
+        }
+        else
+        {
+            // The sender gets its own frame back as transmit done.
+            for (uint16_t id = 1; id <= MAX_NODES; id++)
+            {
+                if (sNodes[id].mValid)
+                {
+                    nodeAppendDue(&sNodes[id], 0, entry.mFrame);
+                }
+            }
+
+            frameRelease(entry.mFrame);
+        }
+    }
+
+    do
+    {
+        sent = false;
+
+        for (uint16_t id = 1; id <= MAX_NODES; id++)
+        {
+            struct Node *node = &sNodes[id];
+
+            while (node->mDueCount > 0)
+            {
+                struct Delivery delivery = node->mDue[node->mDueHead++];
+
+                if (--node->mDueCount == 0)
+                {
+                    node->mDueHead = 0;
+                }
+
+                if (delivery.mFrame == NULL)
+                {
+                    // Skip alarms superseded while processing an earlier event of this batch.
+                    if (!node->mValid || delivery.mGeneration != node->mAlarmGeneration)
+                    {
+                        continue;
+                    }
+
+                    nodeSend(node, EVENT_ALARM_FIRED, NULL);
+                }
+                else
+                {
+                    if (node->mValid)
+                    {
+                        nodeSend(node, EVENT_RADIO_RECEIVED, delivery.mFrame);
+                    }
+
+                    frameRelease(delivery.mFrame);
+
+                    if (!node->mValid)
+                    {
+                        continue;
+                    }
+                }
+
+                node->mBusy = true;
+                sBusyCount++;
+                sEventCount++;
+                sent = true;
+                break;
+            }
+        }
+
+        receiveEvents(true);
+    } while (sent);
+}
+
+static void go(uint64_t aDuration)
+{
+    uint64_t start = sNow;
+
+    receiveEvents(false);
+
+    // Like the Python coordinator, the run ends with the first events at or after the end of the duration.
+    while (sNow - start < aDuration)
+    {
+        if (sQueueLength == 0)
+        {
+            sNow = start + aDuration;
+            break;
+        }
+
+        processNextEvents();
+    }
+
+    // Let every node catch up with the end of the run. Unlike the Python coordinator, wait for the nodes to go back
+    // to sleep so that a late reply cannot be taken for the end of an event of the next run.
+    for (uint16_t id = 1; id <= MAX_NODES; id++)
+    {
+        if (sNodes[id].mValid)
+        {
+            nodeSend(&sNodes[id], EVENT_ALARM_FIRED, NULL);
+            sNodes[id].mBusy = true;
+            sBusyCount++;
+        }
+    }
+
+    receiveEvents(true);
+}
+
+static void sniff(unsigned long aId)
+{
+    struct Node *node;
+
+    if (aId < 1 || aId > MAX_NODES)
+    {
+        printf("0\n");
+        return;
+    }
+
+    node = &sNodes[aId];
+
+    printf("%" PRIu32 "\n", node->mSniffedCount);
+    fwrite(node->mSniffed, 1, node->mSniffedLength, stdout);
+
+    node->mSniffedLength = 0;
+    node->mSniffedCount  = 0;
+}
+
+static bool processCommand(char *aLine)
+{
+    char *        argument = strchr(aLine, ' ');
+    unsigned long value    = 0;
+
+    if (argument != NULL)
+    {
+        *argument++ = '\0';
+        value       = strtoul(argument, NULL, 0);
+    }
+
+    if (strcmp(aLine, "go") == 0)
+    {
+        go(value);
+        printf("%" PRIu64 " %" PRIu64 "\n", sNow, sEventCount);
+    }
+    else if (strcmp(aLine, "sniff") == 0)
+    {
+        sniff(value);
+    }
+    else if (strcmp(aLine, "exit") == 0)
+    {
+        return false;
+    }
+    else
+    {
+        fprintf(stderr, "Unknown command: %s\n", aLine);
+        printf("error\n");
+    }
+
+    fflush(stdout);
+
+    if (sVerbose)
+    {
+        fprintf(stderr, "%s %lu: now %" PRIu64 ", %" PRIu64 " events, %zu queued\n", aLine, value, sNow, sEventCount,
+                sQueueLength);
+    }
+
+    return true;
+}
+
+static void socketInit(void)
+{
+    struct sockaddr_in sockaddr;
+    struct timeval     timeout = {NODE_TIMEOUT / 1000, (NODE_TIMEOUT % 1000) * 1000};
+    const char *       offset  = getenv("PORT_OFFSET");
+
+    if (offset != NULL)
+    {
+        char *endptr;
+        long  value = strtol(offset, &endptr, 0);
+
+        if (*endptr != '\0' || value < 0)
+        {
+            fprintf(stderr, "Invalid PORT_OFFSET: %s\n", offset);
+            exit(EXIT_FAILURE);
+        }
+
+        sBasePort = (uint16_t)(BASE_PORT + value * MAX_NODES);
+    }
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port   = htons(sBasePort);
+    inet_pton(AF_INET, "127.0.0.1", &sockaddr.sin_addr);
+
+    sSockFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (sSockFd == -1)
+    {
+        perror("socket");
+        exit(EXIT_FAILURE);
+    }
+
+    if (bind(sSockFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1)
+    {
+        perror("bind");
+        exit(EXIT_FAILURE);
+    }
+
+    if (setsockopt(sSockFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == -1)
+    {
+        perror("setsockopt");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void printHelp(const char *aProgram)
+{
+    fprintf(stderr,
+            "Syntax:\n"
+            "    %s [options]\n"
+            "\n"
+            "Runs the virtual time of POSIX nodes built with OPENTHREAD_POSIX_VIRTUAL_TIME, listening on UDP port\n"
+            "9000 + PORT_OFFSET * %d. Commands are read from stdin:\n"
+            "\n"
+            "    go <usec> ........ Run for the given duration, print `<now> <event-count>`.\n"
+            "    sniff <node> ..... Print and flush the frames sent by a node.\n"
+            "    exit ............. Exit.\n"
+            "\n"
+            "Options:\n"
+            "    -v/--verbose ..... Print a summary of every command to stderr.\n"
+            "    -h/--help ........ Print out usage information and exit.\n",
+            aProgram, MAX_NODES);
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct option kOptions[] = {
+        {"verbose", no_argument, NULL, 'v'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+
+    char   line[MAX_COMMAND_SIZE];
+    size_t lineLength = 0;
+    int    option;
+
+    while ((option = getopt_long(argc, argv, "vh", kOptions, NULL)) != -1)
+    {
+        switch (option)
+        {
+        case 'v':
+            sVerbose = true;
+            break;
+
+        case 'h':
+            printHelp(argv[0]);
+            return EXIT_SUCCESS;
+
+        default:
+            printHelp(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    socketInit();
+
+    for (;;)
+    {
+        struct pollfd pollfds[2] = {{STDIN_FILENO, POLLIN, 0}, {sSockFd, POLLIN, 0}};
+        ssize_t       rval;
+        char *        newline;
+
+        if (poll(pollfds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            perror("poll");
+            return EXIT_FAILURE;
+        }
+
+        // Keep draining the nodes while the test drives them through their CLI.
+        if (pollfds[1].revents != 0)
+        {
+            receiveEvents(false);
+        }
+
+        if (pollfds[0].revents == 0)
+        {
+            continue;
+        }
+
+        rval = read(STDIN_FILENO, line + lineLength, sizeof(line) - 1 - lineLength);
+
+        if (rval <= 0)
+        {
+            break;
+        }
+
+        lineLength += (size_t)rval;
+        line[lineLength] = '\0';
+
+        while ((newline = strchr(line, '\n')) != NULL)
+        {
+            *newline = '\0';
+
+            if (!processCommand(line))
+            {
+                goto exit;
+            }
+
+            lineLength -= (size_t)(newline + 1 - line);
+            memmove(line, newline + 1, lineLength + 1);
+        }
+
+        if (lineLength == sizeof(line) - 1)
+        {
+            fprintf(stderr, "Command too long\n");
+            lineLength = 0;
+        }
+    }
+
+exit:
+    close(sSockFd);
+    return EXIT_SUCCESS;
+}